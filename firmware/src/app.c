@@ -55,6 +55,10 @@
 
 APP_DATA appData;
 
+// time to wait for the first connection attempt before starting
+// the attempt to the other address type (RFC 8305 Connection Attempt Delay)
+#define APP_CONNECT_ATTEMPT_DELAY_MS    250
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -74,6 +78,9 @@ APP_DATA appData;
 
 int32_t _APP_ParseUrl(char *uri, char **host, char **path, uint16_t * port);
 int32_t _APP_ParseIPPort(char *ipPort, char **ip, TCP_PORT *port);
+TCPIP_DNS_RESULT _APP_DnsAddressGet(IP_ADDRESS_TYPE skipType, IP_ADDRESS_TYPE* pType, IP_MULTI_ADDRESS* pAddr);
+NET_PRES_SKT_HANDLE_T _APP_SecureSocketOpen(IP_ADDRESS_TYPE addType, IP_MULTI_ADDRESS* pAddr);
+bool _APP_EarlyMessageQueue(NET_PRES_SKT_HANDLE_T skt);
 NET_PRES_SIGNAL_FUNCTION _APP_MessageReceiveHandler(void);
 char* _APP_ParseMessage (char* message);
 // *****************************************************************************
@@ -186,6 +193,9 @@ void APP_Tasks(void) {
             break;
         case APP_TCPIP_PARSE_IP_PORT:
         {
+            TCPIP_DNS_RESOLVE_TYPE resolveType;
+            TCPIP_DNS_RESULT dnsRes;
+
             //Parse IP and Port then check if data is correct
             _APP_ParseIPPort(appData.ipPortBuffer,&appData.host,&appData.port);
 
@@ -197,18 +207,8 @@ void APP_Tasks(void) {
                 break;
             }
             
-            //Convert String IP to an IPV4_ADDR struct and check if IP is valid
-            if(TCPIP_Helper_StringToIPAddress(appData.host, &appData.address.v4Add) == false)
-            {
-                SYS_CONSOLE_MESSAGE("Invalid IP\r\n");
-                appData.state = APP_TCPIP_WAITING_FOR_COMMAND;
-                break;
-            }
-            
-            SYS_CONSOLE_PRINT("IP: %s, PORT: %d\r\n", appData.host,appData.port);            
-            appData.queryState = IP_ADDRESS_TYPE_IPV4; //Makes sure IPV4 is used (Hardcoded for now)
-            
             //Pre-setup
+            appData.testStart = SYS_TMR_SystemCountGet();
             appData.dnsComplete = 0;
             appData.connectionOpened = 0;
             appData.sslNegComplete = 0;
@@ -218,20 +218,71 @@ void APP_Tasks(void) {
             appData.rawBytesSent = 0;
             appData.clearBytesReceived = 0;
             appData.clearBytesSent = 0;
-            
-            //Next App State After Parsing IP Port
+            appData.raceSocket = NET_PRES_INVALID_SOCKET;
+            appData.raceTried = false;
+            appData.raceEarlyQueued = false;
+
+            //A literal address needs no look up
+            if(TCPIP_Helper_StringToIPAddress(appData.host, &appData.address.v4Add))
+            {
+                SYS_CONSOLE_PRINT("IP: %s, PORT: %d\r\n", appData.host,appData.port);            
+                appData.addressType = IP_ADDRESS_TYPE_IPV4;
+                appData.dnsComplete = appData.testStart;
+                appData.state = APP_TCPIP_OPEN_SECURE_SOCKET;
+                break;
+            }
+#if defined(TCPIP_STACK_USE_IPV6)
+            if(TCPIP_Helper_StringToIPv6Address(appData.host, &appData.address.v6Add))
+            {
+                SYS_CONSOLE_PRINT("IP: %s, PORT: %d\r\n", appData.host,appData.port);            
+                appData.addressType = IP_ADDRESS_TYPE_IPV6;
+                appData.dnsComplete = appData.testStart;
+                appData.state = APP_TCPIP_OPEN_SECURE_SOCKET;
+                break;
+            }
+
+            //A and AAAA are queried in parallel for ipmode ANY
+            resolveType = appData.ipMode == 4 ? TCPIP_DNS_TYPE_A : appData.ipMode == 6 ? TCPIP_DNS_TYPE_AAAA : TCPIP_DNS_TYPE_ANY;
+#else
+            resolveType = TCPIP_DNS_TYPE_A;
+#endif  // defined(TCPIP_STACK_USE_IPV6)
+
+            //Cached names (refreshed in the background by the DNS client) are solved right away
+            dnsRes = TCPIP_DNS_Resolve(appData.host, resolveType);
+            if(dnsRes < 0)
+            {
+                SYS_CONSOLE_PRINT("DNS Resolve for %s failed: %d\r\n", appData.host, dnsRes);
+                appData.state = APP_TCPIP_WAITING_FOR_COMMAND;
+                break;
+            }
+
+            SYS_CONSOLE_PRINT("Host: %s, PORT: %d\r\n", appData.host,appData.port);            
+            appData.state = APP_TCPIP_WAIT_ON_DNS;
+            break;
+        }
+        case APP_TCPIP_WAIT_ON_DNS:
+        {
+            TCPIP_DNS_RESULT dnsRes = _APP_DnsAddressGet(IP_ADDRESS_TYPE_ANY, &appData.addressType, &appData.address);
+            if(dnsRes == TCPIP_DNS_RES_PENDING)
+            {
+                break;
+            }
+
+            if(dnsRes != TCPIP_DNS_RES_OK)
+            {
+                SYS_CONSOLE_PRINT("DNS Resolve for %s failed: %d\r\n", appData.host, dnsRes);
+                appData.state = APP_TCPIP_WAITING_FOR_COMMAND;
+                break;
+            }
+
+            appData.dnsComplete = SYS_TMR_SystemCountGet();
             appData.state = APP_TCPIP_OPEN_SECURE_SOCKET;
             break;
         }
         case APP_TCPIP_OPEN_SECURE_SOCKET:
         {
             SYS_CONSOLE_PRINT("Creating a secure socket for %s at port %d\r\n",appData.host,appData.port);
-            appData.socket = NET_PRES_SocketOpen(0,
-                        NET_PRES_SKT_ENCRYPTED_STREAM_CLIENT,
-                        IP_ADDRESS_TYPE_IPV4,
-                        appData.port,
-                        (NET_PRES_ADDRESS *) & appData.address,
-                        NULL);
+            appData.socket = _APP_SecureSocketOpen(appData.addressType, &appData.address);
             
 //            NET_PRES_SocketWasReset(appData.socket);
             
@@ -245,6 +296,7 @@ void APP_Tasks(void) {
             {
                 SYS_CONSOLE_PRINT("Secure Socket Created Successfully\r\n"
                         "Connecting Socket....\r\n");
+                appData.earlyQueued = appData.earlyMessage && _APP_EarlyMessageQueue(appData.socket);
                 appData.state = APP_TCPIP_WAIT_FOR_SECURE_CONNECTION;
             }     
             
@@ -253,16 +305,47 @@ void APP_Tasks(void) {
         
         case APP_TCPIP_WAIT_FOR_SECURE_CONNECTION:
         {
-            if (!NET_PRES_SocketIsConnected(appData.socket)) 
+            uint64_t currTime = SYS_TMR_SystemCountGet();
+
+            if (NET_PRES_SocketIsConnected(appData.socket)) 
             {
-//                SYS_CONSOLE_PRINT("Connect unsuccess\r\n"); //Make this verbose if selected
-                break;
+                if(appData.raceSocket != NET_PRES_INVALID_SOCKET)
+                {   //First attempt won the race
+                    NET_PRES_SocketClose(appData.raceSocket);
+                    appData.raceSocket = NET_PRES_INVALID_SOCKET;
+                }
+            }
+            else if(appData.raceSocket != NET_PRES_INVALID_SOCKET && NET_PRES_SocketIsConnected(appData.raceSocket))
+            {   //The other address type connected first
+                NET_PRES_SocketClose(appData.socket);
+                appData.socket = appData.raceSocket;
+                appData.raceSocket = NET_PRES_INVALID_SOCKET;
+                appData.earlyQueued = appData.raceEarlyQueued;
+                appData.addressType = appData.raceAddressType;
+                appData.address = appData.raceAddress;
             }
             else
             {
-                SYS_CONSOLE_MESSAGE("Connection Opened: Starting SSL Negotiation\r\n");
-                appData.state = APP_TCPIP_WAIT_FOR_NEGOTIATION;
+//                SYS_CONSOLE_PRINT("Connect unsuccess\r\n"); //Make this verbose if selected
+                //Happy eyeballs: if the first attempt is slow, race it with the other address type
+                if(!appData.raceTried && (currTime - appData.dnsComplete) * 1000ull >= (uint64_t)APP_CONNECT_ATTEMPT_DELAY_MS * SYS_TMR_SystemCountFrequencyGet())
+                {
+                    appData.raceTried = true;
+                    if(_APP_DnsAddressGet(appData.addressType, &appData.raceAddressType, &appData.raceAddress) == TCPIP_DNS_RES_OK)
+                    {
+                        appData.raceSocket = _APP_SecureSocketOpen(appData.raceAddressType, &appData.raceAddress);
+                        if(appData.earlyQueued && appData.raceSocket != NET_PRES_INVALID_SOCKET)
+                        {   //if this fails and the race socket wins the message is sent after the handshake
+                            appData.raceEarlyQueued = _APP_EarlyMessageQueue(appData.raceSocket);
+                        }
+                    }
+                }
+                break;
             }
+
+            SYS_CONSOLE_MESSAGE("Connection Opened: Starting SSL Negotiation\r\n");
+            appData.connectionOpened = currTime;
+            appData.state = APP_TCPIP_WAIT_FOR_NEGOTIATION;
             break;
         }
         case APP_TCPIP_WAIT_FOR_NEGOTIATION:
@@ -274,6 +357,7 @@ void APP_Tasks(void) {
             else
             {
                 SYS_CONSOLE_MESSAGE("Negotiation Complete\r\n");
+                appData.sslNegComplete = SYS_TMR_SystemCountGet();
             }
             
             if(NET_PRES_SocketIsSecure(appData.socket)) 
@@ -285,6 +369,19 @@ void APP_Tasks(void) {
                 //Create Signal Handler Here which allows asynchronous communications
                 appData.receivehandle = NET_PRES_SocketSignalHandlerRegister(appData.socket, (uint16_t)TCPIP_TCP_SIGNAL_RX_DATA , (NET_PRES_SIGNAL_FUNCTION)_APP_MessageReceiveHandler, (void*)(0));
                 appData.state = APP_TCPIP_WAIT_FOR_MESSAGE;
+                if(appData.earlyQueued)
+                {
+                    appData.clearBytesSent += sizeof(appData.message);
+                    appData.rawBytesSent += sizeof(appData.message);
+                    SYS_CONSOLE_PRINT("The message, \"%s\" ,was sent with the handshake\r\n",appData.message);
+                }
+                else if(appData.earlyMessage)
+                {   //Early data not available; send it now
+                    appData.state = APP_TCPIP_SEND_MESSAGE;
+                }
+                appData.earlyMessage = false;
+                appData.earlyQueued = false;
+                appData.raceEarlyQueued = false;
                 break;
             }
             else
@@ -304,7 +401,10 @@ void APP_Tasks(void) {
         {
             if(NET_PRES_SocketWriteIsReady(appData.socket,sizeof(appData.message),1))
             {
-                NET_PRES_SocketWrite(appData.socket, appData.message,sizeof(appData.message));
+                uint16_t res = NET_PRES_SocketWrite(appData.socket, appData.message,sizeof(appData.message));
+
+                appData.clearBytesSent += res;
+                appData.rawBytesSent += res;
                 SYS_CONSOLE_PRINT("The message, \"%s\" ,was written to socket\r\n",appData.message);
                 appData.state = APP_TCPIP_WAIT_FOR_MESSAGE;
                 break;
@@ -394,6 +494,61 @@ int32_t _APP_ParseIPPort(char *ipPort, char **host, TCP_PORT *port)
     
     return APP_NO_ERROR;
 }
+//Gets an address for appData.host, other than the skipType
+//IPv6 is preferred when ipMode allows it
+TCPIP_DNS_RESULT _APP_DnsAddressGet(IP_ADDRESS_TYPE skipType, IP_ADDRESS_TYPE* pType, IP_MULTI_ADDRESS* pAddr)
+{
+    IPV4_ADDR addr4;
+    IPV6_ADDR* pAddr6 = 0;
+    TCPIP_DNS_RESULT dnsRes;
+
+#if defined(TCPIP_STACK_USE_IPV6)
+    IPV6_ADDR addr6;
+    pAddr6 = &addr6;
+#endif  // defined(TCPIP_STACK_USE_IPV6)
+
+    dnsRes = TCPIP_DNS_IsNameResolved(appData.host, &addr4, pAddr6);
+    if(dnsRes != TCPIP_DNS_RES_OK)
+    {
+        return dnsRes;
+    }
+
+#if defined(TCPIP_STACK_USE_IPV6)
+    if(skipType != IP_ADDRESS_TYPE_IPV6 && appData.ipMode != 4 && memcmp(addr6.v, IPV6_FIXED_ADDR_UNSPECIFIED.v, sizeof(addr6)) != 0)
+    {
+        *pType = IP_ADDRESS_TYPE_IPV6;
+        memcpy(pAddr->v6Add.v, addr6.v, sizeof(addr6));
+        return TCPIP_DNS_RES_OK;
+    }
+#endif  // defined(TCPIP_STACK_USE_IPV6)
+
+    if(skipType != IP_ADDRESS_TYPE_IPV4 && appData.ipMode != 6 && addr4.Val != 0)
+    {
+        *pType = IP_ADDRESS_TYPE_IPV4;
+        pAddr->v4Add.Val = addr4.Val;
+        return TCPIP_DNS_RES_OK;
+    }
+
+    return TCPIP_DNS_RES_NO_IP_ENTRY;
+}
+
+NET_PRES_SKT_HANDLE_T _APP_SecureSocketOpen(IP_ADDRESS_TYPE addType, IP_MULTI_ADDRESS* pAddr)
+{
+    return NET_PRES_SocketOpen(0,
+                NET_PRES_SKT_ENCRYPTED_STREAM_CLIENT,
+                addType,
+                appData.port,
+                (NET_PRES_ADDRESS *)pAddr,
+                NULL);
+}
+
+//Queues the connect_tls message before the negotiation starts
+//net_pres sends it as 0-RTT early data when the session is resumed, otherwise right after the handshake
+bool _APP_EarlyMessageQueue(NET_PRES_SKT_HANDLE_T skt)
+{
+    return NET_PRES_SocketEarlyWrite(skt, appData.message, sizeof(appData.message)) != 0;
+}
+
 char* _APP_ParseMessage (char* message)
 {
     return message;
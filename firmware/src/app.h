@@ -110,9 +110,17 @@ typedef struct
     void* ctx;
     void* ssl;
     char urlBuffer[256];
-    char ipPortBuffer[24]; //Only Supports IPV4 (Joem)
+    char ipPortBuffer[TCPIP_DNS_CLIENT_MAX_HOSTNAME_LEN + 8]; //host name or IP address and ':port'
     char message[128]; //Make sure that Command Buffer and UART Buffer can support this
+    bool earlyMessage;  //connect_tls carries a message to send with the handshake
+    bool earlyQueued;   //the message was queued as early data
     NET_PRES_SIGNAL_HANDLE receivehandle;
+    NET_PRES_SKT_HANDLE_T raceSocket;       //connection attempt to the other address type
+    IP_ADDRESS_TYPE addressType;
+    IP_ADDRESS_TYPE raceAddressType;
+    IP_MULTI_ADDRESS raceAddress;
+    bool raceTried;
+    bool raceEarlyQueued;   //the message was queued as early data on the race socket
     char * host;
     char * path;
     uint8_t ipMode;
@@ -41,7 +41,21 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include "app_commands.h"
 #include "app.h"
 #include "config.h"
+#include "net_pres/pres/net_pres_enc_glue.h"
 #include <wolfssl/ssl.h>
+#include <wolfssl/wolfcrypt/ecc.h>
+#include <wolfssl/wolfcrypt/random.h>
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/hash.h>
+#include <wolfssl/wolfcrypt/sha256.h>
+#include <wolfssl/wolfcrypt/asn_public.h>
+#include <wolfssl/error-ssl.h>
+#if (APP_COMMANDS_BENCH_ENABLE != 0)
+#define USE_CERT_BUFFERS_256
+#include <wolfssl/certs_test.h>
+#include <malloc.h>
+#include "net_pres/pres/net_pres_certstore.h"
+#endif
 
 #if defined(TCPIP_STACK_COMMAND_ENABLE)
 char wolfSSLLog[1024] = {0};
@@ -53,6 +67,10 @@ static void _APP_Commands_IPMode(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** a
 static void _APP_Commands_Stats(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
 static void _APP_Commands_GetUnixTime(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
 static void _APP_Commands_WolfSSLLog(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+static void _APP_Commands_TlsStat(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+#if (APP_COMMANDS_BENCH_ENABLE != 0)
+static void _APP_Commands_CryptoBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+#endif
 
 //My Custom Application Commands
 static void _APP_Commands_ConnectTLS(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
@@ -65,6 +83,10 @@ static const SYS_CMD_DESCRIPTOR    appCmdTbl[]=
     {"stats", _APP_Commands_Stats, ": Statistics"},
     {"unixtime", _APP_Commands_GetUnixTime, ": Unix Time"},
     {"wolfsslLog", _APP_Commands_WolfSSLLog, ": wolfSSL Log"},
+    {"tlsstat", _APP_Commands_TlsStat, ": TLS handshake timing"},
+#if (APP_COMMANDS_BENCH_ENABLE != 0)
+    {"cryptobench", _APP_Commands_CryptoBench, ": wolfCrypt benchmark"},
+#endif
     {"connect_tls", _APP_Commands_ConnectTLS, ": Connect to a server securely"},
     {"disconnect_tls", _APP_Commands_DisconnectTLS,": Disconnect to a server"},
     {"send_msg", _APP_Commands_SendMessage,": send message to server"},
@@ -90,11 +112,15 @@ void _APP_Commands_ConnectTLS(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv
     wolfSSLLogSize = 0;
 
     //"help connect_tls"
-    if (argc != 2)
+    if (argc != 2 && argc != 3)
     {
-        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Usage: connect_tls <ipv4/v6>:<port>\r\n"
-                "   Be sure to set correct ipMode (Default: ipv4)\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Usage: connect_tls <host/ipv4/v6>:<port> <message>\r\n"
+                "   Be sure to set correct ipMode (Default: ipv4)\r\n"
+                "   With ipMode ANY the host A and AAAA records are looked up in parallel\r\n"
+                "   The message is sent with the handshake, as TLS 1.3 early data when resuming\r\n");
         (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Ex: connect_tls 192.168.0.1:11111\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Ex: connect_tls www.example.com:443 Hello,World\r\n");
+        return;
     }
     if (appData.state != APP_TCPIP_WAITING_FOR_COMMAND)
     {
@@ -102,7 +128,14 @@ void _APP_Commands_ConnectTLS(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv
     }
     
     appData.state = APP_TCPIP_PARSE_IP_PORT;
-    strncpy(appData.ipPortBuffer, argv[1], sizeof(appData.ipPortBuffer));
+    strncpy(appData.ipPortBuffer, argv[1], sizeof(appData.ipPortBuffer) - 1);
+    appData.ipPortBuffer[sizeof(appData.ipPortBuffer) - 1] = 0;
+    appData.earlyMessage = argc == 3;
+    if (appData.earlyMessage)
+    {
+        memset(appData.message, 0, sizeof(appData.message));
+        strncpy(appData.message, argv[2], sizeof(appData.message) - 1);
+    }
 }
 void _APP_Commands_DisconnectTLS(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 {
@@ -227,10 +260,18 @@ void _APP_Commands_Stats(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 void _APP_Commands_GetUnixTime(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 {
     const void* cmdIoParam = pCmdIO->cmdIoParam;
-    uint32_t sec = TCPIP_SNTP_UTCSecondsGet();
-    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Time from SNTP: %d\r\n", sec);
+    uint32_t sec, us;
+    TCPIP_SNTP_STATISTICS ntpStat;
+    TCPIP_SNTP_RESULT res = TCPIP_SNTP_TimeGetUs(&sec, &us);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Time from SNTP: %d.%06d, status: %d\r\n", sec, us, res);
     (*pCmdIO->pCmdApi->print)(cmdIoParam, "Low Rez Timer: %d\r\n", SYS_TIME_CounterGet() /
                              SYS_TIME_FrequencyGet());
+
+    TCPIP_SNTP_StatisticsGet(&ntpStat);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "SNTP offset: %d us, delay: %d us, jitter: %d us, freq: %d ppb\r\n",
+                             ntpStat.offsetUs, ntpStat.delayUs, ntpStat.jitterUs, ntpStat.freqPpb);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "SNTP updates: %d, steps: %d, samples: %d, servers: %d\r\n",
+                             ntpStat.nUpdates, ntpStat.nSteps, ntpStat.nSamples, ntpStat.nServers);
     
 }
 
@@ -240,5 +281,1163 @@ static void _APP_Commands_WolfSSLLog(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char
     
 }
 
+static void _APP_Commands_TlsStat(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    NET_PRES_HANDSHAKE_STATS hsStat;
+    NET_PRES_EARLY_DATA_STATS earlyStat;
+    NET_PRES_RX_STATS rxStat;
+    uint32_t nSends;
+    uint32_t callsPerKb;
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+    NET_PRES_CHAIN_CACHE_STATS chainStat;
+#endif
+    bool clear = false;
+
+    if (argc == 2 && strcmp(argv[1], "clear") == 0)
+    {
+        clear = true;
+    }
+    else if (argc == 3 && strcmp(argv[1], "slice") == 0)
+    {
+        NET_PRES_EncGlue_HandshakeSliceSet((uint32_t)atoi(argv[2]));
+    }
+#if defined(WOLFSSL_READ_AHEAD)
+    else if (argc == 3 && strcmp(argv[1], "readahead") == 0 && (strcmp(argv[2], "on") == 0 || strcmp(argv[2], "off") == 0))
+    {
+        if (!NET_PRES_EncGlue_ReadAheadSet(strcmp(argv[2], "on") == 0))
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Read-ahead not changed\r\n");
+            return;
+        }
+    }
+#endif
+    else if (argc != 1)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Usage: tlsstat <clear> <slice us> <readahead on/off>\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Ex: tlsstat slice 0 - run every handshake call to completion\r\n");
+        return;
+    }
+
+    if (!NET_PRES_HandshakeStatsGet(&hsStat, clear))
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "   Net Pres not initialized\r\n");
+        return;
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "TLS handshakes: %d, failed: %d, slice: %d us\r\n",
+                             hsStat.nHandshakes, hsStat.nFailed, NET_PRES_EncGlue_HandshakeSliceGet());
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Connect calls: %d, worst call: %d us\r\n", hsStat.nCalls, hsStat.maxCallUs);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Last handshake calls: %d, worst call: %d us, busy: %d us\r\n",
+                             hsStat.lastCalls, hsStat.lastMaxCallUs, hsStat.lastBusyUs);
+    NET_PRES_EarlyDataStatsGet(&earlyStat, clear);
+    nSends = earlyStat.nQueued + earlyStat.nWrites;
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Sends: %d, 0-RTT: %d (%d%%), %d bytes; early data rejected: %d, no ticket: %d\r\n",
+                             nSends, earlyStat.nAccepted, nSends == 0 ? 0 : (int)((earlyStat.nAccepted * 100ull) / nSends),
+                             earlyStat.acceptedBytes, earlyStat.nRejected, earlyStat.nQueued - earlyStat.nAccepted - earlyStat.nRejected);
+    NET_PRES_EncGlue_RxStatsGet(&rxStat, clear);
+    callsPerKb = rxStat.bytes == 0 ? 0 : (uint32_t)((rxStat.nCalls * 10240ull) / rxStat.bytes);    // tenths
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Receive calls: %d, reads: %d, %d bytes, %d.%d calls/KB, read-ahead: %s\r\n",
+                             rxStat.nCalls, rxStat.nReads, rxStat.bytes, callsPerKb / 10, callsPerKb % 10,
+#if defined(WOLFSSL_READ_AHEAD)
+                             NET_PRES_EncGlue_ReadAheadGet() ? "on" : "off");
+#else
+                             "off");
+#endif
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+    NET_PRES_EncGlue_ChainCacheStatsGet(&chainStat, clear);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "Chain cache lookups: %d, hits: %d (%d%%), stale: %d, inserts: %d, evictions: %d\r\n",
+                             chainStat.lookups, chainStat.hits, chainStat.lookups == 0 ? 0 : (int)((chainStat.hits * 100ull) / chainStat.lookups),
+                             chainStat.stale, chainStat.inserts, chainStat.evictions);
+#endif
+}
+
+
+#if (APP_COMMANDS_BENCH_ENABLE != 0)
+#if !defined(APP_COMMANDS_BENCH_STACK_PAINT)
+#define APP_COMMANDS_BENCH_STACK_PAINT  32768   // stack bytes checked for the peak usage
+#endif
+#define _APP_BENCH_STACK_PATTERN        0xa5a5a5a5
+#define _APP_BENCH_TLS_RECORD_SIZE      16384   // TLS maximum plaintext record
+#define _APP_BENCH_TLS_PIPE_SIZE        17408   // holds a handshake flight or a full size record
+
+#if defined(WOLFSSL_SP_MATH)
+#define _APP_BENCH_MATH_NAME    "sp"
+#elif defined(WOLFSSL_SP)
+#define _APP_BENCH_MATH_NAME    "sp_c32, fastmath fallback"
+#else
+#define _APP_BENCH_MATH_NAME    "fastmath"
+#endif
+
+// CPU cycles per operation for a system count interval
+static uint32_t _APP_BenchCycles(uint64_t sysCount, uint32_t nOps)
+{
+    uint64_t cycles = (sysCount * (SYS_TIME_CPU_CLOCK_FREQUENCY / 1000)) / (SYS_TMR_SystemCountFrequencyGet() / 1000);
+    return (uint32_t)(cycles / nOps);
+}
+
+typedef struct
+{
+    ecc_key key;
+    mp_int  a;
+    mp_int  prime;
+}_APP_ECC_BENCH;
+
+// P-256 k*G: the generic point multiply vs. the key generation path
+static void _APP_BenchEcc(SYS_CMD_DEVICE_NODE* pCmdIO, int nIters)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    int ix, ret, curveIx;
+    uint64_t tStart;
+    uint32_t cycGeneric = 0, cycKeyGen = 0;
+    bool match = false;
+    WC_RNG rng;
+    ecc_point *pG = 0, *pR = 0;
+    const ecc_set_type* pCurve;
+    _APP_ECC_BENCH* pBench;
+
+    pBench = (_APP_ECC_BENCH*)XMALLOC(sizeof(*pBench), NULL, DYNAMIC_TYPE_ECC);
+    if (pBench == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "cryptobench: Failed to allocate memory\r\n");
+        return;
+    }
+    if (wc_InitRng(&rng) != 0)
+    {
+        XFREE(pBench, NULL, DYNAMIC_TYPE_ECC);
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "cryptobench: Failed to initialize the RNG\r\n");
+        return;
+    }
+
+    curveIx = wc_ecc_get_curve_idx(ECC_SECP256R1);
+    pCurve = wc_ecc_get_curve_params(curveIx);
+    ret = wc_ecc_init(&pBench->key);
+    if (ret == 0)
+    {
+        ret = mp_init_multi(&pBench->a, &pBench->prime, 0, 0, 0, 0);
+    }
+    if (ret == 0)
+    {
+        pG = wc_ecc_new_point();
+        pR = wc_ecc_new_point();
+        ret = (pG == 0 || pR == 0) ? MEMORY_E : 0;
+    }
+    if (ret == 0)
+    {
+        ret = mp_read_radix(&pBench->a, pCurve->Af, MP_RADIX_HEX);
+    }
+    if (ret == 0)
+    {
+        ret = mp_read_radix(&pBench->prime, pCurve->prime, MP_RADIX_HEX);
+    }
+    if (ret == 0)
+    {
+        ret = mp_read_radix(pG->x, pCurve->Gx, MP_RADIX_HEX);
+    }
+    if (ret == 0)
+    {
+        ret = mp_read_radix(pG->y, pCurve->Gy, MP_RADIX_HEX);
+    }
+    if (ret == 0)
+    {
+        ret = mp_set(pG->z, 1);
+    }
+
+    if (ret == 0)
+    {   // key generation; uses the fixed base comb, if built in
+        tStart = SYS_TMR_SystemCountGet();
+        for (ix = 0; ix < nIters && ret == 0; ix++)
+        {
+            wc_ecc_free(&pBench->key);
+            wc_ecc_init(&pBench->key);
+            ret = wc_ecc_make_key_ex(&rng, 32, &pBench->key, ECC_SECP256R1);
+        }
+        cycKeyGen = _APP_BenchCycles(SYS_TMR_SystemCountGet() - tStart, nIters);
+    }
+
+    if (ret == 0)
+    {   // the generator treated as an arbitrary point; same scalar as the last key
+        tStart = SYS_TMR_SystemCountGet();
+        for (ix = 0; ix < nIters && ret == 0; ix++)
+        {
+            ret = wc_ecc_mulmod(&pBench->key.k, pG, pR, &pBench->a, &pBench->prime, 1);
+        }
+        cycGeneric = _APP_BenchCycles(SYS_TMR_SystemCountGet() - tStart, nIters);
+        match = ret == 0 && mp_cmp(pR->x, pBench->key.pubkey.x) == MP_EQ && mp_cmp(pR->y, pBench->key.pubkey.y) == MP_EQ;
+    }
+
+    if (ret != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: ecc failed: %d\r\n", ret);
+    }
+    else
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: P-256 k*G, %d iterations, cycles per op:\r\n", nIters);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tgeneric mulmod: %u\r\n", cycGeneric);
+#if defined(WOLFSSL_HAVE_SP_ECC)
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tkey gen, sp: %u, result %s\r\n", cycKeyGen, match ? "match" : "MISMATCH");
+#elif defined(WOLFSSL_ECC_P256_COMB)
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tkey gen, comb: %u, result %s\r\n", cycKeyGen, match ? "match" : "MISMATCH");
+#else
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tkey gen: %u, result %s\r\n", cycKeyGen, match ? "match" : "MISMATCH");
+#endif
+    }
+
+    wc_ecc_del_point(pR);
+    wc_ecc_del_point(pG);
+    mp_clear(&pBench->prime);
+    mp_clear(&pBench->a);
+    wc_ecc_free(&pBench->key);
+    wc_FreeRng(&rng);
+    XFREE(pBench, NULL, DYNAMIC_TYPE_ECC);
+}
+
+// lowest stack address, from the XC32 best-fit allocator
+extern uint32_t _splim;
+// lowest painted address; the paint stops at the stack limit
+static uint32_t* _APP_benchStackBottom;
+
+// fills the unused stack below the caller with a pattern
+// returns the top of the painted area
+static __attribute__((noinline)) uint32_t* _APP_BenchStackPaint(void)
+{
+    volatile uint32_t stackMark;
+    uint32_t* pTop = (uint32_t*)(((uintptr_t)&stackMark - 256) & ~3);
+    uint32_t* pLimit = (uint32_t*)(((uintptr_t)&_splim + 3) & ~3);
+    volatile uint32_t* pPaint;
+
+    _APP_benchStackBottom = pTop - APP_COMMANDS_BENCH_STACK_PAINT / 4;
+    if (pTop <= pLimit)
+    {
+        _APP_benchStackBottom = pTop;
+    }
+    else if (_APP_benchStackBottom < pLimit)
+    {   // smaller stack than the paint size; don't touch the heap below it
+        _APP_benchStackBottom = pLimit;
+    }
+
+    pPaint = _APP_benchStackBottom;
+    while (pPaint < pTop)
+    {
+        *pPaint++ = _APP_BENCH_STACK_PATTERN;
+    }
+
+    return pTop;
+}
+
+// stack bytes used below the painted top since _APP_BenchStackPaint
+static uint32_t _APP_BenchStackUsed(const uint32_t* pTop)
+{
+    const volatile uint32_t* pScan = _APP_benchStackBottom;
+
+    while (pScan < pTop && *pScan == _APP_BENCH_STACK_PATTERN)
+    {
+        pScan++;
+    }
+
+    return (pTop - pScan) * 4;
+}
+
+// in memory transport for one direction of the benchmark connection
+typedef struct
+{
+    uint16_t    rdIx;
+    uint16_t    wrIx;
+    uint8_t     data[_APP_BENCH_TLS_PIPE_SIZE];
+}_APP_BENCH_PIPE;
+
+typedef struct
+{
+    _APP_BENCH_PIPE toServer;
+    _APP_BENCH_PIPE toClient;
+    WOLFSSL_CTX*    pCliCtx;
+    WOLFSSL_CTX*    pSrvCtx;
+    WOLFSSL*        pCli;
+    WOLFSSL*        pSrv;
+    uint64_t        cliCount;   // system count spent in the client calls
+    uint64_t        srvCount;   // system count spent in the server calls
+    int             error;      // wolfSSL error of the failed step
+}_APP_BENCH_TLS;
+
+static int _APP_BenchPipeRecv(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    _APP_BENCH_PIPE* pPipe = (_APP_BENCH_PIPE*)ctx;
+    int avlbl = pPipe->wrIx - pPipe->rdIx;
+
+    if (avlbl == 0)
+    {
+        return WOLFSSL_CBIO_ERR_WANT_READ;
+    }
+    if (sz > avlbl)
+    {
+        sz = avlbl;
+    }
+    memcpy(buf, pPipe->data + pPipe->rdIx, sz);
+    pPipe->rdIx += sz;
+    if (pPipe->rdIx == pPipe->wrIx)
+    {
+        pPipe->rdIx = pPipe->wrIx = 0;
+    }
+    return sz;
+}
+
+static int _APP_BenchPipeSend(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    _APP_BENCH_PIPE* pPipe = (_APP_BENCH_PIPE*)ctx;
+    int space = sizeof(pPipe->data) - pPipe->wrIx;
+
+    if (space == 0)
+    {
+        return WOLFSSL_CBIO_ERR_WANT_WRITE;
+    }
+    if (sz > space)
+    {
+        sz = space;
+    }
+    memcpy(pPipe->data + pPipe->wrIx, buf, sz);
+    pPipe->wrIx += sz;
+    return sz;
+}
+
+// the benchmark certificates have fixed validity dates; ignore the date checks only
+static int _APP_BenchVerifyCb(int preverify, WOLFSSL_X509_STORE_CTX* store)
+{
+    if (preverify == 0 && store != 0)
+    {
+        return store->error == ASN_BEFORE_DATE_E || store->error == ASN_AFTER_DATE_E;
+    }
+    return preverify;
+}
+
+// creates the client and server contexts
+// a cipher list without TLS 1.3 suites runs the connection over TLS 1.2
+// returns 0 if success, the failed step otherwise
+static const char* _APP_BenchTlsInit(_APP_BENCH_TLS* pBench, bool eccCert, const char* cipherList)
+{
+    if (cipherList != 0 && strstr(cipherList, "TLS13-") == 0)
+    {
+        pBench->pCliCtx = wolfSSL_CTX_new(wolfTLSv1_2_client_method());
+    }
+    else
+    {
+        pBench->pCliCtx = wolfSSL_CTX_new(wolfSSLv23_client_method());
+    }
+    pBench->pSrvCtx = wolfSSL_CTX_new(wolfSSLv23_server_method());
+    if (pBench->pCliCtx == 0 || pBench->pSrvCtx == 0)
+    {
+        return "context";
+    }
+
+    wolfSSL_SetIORecv(pBench->pCliCtx, _APP_BenchPipeRecv);
+    wolfSSL_SetIOSend(pBench->pCliCtx, _APP_BenchPipeSend);
+    wolfSSL_SetIORecv(pBench->pSrvCtx, _APP_BenchPipeRecv);
+    wolfSSL_SetIOSend(pBench->pSrvCtx, _APP_BenchPipeSend);
+    wolfSSL_CTX_set_verify(pBench->pCliCtx, WOLFSSL_VERIFY_PEER, _APP_BenchVerifyCb);
+    if (eccCert)
+    {
+        if (wolfSSL_CTX_load_verify_buffer_ex(pBench->pCliCtx, ca_ecc_cert_der_256, sizeof(ca_ecc_cert_der_256), SSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) != SSL_SUCCESS ||
+            wolfSSL_CTX_use_certificate_buffer(pBench->pSrvCtx, serv_ecc_der_256, sizeof(serv_ecc_der_256), SSL_FILETYPE_ASN1) != SSL_SUCCESS ||
+            wolfSSL_CTX_use_PrivateKey_buffer(pBench->pSrvCtx, ecc_key_der_256, sizeof(ecc_key_der_256), SSL_FILETYPE_ASN1) != SSL_SUCCESS)
+        {
+            return "certificates";
+        }
+    }
+    else
+    {
+        if (wolfSSL_CTX_load_verify_buffer_ex(pBench->pCliCtx, ca_cert_der_2048, sizeof(ca_cert_der_2048), SSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) != SSL_SUCCESS ||
+            wolfSSL_CTX_use_certificate_buffer(pBench->pSrvCtx, server_cert_der_2048, sizeof(server_cert_der_2048), SSL_FILETYPE_ASN1) != SSL_SUCCESS ||
+            wolfSSL_CTX_use_PrivateKey_buffer(pBench->pSrvCtx, server_key_der_2048, sizeof(server_key_der_2048), SSL_FILETYPE_ASN1) != SSL_SUCCESS)
+        {
+            return "certificates";
+        }
+    }
+
+    if (cipherList != 0)
+    {
+        if (wolfSSL_CTX_set_cipher_list(pBench->pCliCtx, cipherList) != SSL_SUCCESS ||
+            wolfSSL_CTX_set_cipher_list(pBench->pSrvCtx, cipherList) != SSL_SUCCESS)
+        {
+            return "cipher list";
+        }
+    }
+
+    return 0;
+}
+
+// creates a client and a server session and runs the handshake between them
+// returns 0 if success, the failed step otherwise
+static const char* _APP_BenchTlsHandshake(_APP_BENCH_TLS* pBench)
+{
+    uint64_t tStart;
+    int nRounds, ret;
+    bool cliDone, srvDone;
+
+    pBench->toServer.rdIx = pBench->toServer.wrIx = 0;
+    pBench->toClient.rdIx = pBench->toClient.wrIx = 0;
+    pBench->pCli = wolfSSL_new(pBench->pCliCtx);
+    pBench->pSrv = wolfSSL_new(pBench->pSrvCtx);
+    if (pBench->pCli == 0 || pBench->pSrv == 0)
+    {
+        return "session";
+    }
+    wolfSSL_SetIOReadCtx(pBench->pCli, &pBench->toClient);
+    wolfSSL_SetIOWriteCtx(pBench->pCli, &pBench->toServer);
+    wolfSSL_SetIOReadCtx(pBench->pSrv, &pBench->toServer);
+    wolfSSL_SetIOWriteCtx(pBench->pSrv, &pBench->toClient);
+
+    cliDone = srvDone = false;
+    for (nRounds = 0; !(cliDone && srvDone); nRounds++)
+    {
+        if (nRounds == 20)
+        {
+            return "handshake stalled";
+        }
+        if (!cliDone)
+        {
+            tStart = SYS_TMR_SystemCountGet();
+            ret = wolfSSL_connect(pBench->pCli);
+            pBench->cliCount += SYS_TMR_SystemCountGet() - tStart;
+            if (ret == SSL_SUCCESS)
+            {
+                cliDone = true;
+            }
+            else if ((ret = wolfSSL_get_error(pBench->pCli, ret)) != SSL_ERROR_WANT_READ && ret != SSL_ERROR_WANT_WRITE)
+            {
+                pBench->error = ret;
+                return "client handshake";
+            }
+        }
+        if (!srvDone)
+        {
+            tStart = SYS_TMR_SystemCountGet();
+            ret = wolfSSL_accept(pBench->pSrv);
+            pBench->srvCount += SYS_TMR_SystemCountGet() - tStart;
+            if (ret == SSL_SUCCESS)
+            {
+                srvDone = true;
+            }
+            else if ((ret = wolfSSL_get_error(pBench->pSrv, ret)) != SSL_ERROR_WANT_READ && ret != SSL_ERROR_WANT_WRITE)
+            {
+                pBench->error = ret;
+                return "server handshake";
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void _APP_BenchTlsSessionFree(_APP_BENCH_TLS* pBench)
+{
+    wolfSSL_free(pBench->pCli);
+    wolfSSL_free(pBench->pSrv);
+    pBench->pCli = pBench->pSrv = 0;
+}
+
+static _APP_BENCH_TLS* _APP_BenchTlsAlloc(SYS_CMD_DEVICE_NODE* pCmdIO)
+{
+    _APP_BENCH_TLS* pBench = (_APP_BENCH_TLS*)XMALLOC(sizeof(*pBench), NULL, DYNAMIC_TYPE_TMP_BUFFER);
+
+    if (pBench == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(pCmdIO->cmdIoParam, "cryptobench: Failed to allocate memory\r\n");
+        return 0;
+    }
+
+    memset(pBench, 0, sizeof(*pBench));
+    wolfSSL_Init();
+    return pBench;
+}
+
+static void _APP_BenchTlsFree(_APP_BENCH_TLS* pBench)
+{
+    _APP_BenchTlsSessionFree(pBench);
+    wolfSSL_CTX_free(pBench->pSrvCtx);
+    wolfSSL_CTX_free(pBench->pCliCtx);
+    wolfSSL_Cleanup();
+    XFREE(pBench, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
+// loopback TLS handshake: client and server both run here, over memory pipes
+// reports the time spent on each side and the peak stack
+static void _APP_BenchTls(SYS_CMD_DEVICE_NODE* pCmdIO, int nIters, bool eccCert)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    _APP_BENCH_TLS* pBench;
+    uint32_t* pStackTop;
+    uint32_t stackUsed;
+    int ix;
+    const char* failStep;
+
+    if ((pBench = _APP_BenchTlsAlloc(pCmdIO)) == 0)
+    {
+        return;
+    }
+
+    failStep = _APP_BenchTlsInit(pBench, eccCert, 0);
+    pStackTop = _APP_BenchStackPaint();
+    for (ix = 0; ix < nIters && failStep == 0; ix++)
+    {
+        failStep = _APP_BenchTlsHandshake(pBench);
+        if (ix == 0 && failStep == 0)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: %s, %s, %s certificate, math: %s\r\n", wolfSSL_get_version(pBench->pCli), wolfSSL_get_cipher(pBench->pCli),
+                    eccCert ? "P-256" : "RSA-2048", _APP_BENCH_MATH_NAME);
+        }
+        _APP_BenchTlsSessionFree(pBench);
+    }
+    stackUsed = _APP_BenchStackUsed(pStackTop);
+
+    if (failStep != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: tls failed: %s, error %d\r\n", failStep, pBench->error);
+    }
+    else
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\t%d handshakes, per handshake: client %u us, server %u us\r\n", nIters,
+                (uint32_t)((pBench->cliCount * 1000000ull) / SYS_TMR_SystemCountFrequencyGet() / nIters),
+                (uint32_t)((pBench->srvCount * 1000000ull) / SYS_TMR_SystemCountFrequencyGet() / nIters));
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tpeak stack: %s%u bytes\r\n", stackUsed == APP_COMMANDS_BENCH_STACK_PAINT ? ">= " : "", stackUsed);
+    }
+
+    _APP_BenchTlsFree(pBench);
+}
+
+// prints a byte rate in MB/s
+static void _APP_BenchRatePrint(SYS_CMD_DEVICE_NODE* pCmdIO, const char* name, uint64_t nBytes, uint64_t sysCount)
+{
+    uint32_t rate = sysCount == 0 ? 0 : (uint32_t)((nBytes * SYS_TMR_SystemCountFrequencyGet()) / sysCount / 10000);   // 10 KB/s units
+
+    (*pCmdIO->pCmdApi->print)(pCmdIO->cmdIoParam, "\t%s: %u.%02u MB/s\r\n", name, rate / 100, rate % 100);
+}
+
+// record layer throughput over the loopback connection:
+// the client writes full size records, the server reads them
+static void _APP_BenchTlsRecord(SYS_CMD_DEVICE_NODE* pCmdIO, int nIters, const char* cipherList)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    _APP_BENCH_TLS* pBench;
+    uint8_t* pData;
+    uint64_t tStart;
+    int ix, nRead, ret;
+    const char* failStep;
+
+    if ((pBench = _APP_BenchTlsAlloc(pCmdIO)) == 0)
+    {
+        return;
+    }
+    pData = (uint8_t*)XMALLOC(_APP_BENCH_TLS_RECORD_SIZE, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+
+    failStep = pData == 0 ? "memory" : _APP_BenchTlsInit(pBench, true, cipherList);
+    if (failStep == 0)
+    {
+        failStep = _APP_BenchTlsHandshake(pBench);
+    }
+
+    if (failStep == 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: %s, %s, %d records of %d bytes\r\n", wolfSSL_get_version(pBench->pCli), wolfSSL_get_cipher(pBench->pCli),
+                nIters, _APP_BENCH_TLS_RECORD_SIZE);
+        memset(pData, 0x5a, _APP_BENCH_TLS_RECORD_SIZE);
+        pBench->cliCount = pBench->srvCount = 0;
+    }
+
+    for (ix = 0; ix < nIters && failStep == 0; ix++)
+    {
+        tStart = SYS_TMR_SystemCountGet();
+        ret = wolfSSL_write(pBench->pCli, pData, _APP_BENCH_TLS_RECORD_SIZE);
+        pBench->cliCount += SYS_TMR_SystemCountGet() - tStart;
+        if (ret != _APP_BENCH_TLS_RECORD_SIZE)
+        {
+            pBench->error = wolfSSL_get_error(pBench->pCli, ret);
+            failStep = "write";
+            break;
+        }
+
+        for (nRead = 0; nRead < _APP_BENCH_TLS_RECORD_SIZE; nRead += ret)
+        {
+            tStart = SYS_TMR_SystemCountGet();
+            ret = wolfSSL_read(pBench->pSrv, pData + nRead, _APP_BENCH_TLS_RECORD_SIZE - nRead);
+            pBench->srvCount += SYS_TMR_SystemCountGet() - tStart;
+            if (ret <= 0)
+            {
+                pBench->error = wolfSSL_get_error(pBench->pSrv, ret);
+                failStep = "read";
+                break;
+            }
+        }
+    }
+
+    if (failStep != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: tls record failed: %s, error %d\r\n", failStep, pBench->error);
+    }
+    else
+    {
+        _APP_BenchRatePrint(pCmdIO, "write (encrypt)", (uint64_t)nIters * _APP_BENCH_TLS_RECORD_SIZE, pBench->cliCount);
+        _APP_BenchRatePrint(pCmdIO, "read (decrypt)", (uint64_t)nIters * _APP_BENCH_TLS_RECORD_SIZE, pBench->srvCount);
+    }
+
+    XFREE(pData, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    _APP_BenchTlsFree(pBench);
+}
+
+static uint32_t _APP_BenchUs(uint64_t sysCount)
+{
+    return (uint32_t)((sysCount * 1000000ull) / SYS_TMR_SystemCountFrequencyGet());
+}
+
+#if defined(WOLFSSL_MISSING_CA_CB)
+// test CAs added to the store roots for "cryptobench castore"
+// the first one issued serv_ecc_der_256, used for the first use time
+static const NET_PRES_CA_ROOT _APP_BenchTestRoots[] =
+{
+    {ca_ecc_cert_der_256, sizeof(ca_ecc_cert_der_256)},
+    {ca_ecc_cert_der_384, sizeof(ca_ecc_cert_der_384)},
+    {ca_cert_der_2048, sizeof(ca_cert_der_2048)},
+};
+
+// as NET_PRES_EncGlue_MissingCACb but accepts the expired test CAs
+static int _APP_BenchMissingCACb(const unsigned char* hash, int hashType, void* ctx)
+{
+    const uint8_t* certPtr;
+    int32_t certSize;
+
+    if (!NET_PRES_CertStoreFindCA(hash, hashType == WOLFSSL_CA_HASH_NAME, &certPtr, &certSize))
+    {
+        return 0;
+    }
+    return wolfSSL_CTX_load_verify_buffer_ex((WOLFSSL_CTX*)ctx, certPtr, certSize, SSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) == SSL_SUCCESS ? 1 : 0;
+}
+
+static uint32_t _APP_BenchHeapUsed(void)
+{
+    struct mallinfo heapInfo = mallinfo();
+    return heapInfo.uordblks;
+}
+
+// client context creation time and heap vs. the number of CA roots:
+// all the roots loaded up front vs. the lazy loading from the store index
+static void _APP_BenchCaStore(SYS_CMD_DEVICE_NODE* pCmdIO)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    const size_t nTestRoots = sizeof(_APP_BenchTestRoots) / sizeof(*_APP_BenchTestRoots);
+    const uint8_t zeroHash[WC_MAX_DIGEST_SIZE] = {0};
+    NET_PRES_CA_ROOT* pRoots;
+    size_t nRoots, nLoaded, ix, jx;
+    WOLFSSL_CTX* pCtx;
+    uint64_t tStart, eagerCount, lazyCount, indexCount, useCount;
+    uint32_t heapStart, eagerHeap, lazyHeap;
+    const uint8_t* certPtr;
+    int32_t certSize;
+    NET_PRES_CA_STORE_SAVE caSave;
+
+    nRoots = nTestRoots + NET_PRES_CertStoreGetCACount();
+    pRoots = (NET_PRES_CA_ROOT*)XMALLOC(nRoots * sizeof(*pRoots), NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if (pRoots == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "cryptobench: Failed to allocate memory\r\n");
+        return;
+    }
+    memcpy(pRoots, _APP_BenchTestRoots, sizeof(_APP_BenchTestRoots));
+    for (ix = nTestRoots; ix < nRoots; ix++)
+    {
+        NET_PRES_CertStoreGetCACerts(&pRoots[ix].certPtr, &pRoots[ix].certSize, ix - nTestRoots);
+    }
+    NET_PRES_CertStoreSaveCARoots(&caSave);
+
+    wolfSSL_Init();
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "cryptobench: client context creation, all roots loaded vs. lazy loading\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\troots: loaded us/bytes, lazy us/bytes, index build us, first use us\r\n");
+    for (ix = 1; ix <= nRoots; ix++)
+    {
+        heapStart = _APP_BenchHeapUsed();
+        tStart = SYS_TMR_SystemCountGet();
+        pCtx = wolfSSL_CTX_new(wolfSSLv23_client_method());
+        for (jx = 0, nLoaded = 0; pCtx != 0 && jx < ix; jx++)
+        {
+            if (wolfSSL_CTX_load_verify_buffer_ex(pCtx, pRoots[jx].certPtr, pRoots[jx].certSize, SSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) == SSL_SUCCESS)
+            {
+                nLoaded++;
+            }
+        }
+        eagerCount = SYS_TMR_SystemCountGet() - tStart;
+        eagerHeap = _APP_BenchHeapUsed() - heapStart;
+        wolfSSL_CTX_free(pCtx);
+
+        NET_PRES_CertStoreSetCARoots(pRoots, ix);
+        heapStart = _APP_BenchHeapUsed();
+        tStart = SYS_TMR_SystemCountGet();
+        pCtx = wolfSSL_CTX_new(wolfSSLv23_client_method());
+        if (pCtx != 0)
+        {
+            wolfSSL_CTX_SetMissingCA_Cb(pCtx, _APP_BenchMissingCACb);
+        }
+        lazyCount = SYS_TMR_SystemCountGet() - tStart;
+        lazyHeap = _APP_BenchHeapUsed() - heapStart;
+
+        // a miss builds the index
+        tStart = SYS_TMR_SystemCountGet();
+        NET_PRES_CertStoreFindCA(zeroHash, false, &certPtr, &certSize);
+        indexCount = SYS_TMR_SystemCountGet() - tStart;
+
+        // chain check that loads the issuer
+        tStart = SYS_TMR_SystemCountGet();
+        if (pCtx != 0)
+        {
+            wolfSSL_CertManagerVerifyBuffer(wolfSSL_CTX_GetCertManager(pCtx), serv_ecc_der_256, sizeof(serv_ecc_der_256), SSL_FILETYPE_ASN1);
+        }
+        useCount = SYS_TMR_SystemCountGet() - tStart;
+        wolfSSL_CTX_free(pCtx);
+
+        if (pCtx == 0 || nLoaded != ix)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: castore failed: %d of %d roots loaded\r\n", (int)nLoaded, (int)ix);
+            break;
+        }
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\t%d: %u/%u, %u/%u, %u, %u\r\n", (int)ix, _APP_BenchUs(eagerCount), eagerHeap,
+                _APP_BenchUs(lazyCount), lazyHeap, _APP_BenchUs(indexCount), _APP_BenchUs(useCount));
+    }
+
+    NET_PRES_CertStoreRestoreCARoots(&caSave);
+    wolfSSL_Cleanup();
+    XFREE(pRoots, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+}
+#endif  // defined(WOLFSSL_MISSING_CA_CB)
+
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+// client handshake time without and with the verified chain cache;
+// one handshake fills the cache, the timed ones then hit it
+static void _APP_BenchChainCache(SYS_CMD_DEVICE_NODE* pCmdIO, int nIters, bool eccCert)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    _APP_BENCH_TLS* pBench;
+    NET_PRES_CHAIN_CACHE_STATS statStart, statEnd;
+    uint64_t plainCount;
+    int ix;
+    const char* failStep;
+
+    if ((pBench = _APP_BenchTlsAlloc(pCmdIO)) == 0)
+    {
+        return;
+    }
+
+    failStep = _APP_BenchTlsInit(pBench, eccCert, 0);
+    for (ix = 0; ix < nIters && failStep == 0; ix++)
+    {
+        failStep = _APP_BenchTlsHandshake(pBench);
+        _APP_BenchTlsSessionFree(pBench);
+    }
+    plainCount = pBench->cliCount;
+
+    // the counters are shared with the real connections, report the difference
+    NET_PRES_EncGlue_ChainCacheStatsGet(&statStart, false);
+    if (failStep == 0)
+    {
+        wolfSSL_CTX_SetVerifiedChain_Cb(pBench->pCliCtx, NET_PRES_EncGlue_VerifiedChainCb);
+        failStep = _APP_BenchTlsHandshake(pBench);
+        _APP_BenchTlsSessionFree(pBench);
+    }
+    pBench->cliCount = 0;
+    for (ix = 0; ix < nIters && failStep == 0; ix++)
+    {
+        failStep = _APP_BenchTlsHandshake(pBench);
+        _APP_BenchTlsSessionFree(pBench);
+    }
+    NET_PRES_EncGlue_ChainCacheStatsGet(&statEnd, false);
+
+    if (failStep != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: chaincache failed: %s, error %d\r\n", failStep, pBench->error);
+    }
+    else
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: verified chain cache, %s certificate, %d handshakes\r\n", eccCert ? "P-256" : "RSA-2048", nIters);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tclient per handshake: %u us full verify, %u us cached chain\r\n",
+                _APP_BenchUs(plainCount) / nIters, _APP_BenchUs(pBench->cliCount) / nIters);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tlookups: %d, hits: %d, inserts: %d\r\n", statEnd.lookups - statStart.lookups,
+                statEnd.hits - statStart.hits, statEnd.inserts - statStart.inserts);
+    }
+
+    _APP_BenchTlsFree(pBench);
+}
+#endif  // defined(WOLFSSL_VERIFIED_CHAIN_CB)
+
+#if defined(HAVE_CRL) && defined(HAVE_ECC)
+#if !defined(APP_COMMANDS_BENCH_CRL_ENTRIES)
+#define APP_COMMANDS_BENCH_CRL_ENTRIES  2000    // largest CRL by default, about 80 bytes of heap per entry
+#endif
+#define _APP_BENCH_CRL_CHECKS           64      // timed look ups per CRL
+#define _APP_BENCH_CRL_ENTRY_SIZE       24      // DER size of a synthetic revoked entry
+
+static const uint8_t _APP_BenchEcdsaSha256[] = {0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02};
+// 1970 to 2049, valid whether the clock is set or not
+static const uint8_t _APP_BenchValidity[] =
+{
+    0x17, 0x0d, '7', '0', '0', '1', '0', '1', '0', '0', '0', '0', '0', '0', 'Z',
+    0x17, 0x0d, '4', '9', '1', '2', '3', '1', '2', '3', '5', '9', '5', '9', 'Z',
+};
+// serial of the checked certificate; the synthetic CRL serials start with 0x01
+static const uint8_t _APP_BenchCrlSerial[] = {0x02, 0x5a, 0xc3, 0x96, 0x0f};
+
+// writes a DER tag and length at p, if p is not 0; returns the header size
+static uint32_t _APP_BenchDerHdr(uint8_t* p, uint8_t tag, uint32_t len)
+{
+    uint32_t hdrSize = len < 0x80 ? 2 : len < 0x100 ? 3 : len < 0x10000 ? 4 : 5;
+    uint32_t ix;
+
+    if (p != 0)
+    {
+        p[0] = tag;
+        if (hdrSize == 2)
+        {
+            p[1] = (uint8_t)len;
+        }
+        else
+        {
+            p[1] = 0x80 | (hdrSize - 2);
+            for (ix = hdrSize - 1; ix >= 2; ix--, len >>= 8)
+            {
+                p[ix] = (uint8_t)len;
+            }
+        }
+    }
+    return hdrSize;
+}
+
+// returns the size of the DER element at p, *pHdrSize its header size
+static uint32_t _APP_BenchDerSize(const uint8_t* p, uint32_t* pHdrSize)
+{
+    uint32_t len = p[1];
+    uint32_t hdrSize = 2;
+    int nBytes;
+
+    if (len & 0x80)
+    {
+        for (nBytes = len & 0x7f, len = 0; nBytes != 0; nBytes--)
+        {
+            len = (len << 8) | p[hdrSize++];
+        }
+    }
+    *pHdrSize = hdrSize;
+    return hdrSize + len;
+}
+
+static uint8_t* _APP_BenchPut(uint8_t* p, const void* pData, uint32_t size)
+{
+    memcpy(p, pData, size);
+    return p + size;
+}
+
+// certificate issued under pName, with the serial the CRLs revoke;
+// the CRL look up does not check its signature
+static uint32_t _APP_BenchCrlCert(uint8_t* pCert, const uint8_t* pName, uint32_t nameSize, const uint8_t* pSpki, uint32_t spkiSize)
+{
+    static const uint8_t version[] = {0xa0, 0x03, 0x02, 0x01, 0x02};
+    static const uint8_t subject[] = {0x30, 0x0f, 0x31, 0x0d, 0x30, 0x0b, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x04, 'l', 'e', 'a', 'f'};
+    static const uint8_t signature[] = {0x03, 0x09, 0x00, 0x30, 0x06, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01};
+    uint32_t tbsSize = sizeof(version) + 2 + sizeof(_APP_BenchCrlSerial) + sizeof(_APP_BenchEcdsaSha256) + nameSize +
+                       2 + sizeof(_APP_BenchValidity) + sizeof(subject) + spkiSize;
+    uint32_t tbsHdrSize = _APP_BenchDerHdr(0, 0x30, tbsSize);
+    uint8_t* p = pCert;
+
+    p += _APP_BenchDerHdr(p, 0x30, tbsHdrSize + tbsSize + sizeof(_APP_BenchEcdsaSha256) + sizeof(signature));
+    p += _APP_BenchDerHdr(p, 0x30, tbsSize);
+    p = _APP_BenchPut(p, version, sizeof(version));
+    p += _APP_BenchDerHdr(p, 0x02, sizeof(_APP_BenchCrlSerial));
+    p = _APP_BenchPut(p, _APP_BenchCrlSerial, sizeof(_APP_BenchCrlSerial));
+    p = _APP_BenchPut(p, _APP_BenchEcdsaSha256, sizeof(_APP_BenchEcdsaSha256));
+    p = _APP_BenchPut(p, pName, nameSize);
+    p += _APP_BenchDerHdr(p, 0x30, sizeof(_APP_BenchValidity));
+    p = _APP_BenchPut(p, _APP_BenchValidity, sizeof(_APP_BenchValidity));
+    p = _APP_BenchPut(p, subject, sizeof(subject));
+    p = _APP_BenchPut(p, pSpki, spkiSize);
+    p = _APP_BenchPut(p, _APP_BenchEcdsaSha256, sizeof(_APP_BenchEcdsaSha256));
+    p = _APP_BenchPut(p, signature, sizeof(signature));
+    return p - pCert;
+}
+
+// CRL of pName with nEntries synthetic serials, signed with pKey;
+// if revoked, the checked certificate is the first entry, the last one wolfSSL keeps on its list
+// returns the allocated buffer, *ppCrl and *pCrlSize the CRL in it
+static uint8_t* _APP_BenchCrlMake(const uint8_t* pName, uint32_t nameSize, int nEntries, bool revoked, ecc_key* pKey, WC_RNG* pRng,
+                                  uint8_t** ppCrl, uint32_t* pCrlSize)
+{
+    static const uint8_t version[] = {0x02, 0x01, 0x01};
+    uint32_t listSize = (nEntries + (revoked ? 1 : 0)) * _APP_BENCH_CRL_ENTRY_SIZE;
+    uint32_t tbsSize = sizeof(version) + sizeof(_APP_BenchEcdsaSha256) + nameSize + sizeof(_APP_BenchValidity) +
+                       _APP_BenchDerHdr(0, 0x30, listSize) + listSize;
+    uint8_t digest[WC_SHA256_DIGEST_SIZE];
+    uint8_t sig[ECC_MAX_SIG_SIZE];
+    word32 sigSize = sizeof(sig);
+    uint32_t serial, outerSize, hdrSize;
+    uint8_t* pBuff;
+    uint8_t* pTbs;
+    uint8_t* p;
+    int ix;
+
+    // room for the largest outer header in front
+    pBuff = (uint8_t*)XMALLOC(5 + 5 + tbsSize + sizeof(_APP_BenchEcdsaSha256) + 3 + sizeof(sig), NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if (pBuff == 0)
+    {
+        return 0;
+    }
+
+    p = pTbs = pBuff + 5;
+    p += _APP_BenchDerHdr(p, 0x30, tbsSize);
+    p = _APP_BenchPut(p, version, sizeof(version));
+    p = _APP_BenchPut(p, _APP_BenchEcdsaSha256, sizeof(_APP_BenchEcdsaSha256));
+    p = _APP_BenchPut(p, pName, nameSize);
+    p = _APP_BenchPut(p, _APP_BenchValidity, sizeof(_APP_BenchValidity));
+    p += _APP_BenchDerHdr(p, 0x30, listSize);
+    for (ix = revoked ? -1 : 0; ix < nEntries; ix++)
+    {
+        *p++ = 0x30;
+        *p++ = _APP_BENCH_CRL_ENTRY_SIZE - 2;
+        *p++ = 0x02;
+        *p++ = sizeof(_APP_BenchCrlSerial);
+        if (ix < 0)
+        {
+            p = _APP_BenchPut(p, _APP_BenchCrlSerial, sizeof(_APP_BenchCrlSerial));
+        }
+        else
+        {   // odd multiplier: distinct serials, in no particular order
+            serial = (uint32_t)ix * 2654435761u;
+            *p++ = 0x01;
+            *p++ = (uint8_t)(serial >> 24);
+            *p++ = (uint8_t)(serial >> 16);
+            *p++ = (uint8_t)(serial >> 8);
+            *p++ = (uint8_t)serial;
+        }
+        p = _APP_BenchPut(p, _APP_BenchValidity, 15);   // revocation date
+    }
+
+    if (wc_Sha256Hash(pTbs, p - pTbs, digest) != 0 || wc_ecc_sign_hash(digest, sizeof(digest), sig, &sigSize, pRng, pKey) != 0)
+    {
+        XFREE(pBuff, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        return 0;
+    }
+    p = _APP_BenchPut(p, _APP_BenchEcdsaSha256, sizeof(_APP_BenchEcdsaSha256));
+    p += _APP_BenchDerHdr(p, 0x03, sigSize + 1);
+    *p++ = 0;
+    p = _APP_BenchPut(p, sig, sigSize);
+
+    outerSize = p - pTbs;
+    hdrSize = _APP_BenchDerHdr(0, 0x30, outerSize);
+    _APP_BenchDerHdr(pTbs - hdrSize, 0x30, outerSize);
+    *ppCrl = pTbs - hdrSize;
+    *pCrlSize = hdrSize + outerSize;
+    return pBuff;
+}
+
+// CRL load and revocation check time vs. the number of revoked entries,
+// synthetic CRLs signed by the test P-256 CA
+static void _APP_BenchCrl(SYS_CMD_DEVICE_NODE* pCmdIO, int maxEntries)
+{
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    WOLFSSL_CTX* pCtx;
+    WOLFSSL_CERT_MANAGER* pCm;
+    WC_RNG rng;
+    ecc_key key;
+    uint8_t cert[400];
+    uint32_t certSize, hdrSize, nameSize, spkiSize, crlSize;
+    const uint8_t* pName;
+    const uint8_t* p;
+    uint8_t* pBuff;
+    uint8_t* pCrl;
+    uint64_t tStart, loadCount, checkCount[2];
+    word32 keyIdx = 0;
+    int nEntries, ix, ret, revoked;
+    const char* failStep = 0;
+
+    // the CA subject name and public key info
+    p = ca_ecc_cert_der_256;
+    _APP_BenchDerSize(p, &hdrSize);
+    p += hdrSize;
+    _APP_BenchDerSize(p, &hdrSize);
+    p += hdrSize;
+    for (ix = 0; ix < 5; ix++)
+    {   // version, serial, signature, issuer, validity
+        p += _APP_BenchDerSize(p, &hdrSize);
+    }
+    pName = p;
+    nameSize = _APP_BenchDerSize(p, &hdrSize);
+    spkiSize = _APP_BenchDerSize(p + nameSize, &hdrSize);
+    if (nameSize + spkiSize + 100 > sizeof(cert))
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "cryptobench: crl failed: CA certificate too large\r\n");
+        return;
+    }
+    certSize = _APP_BenchCrlCert(cert, pName, nameSize, p + nameSize, spkiSize);
+
+    wolfSSL_Init();
+    pCtx = wolfSSL_CTX_new(wolfSSLv23_client_method());
+    wc_InitRng(&rng);
+    wc_ecc_init(&key);
+    if (pCtx == 0 || wolfSSL_CTX_load_verify_buffer_ex(pCtx, ca_ecc_cert_der_256, sizeof(ca_ecc_cert_der_256), SSL_FILETYPE_ASN1, 0, WOLFSSL_LOAD_FLAG_DATE_ERR_OKAY) != SSL_SUCCESS ||
+        wc_EccPrivateKeyDecode(ca_ecc_key_der_256, &keyIdx, &key, sizeof(ca_ecc_key_der_256)) != 0)
+    {
+        failStep = "CA";
+    }
+    pCm = pCtx != 0 ? wolfSSL_CTX_GetCertManager(pCtx) : 0;
+
+    if (failStep == 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: CRL revocation check, %d checks per CRL\r\n", _APP_BENCH_CRL_CHECKS);
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tentries: load us, check us revoked/not revoked\r\n");
+    }
+    for (nEntries = 10; failStep == 0; nEntries *= 10)
+    {
+        if (nEntries > maxEntries)
+        {
+            nEntries = maxEntries;
+        }
+        for (revoked = 1; revoked >= 0 && failStep == 0; revoked--)
+        {
+            pBuff = _APP_BenchCrlMake(pName, nameSize, nEntries, revoked != 0, &key, &rng, &pCrl, &crlSize);
+            if (pBuff == 0)
+            {
+                failStep = "CRL memory";
+                break;
+            }
+            wolfSSL_CertManagerEnableCRL(pCm, 0);
+            tStart = SYS_TMR_SystemCountGet();
+            ret = wolfSSL_CertManagerLoadCRLBuffer(pCm, pCrl, crlSize, SSL_FILETYPE_ASN1);
+            loadCount = SYS_TMR_SystemCountGet() - tStart;
+            XFREE(pBuff, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+            if (ret != SSL_SUCCESS)
+            {
+                failStep = "CRL load";
+                break;
+            }
+
+            tStart = SYS_TMR_SystemCountGet();
+            for (ix = 0; ix < _APP_BENCH_CRL_CHECKS; ix++)
+            {
+                ret = wolfSSL_CertManagerCheckCRL(pCm, cert, certSize);
+            }
+            checkCount[revoked] = SYS_TMR_SystemCountGet() - tStart;
+            if (ret != (revoked ? CRL_CERT_REVOKED : SSL_SUCCESS))
+            {
+                failStep = "check result";
+            }
+            wolfSSL_CertManagerFreeCRL(pCm);
+        }
+        if (failStep == 0)
+        {
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "\t%d: %u, %u/%u\r\n", nEntries, _APP_BenchUs(loadCount),
+                    _APP_BenchUs(checkCount[1]) / _APP_BENCH_CRL_CHECKS, _APP_BenchUs(checkCount[0]) / _APP_BENCH_CRL_CHECKS);
+        }
+        if (nEntries == maxEntries)
+        {
+            break;
+        }
+    }
+
+    if (failStep != 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "cryptobench: crl failed: %s, error %d\r\n", failStep, ret);
+    }
+    wc_ecc_free(&key);
+    wc_FreeRng(&rng);
+    wolfSSL_CTX_free(pCtx);
+    wolfSSL_Cleanup();
+}
+#endif  // defined(HAVE_CRL) && defined(HAVE_ECC)
+
+// AEAD suites compared by "cryptobench suites"
+static const char* _APP_BenchSuites[] =
+{
+#if defined(WOLFSSL_TLS13)
+    "TLS13-AES128-GCM-SHA256",
+    "TLS13-AES256-GCM-SHA384",
+#if defined(HAVE_CHACHA) && defined(HAVE_POLY1305)
+    "TLS13-CHACHA20-POLY1305-SHA256",
+#endif
+#endif  // defined(WOLFSSL_TLS13)
+    "ECDHE-ECDSA-AES128-GCM-SHA256",
+    "ECDHE-ECDSA-AES256-GCM-SHA384",
+#if defined(HAVE_CHACHA) && defined(HAVE_POLY1305)
+    "ECDHE-ECDSA-CHACHA20-POLY1305",
+#endif
+};
+
+// record layer throughput of each suite in turn
+static void _APP_BenchTlsSuites(SYS_CMD_DEVICE_NODE* pCmdIO, int nIters)
+{
+    int ix;
+
+    for (ix = 0; ix < sizeof(_APP_BenchSuites) / sizeof(*_APP_BenchSuites); ix++)
+    {
+        _APP_BenchTlsRecord(pCmdIO, nIters, _APP_BenchSuites[ix]);
+    }
+}
+
+static void _APP_Commands_CryptoBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // cryptobench <test> <iterations>
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+    int nIters = argc > 2 ? atoi(argv[2]) : 0;
+
+    if (argc >= 2 && strcmp(argv[1], "ecc") == 0)
+    {
+        _APP_BenchEcc(pCmdIO, nIters > 0 ? nIters : 10);
+        return;
+    }
+    if (argc >= 2 && (strcmp(argv[1], "tlsrsa") == 0 || strcmp(argv[1], "tlsecc") == 0))
+    {
+        _APP_BenchTls(pCmdIO, nIters > 0 ? nIters : 4, strcmp(argv[1], "tlsecc") == 0);
+        return;
+    }
+    if (argc >= 2 && strcmp(argv[1], "tlsrec") == 0)
+    {
+        _APP_BenchTlsRecord(pCmdIO, nIters > 0 ? nIters : 64, argc > 3 ? argv[3] : 0);
+        return;
+    }
+    if (argc >= 2 && strcmp(argv[1], "suites") == 0)
+    {
+        _APP_BenchTlsSuites(pCmdIO, nIters > 0 ? nIters : 64);
+        return;
+    }
+#if defined(WOLFSSL_MISSING_CA_CB)
+    if (argc >= 2 && strcmp(argv[1], "castore") == 0)
+    {
+        _APP_BenchCaStore(pCmdIO);
+        return;
+    }
+#endif
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+    if (argc >= 2 && (strcmp(argv[1], "chainrsa") == 0 || strcmp(argv[1], "chainecc") == 0))
+    {
+        _APP_BenchChainCache(pCmdIO, nIters > 0 ? nIters : 4, strcmp(argv[1], "chainecc") == 0);
+        return;
+    }
+#endif
+#if defined(HAVE_CRL) && defined(HAVE_ECC)
+    if (argc >= 2 && strcmp(argv[1], "crl") == 0)
+    {
+        _APP_BenchCrl(pCmdIO, nIters > 0 ? nIters : APP_COMMANDS_BENCH_CRL_ENTRIES);
+        return;
+    }
+#endif
+
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: cryptobench <test> <iterations>\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tecc - P-256 key generation vs generic k*G, default 10 iterations\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\ttlsrsa, tlsecc - loopback handshake with an RSA-2048/P-256 server certificate, default 4 iterations\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\ttlsrec - 16 KB record encrypt/decrypt over a loopback connection, default 64 records\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\t         cryptobench tlsrec <records> <cipher list>\r\n");
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tsuites - tlsrec for each AES-GCM and ChaCha20-Poly1305 suite, default 64 records\r\n");
+#if defined(WOLFSSL_MISSING_CA_CB)
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tcastore - client context creation time and heap vs. the number of CA roots\r\n");
+#endif
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tchainrsa, chainecc - loopback handshake without/with the verified chain cache, default 4 iterations\r\n");
+#endif
+#if defined(HAVE_CRL) && defined(HAVE_ECC)
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\tcrl - CRL load and revocation check vs. the number of entries, 10 up to <iterations> entries\r\n");
+#endif
+}
+#endif  // (APP_COMMANDS_BENCH_ENABLE != 0)
+
 
 #endif
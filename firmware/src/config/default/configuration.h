@@ -153,6 +153,9 @@ extern "C" {
 #define TCPIP_DNS_CLIENT_CACHE_PER_IPV6_ADDRESS		1
 #define TCPIP_DNS_CLIENT_ADDRESS_TYPE			    IP_ADDRESS_TYPE_IPV4
 #define TCPIP_DNS_CLIENT_CACHE_DEFAULT_TTL_VAL		1200
+#define TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT		80
+#define TCPIP_DNS_CLIENT_CACHE_NEGATIVE_TTL_MAX		300
+#define TCPIP_DNS_CLIENT_CACHE_SERVER_FAIL_TMO		30
 #define TCPIP_DNS_CLIENT_CACHE_UNSOLVED_ENTRY_TMO	10
 #define TCPIP_DNS_CLIENT_LOOKUP_RETRY_TMO			5
 #define TCPIP_DNS_CLIENT_MAX_HOSTNAME_LEN			64
@@ -168,6 +171,7 @@ extern "C" {
 #define TCPIP_STACK_USE_ICMP_CLIENT
 #define TCPIP_ICMP_CLIENT_USER_NOTIFICATION   true
 #define TCPIP_ICMP_ECHO_REQUEST_TIMEOUT        500
+#define TCPIP_ICMP_MAX_ECHO_REQUESTS           16
 #define TCPIP_ICMP_TASK_TICK_RATE              33
 #define TCPIP_ICMP_COMMAND_ENABLE              true
 #define TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUESTS         4
@@ -175,6 +179,8 @@ extern "C" {
 #define TCPIP_STACK_COMMANDS_ICMP_ECHO_TIMEOUT          5000
 #define TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_BUFF_SIZE    2000
 #define TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_DATA_SIZE    100
+#define TCPIP_STACK_COMMANDS_ICMP_ECHO_WINDOW               8
+#define TCPIP_STACK_COMMANDS_BENCH_ENABLE               1
 
 /*** TCPIP MAC Configuration ***/
 #define TCPIP_EMAC_TX_DESCRIPTORS				    8
@@ -226,7 +232,12 @@ extern "C" {
 #define WOLFSSL_DER_LOAD
 #define KEEP_OUR_CERT
 #define KEEP_PEER_CERT
+#define HAVE_CRL
 #define HAVE_CRL_IO
+#define HAVE_OCSP
+#define HAVE_CERTIFICATE_STATUS_REQUEST
+#define HAVE_CERTIFICATE_STATUS_REQUEST_V2
+#define OCSP_CACHE_MAX_STATUS 16
 #define HAVE_IO_TIMEOUT
 #define TFM_NO_ASM
 #define WOLFSSL_NO_ASM
@@ -242,6 +253,10 @@ extern "C" {
 #define WOLFSSL_DTLS
 #define HAVE_TLS_EXTENSIONS
 #define WOLFSSL_TLS13
+#define HAVE_SESSION_TICKET
+#define WOLFSSL_EARLY_DATA
+#define SMALL_SESSION_CACHE
+#define WOLFSSL_READ_AHEAD
 #define HAVE_SUPPORTED_CURVES
 #define WOLFSSL_SMALL_STACK
 #define NO_ERROR_STRINGS
@@ -290,11 +305,12 @@ extern "C" {
 
 
 /*** ARP Configuration ***/
-#define TCPIP_ARP_CACHE_ENTRIES                 		5
+#define TCPIP_ARP_CACHE_ENTRIES                 		32
 #define TCPIP_ARP_CACHE_DELETE_OLD		        	true
 #define TCPIP_ARP_CACHE_SOLVED_ENTRY_TMO			1200
 #define TCPIP_ARP_CACHE_PENDING_ENTRY_TMO			60
 #define TCPIP_ARP_CACHE_PENDING_RETRY_TMO			2
+#define TCPIP_ARP_CACHE_REFRESH_TMO			    60
 #define TCPIP_ARP_CACHE_PERMANENT_QUOTA		    		50
 #define TCPIP_ARP_CACHE_PURGE_THRESHOLD		    		75
 #define TCPIP_ARP_CACHE_PURGE_QUANTA		    		1
@@ -350,12 +366,15 @@ extern "C" {
 
 /*** IPv4 Configuration ***/
 #define TCPIP_IPV4_ARP_SLOTS                        10
+#define TCPIP_IPV4_ARP_SLOTS_MAX                    40
 #define TCPIP_IPV4_EXTERN_PACKET_PROCESS   false
 
 #define TCPIP_IPV4_COMMANDS true
 
 #define TCPIP_IPV4_FORWARDING_ENABLE    false 
 
+#define TCPIP_IPV4_TX_BATCH_SIZE        8
+
 
 
 
@@ -399,6 +418,13 @@ extern "C" {
 
 #define TCPIP_PACKET_LOG_ENABLE     0
 
+#define TCPIP_PACKET_TRACE_RING_ENABLE      1
+#define TCPIP_PACKET_TRACE_RING_ENTRIES     64
+#define TCPIP_PACKET_TRACE_RING_SNAP_LEN    128
+
+#define TCPIP_STACK_STATISTICS_ENABLE       1
+#define TCPIP_STACK_RX_BATCH_SIZE           8
+
 /* TCP/IP stack event notification */
 #define TCPIP_STACK_USE_EVENT_NOTIFICATION
 #define TCPIP_STACK_USER_NOTIFICATION   true
@@ -430,6 +456,9 @@ extern "C" {
 #define TCPIP_NTP_FAST_QUERY_INTERVAL	    	14
 #define TCPIP_NTP_TASK_TICK_RATE				1100
 #define TCPIP_NTP_RX_QUEUE_LIMIT				2
+#define TCPIP_NTP_SAMPLES				        4
+#define TCPIP_NTP_MAX_SERVERS				    4
+#define TCPIP_NTP_STEP_THRESHOLD				128
 
 
 
@@ -438,7 +467,9 @@ extern "C" {
 #define TCPIP_UDP_SOCKET_DEFAULT_TX_SIZE		    	512
 #define TCPIP_UDP_SOCKET_DEFAULT_TX_QUEUE_LIMIT    	 	3
 #define TCPIP_UDP_SOCKET_DEFAULT_RX_QUEUE_LIMIT			3
-#define TCPIP_UDP_USE_POOL_BUFFERS   false
+#define TCPIP_UDP_USE_POOL_BUFFERS   true
+#define TCPIP_UDP_SOCKET_POOL_BUFFERS		        	4
+#define TCPIP_UDP_SOCKET_POOL_BUFFER_SIZE		    	512
 #define TCPIP_UDP_USE_TX_CHECKSUM             			true
 #define TCPIP_UDP_USE_RX_CHECKSUM             			true
 #define TCPIP_UDP_COMMANDS   false
@@ -493,15 +524,30 @@ extern "C" {
 #define HAVE_AES_CBC
 #define WOLFSSL_AES_COUNTER
 #define HAVE_AESGCM
+#define GCM_TABLE_4BIT
 #define HAVE_AESCCM
+#define HAVE_CHACHA
+#define HAVE_POLY1305
+#define HAVE_ONE_TIME_AUTH
+#define WOLFSSL_POLY1305_RADIX32
 #define NO_RC4
 #define NO_HC128
 #define NO_RABBIT
 #define HAVE_ECC
 #define HAVE_ECC_ENCRYPT
+#define WOLFSSL_ECC_P256_COMB
+#define WOLFSSL_MISSING_CA_CB
+#define WOLFSSL_VERIFIED_CHAIN_CB
+#define WOLFSSL_CRL_INDEX
 #define HAVE_DH
 #define NO_DSA
 #define FP_MAX_BITS 16384
+// single precision math for RSA-2048/3072, DH-2048/3072 and P-256;
+// other key sizes fall back to the fast math above
+#define WOLFSSL_SP
+#define WOLFSSL_HAVE_SP_RSA
+#define WOLFSSL_HAVE_SP_DH
+#define WOLFSSL_HAVE_SP_ECC
 #define USE_CERT_BUFFERS_2048
 #define WC_RSA_PSS
 #define NO_DEV_RANDOM
@@ -519,6 +565,28 @@ extern "C" {
 /* MPLAB Harmony Net Presentation Layer Definitions*/
 #define NET_PRES_NUM_INSTANCE 1
 #define NET_PRES_NUM_SOCKETS 10
+#define NET_PRES_ENC_HANDSHAKE_SLICE_US 20000
+#define NET_PRES_CA_STORE_MAX_ROOTS 64
+#define NET_PRES_ENC_CHAIN_CACHE_ENTRIES 8
+#define NET_PRES_ENC_CHAIN_CACHE_LIFETIME_S 3600
+#define NET_PRES_EARLY_DATA_SIZE 128
+// client cipher suites, most preferred first; no AES acceleration on this
+// core, so ChaCha20-Poly1305 goes ahead of AES-GCM
+#define NET_PRES_ENC_CIPHER_LIST "TLS13-CHACHA20-POLY1305-SHA256:" \
+                                 "TLS13-AES128-GCM-SHA256:" \
+                                 "TLS13-AES256-GCM-SHA384:" \
+                                 "ECDHE-ECDSA-CHACHA20-POLY1305:" \
+                                 "ECDHE-RSA-CHACHA20-POLY1305:" \
+                                 "DHE-RSA-CHACHA20-POLY1305:" \
+                                 "ECDHE-ECDSA-AES128-GCM-SHA256:" \
+                                 "ECDHE-RSA-AES128-GCM-SHA256:" \
+                                 "ECDHE-ECDSA-AES256-GCM-SHA384:" \
+                                 "ECDHE-RSA-AES256-GCM-SHA384:" \
+                                 "DHE-RSA-AES128-GCM-SHA256:" \
+                                 "ECDHE-ECDSA-AES128-SHA256:" \
+                                 "ECDHE-RSA-AES128-SHA256:" \
+                                 "AES128-GCM-SHA256:" \
+                                 "AES128-SHA256"
 
 
 
@@ -533,6 +601,8 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+#define APP_COMMANDS_BENCH_ENABLE               1
+
 
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
@@ -70,6 +70,9 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 //
 #define _TCPIP_EMAC_QUANTA_PAUSE_BYTES      64  // mimimum flow control quanta PTV 
 
+// max number of packets handed over to the hw in one go
+#define _DRV_ETHMAC_TX_BATCH_SIZE           8
+
 typedef enum
 {
     DRV_ETHMAC_ADDBUFF_FLAG_NONE         = 0x0000,       // default value
@@ -92,10 +95,11 @@ static void     _MACCleanup(DRV_ETHMAC_INSTANCE_DCPT* pMacD );
 
 static void     _MACDeinit(DRV_ETHMAC_INSTANCE_DCPT* pMacD );
 
-static TCPIP_MAC_RES    _MACTxPacket(DRV_ETHMAC_INSTANCE_DCPT* pMacD, TCPIP_MAC_PACKET * ptrPacket);
+static TCPIP_MAC_RES    _MACTxPacketList(DRV_ETHMAC_INSTANCE_DCPT* pMacD, TCPIP_MAC_PACKET** pktTbl, int nPkts, int* pnSched);
 static void             _MACTxAcknowledgeEth(DRV_ETHMAC_INSTANCE_DCPT* pMacD);
 static void             _MACTxPacketAckCallback(void* pPktBuff, int buffIx, void* fParam);
 static TCPIP_MAC_RES    _MacTxPendingPackets(DRV_ETHMAC_INSTANCE_DCPT* pMacD);
+static void             _MACTxChainUnqueue(TCPIP_MAC_PACKET * ptrPacket);
 
 static void             _MacTxDiscardQueues(DRV_ETHMAC_INSTANCE_DCPT* pMacD, TCPIP_MAC_PKT_ACK_RES ackRes);
 
@@ -823,11 +827,25 @@ void DRV_ETHMAC_PIC32MACClose( DRV_HANDLE hMac )
  * TX functions
  ***********************************************/
 
+// clears the queued flag of the chain packets that were not scheduled
+// so that the caller can acknowledge them
+static void _MACTxChainUnqueue(TCPIP_MAC_PACKET * ptrPacket)
+{
+    while(ptrPacket)
+    {
+        ptrPacket->pktFlags &= ~TCPIP_MAC_PKT_FLAG_QUEUED;
+        ptrPacket = ptrPacket->next;
+    }
+}
+
 TCPIP_MAC_RES DRV_ETHMAC_PIC32MACPacketTx(DRV_HANDLE hMac, TCPIP_MAC_PACKET * ptrPacket)
 {
     TCPIP_MAC_RES       macRes;
     TCPIP_MAC_PACKET*   pPkt;
+    TCPIP_MAC_PACKET*   pNext;
     TCPIP_MAC_DATA_SEGMENT* pSeg;
+    TCPIP_MAC_PACKET*   pktTbl[_DRV_ETHMAC_TX_BATCH_SIZE];
+    int                 nPkts, nSched;
     DRV_ETHMAC_INSTANCE_DCPT* pMacD = (DRV_ETHMAC_INSTANCE_DCPT*)hMac;
 
     _DRV_ETHMAC_TxLock(pMacD);
@@ -845,7 +863,8 @@ TCPIP_MAC_RES DRV_ETHMAC_PIC32MACPacketTx(DRV_HANDLE hMac, TCPIP_MAC_PACKET * pt
     {
         pSeg = pPkt->pDSeg;
         if(pSeg == 0 || pSeg->segLoadOffset < pMacD->mData._segLoadOffset)
-        {   // cannot send this packet
+        {   // cannot send this packet; none of the chain is scheduled
+            _MACTxChainUnqueue(ptrPacket);
             _DRV_ETHMAC_TxUnlock(pMacD);
             return TCPIP_MAC_RES_PACKET_ERR;
         }
@@ -855,30 +874,41 @@ TCPIP_MAC_RES DRV_ETHMAC_PIC32MACPacketTx(DRV_HANDLE hMac, TCPIP_MAC_PACKET * pt
 
     while(ptrPacket && macRes == TCPIP_MAC_RES_OK)
     {   // can schedule some packets
-        // set the queue flag; avoid race condition if MACTx is really fast;
-        ptrPacket->pktFlags |= TCPIP_MAC_PKT_FLAG_QUEUED;
-        macRes = _MACTxPacket(pMacD, ptrPacket);
+        // hand them to the hw in batches: one descriptor hand over and TX start per batch
+        for(nPkts = 0; ptrPacket != 0 && nPkts < _DRV_ETHMAC_TX_BATCH_SIZE; ptrPacket = ptrPacket->next)
+        {   // set the queue flag; avoid race condition if MACTx is really fast;
+            ptrPacket->pktFlags |= TCPIP_MAC_PKT_FLAG_QUEUED;
+            pktTbl[nPkts++] = ptrPacket;
+        }
+
+        macRes = _MACTxPacketList(pMacD, pktTbl, nPkts, &nSched);
         
         if(macRes == TCPIP_MAC_RES_PACKET_ERR)
-        {   // no longer in our queue
-            ptrPacket->pktFlags &= ~TCPIP_MAC_PKT_FLAG_QUEUED;
+        {   // failed packet and the rest of the chain no longer in our queue
+            while(nSched < nPkts)
+            {
+                pktTbl[nSched++]->pktFlags &= ~TCPIP_MAC_PKT_FLAG_QUEUED;
+            }
+            _MACTxChainUnqueue(ptrPacket);
             _DRV_ETHMAC_TxUnlock(pMacD);
             return TCPIP_MAC_RES_PACKET_ERR;
         }
 
         if(macRes == TCPIP_MAC_RES_PENDING)
         {   // no more room into the hw queue
+            // restart from the 1st packet not scheduled
+            ptrPacket = pktTbl[nSched];
             break;
         }
-        ptrPacket = ptrPacket->next;
     }
 
     // queue what's left
     while(ptrPacket)
     {
+        pNext = ptrPacket->next;    // the list add clears it
         DRV_ETHMAC_SingleListTailAdd(&pMacD->mData._TxQueue, (DRV_ETHMAC_SGL_LIST_NODE*)ptrPacket);
         ptrPacket->pktFlags |= TCPIP_MAC_PKT_FLAG_QUEUED;
-        ptrPacket = ptrPacket->next;
+        ptrPacket = pNext;
     }
 
     _DRV_ETHMAC_TxUnlock(pMacD);
@@ -1543,12 +1573,21 @@ TCPIP_MAC_RES DRV_ETHMAC_PIC32MACParametersGet(DRV_HANDLE hMac, TCPIP_MAC_PARAME
  * local functions and helpers
  ***********************************************/
 
-static TCPIP_MAC_RES _MACTxPacket(DRV_ETHMAC_INSTANCE_DCPT* pMacD, TCPIP_MAC_PACKET * ptrPacket)
+// schedules nPkts (<= _DRV_ETHMAC_TX_BATCH_SIZE) packets for transmission
+// *pnSched is updated with the number of packets that were scheduled
+// the return value applies to the packet pktTbl[*pnSched]
+static TCPIP_MAC_RES _MACTxPacketList(DRV_ETHMAC_INSTANCE_DCPT* pMacD, TCPIP_MAC_PACKET** pktTbl, int nPkts, int* pnSched)
 {
     DRV_ETHMAC_RESULT ethRes;
+    const DRV_ETHMAC_PKT_DCPT* dcptTbl[_DRV_ETHMAC_TX_BATCH_SIZE];
+    int ix;
 
     // Note: the TCPIP_MAC_DATA_SEGMENT is defined to be a perfect match for DRV_ETHMAC_PKT_DCPT !!!
-    ethRes = DRV_ETHMAC_LibTxSendPacket(pMacD, (const DRV_ETHMAC_PKT_DCPT*)ptrPacket->pDSeg);
+    for(ix = 0; ix < nPkts; ix++)
+    {
+        dcptTbl[ix] = (const DRV_ETHMAC_PKT_DCPT*)pktTbl[ix]->pDSeg;
+    }
+    ethRes = DRV_ETHMAC_LibTxSendPacketList(pMacD, dcptTbl, nPkts, pnSched);
 
     if(ethRes == DRV_ETHMAC_RES_OK)
     {
@@ -1597,6 +1636,8 @@ static TCPIP_MAC_RES _MacTxPendingPackets(DRV_ETHMAC_INSTANCE_DCPT* pMacD)
 {
     TCPIP_MAC_PACKET* pPkt;
     TCPIP_MAC_RES     pktRes;
+    TCPIP_MAC_PACKET* pktTbl[_DRV_ETHMAC_TX_BATCH_SIZE];
+    int               nPkts, nSched;
 
     if(pMacD->mData._macFlags._linkPrev == false)
     {   // discard the TX queues
@@ -1606,18 +1647,30 @@ static TCPIP_MAC_RES _MacTxPendingPackets(DRV_ETHMAC_INSTANCE_DCPT* pMacD)
     }
 
 
-    while( (pPkt = (TCPIP_MAC_PACKET*)(pMacD->mData._TxQueue.head)) != 0)
+    while(pMacD->mData._TxQueue.head != 0)
     {
-        pktRes = _MACTxPacket(pMacD, pPkt);
+        // schedule a batch from the queue head
+        for(nPkts = 0, pPkt = (TCPIP_MAC_PACKET*)pMacD->mData._TxQueue.head; pPkt != 0 && nPkts < _DRV_ETHMAC_TX_BATCH_SIZE; pPkt = pPkt->next)
+        {
+            pktTbl[nPkts++] = pPkt;
+        }
+
+        pktRes = _MACTxPacketList(pMacD, pktTbl, nPkts, &nSched);
+
+        // the scheduled packets are out of the queue
+        while(nSched--)
+        {
+            DRV_ETHMAC_SingleListHeadRemove(&pMacD->mData._TxQueue);
+        }
+
         if(pktRes == TCPIP_MAC_RES_PENDING)
         {   // not enough room in the hw queue
             return TCPIP_MAC_RES_PENDING;
         }
 
-        // on way or another we're done with this packet
-        DRV_ETHMAC_SingleListHeadRemove(&pMacD->mData._TxQueue);
         if(pktRes != TCPIP_MAC_RES_OK)
-        {   // not transmitted
+        {   // not transmitted; on way or another we're done with this packet
+            pPkt = (TCPIP_MAC_PACKET*)DRV_ETHMAC_SingleListHeadRemove(&pMacD->mData._TxQueue);
             (*pMacD->mData.pktAckF)(pPkt, TCPIP_MAC_PKT_ACK_BUFFER_ERR, TCPIP_THIS_MODULE_ID);
         }
     }
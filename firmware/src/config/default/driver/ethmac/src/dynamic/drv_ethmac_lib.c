@@ -599,6 +599,37 @@ static DRV_ETHMAC_RESULT _EthTxSchedBuffer(DRV_ETHMAC_INSTANCE_DCPT* pMacD, cons
 } //_EthTxSchedBuffer
 
 
+/****************************************************************************
+ * Function:        _EthTxKickList
+ *
+ * PreCondition:    pList - valid, not empty, SOP/EOP already marked
+ *
+ * Input:           pList   - list of descriptors for one or more packets
+ *
+ * Output:          None
+ *
+ * Side Effects:    None
+ *
+ * Overview:        This function hands over the list to the hw and starts the transmission.
+ *                  The hw ownership of the whole list is passed with a single write.
+ *
+ * Note:            None
+ *****************************************************************************/
+static void _EthTxKickList(DRV_ETHMAC_INSTANCE_DCPT* pMacD, DRV_ETHMAC_DCPT_LIST* pList)
+{
+    DRV_ETHERNET_REGISTERS* ethId = pMacD->mData.pEthReg;
+
+    _EthAppendBusyList(pMacD, pMacD->mData._EnetTxBusyPtr, pList, 0);
+
+    if ( NULL == DRV_ETH_TxPacketDescAddrGet(ethId) )
+    {   // 1st time transmission!
+        DRV_ETH_TxPacketDescAddrSet(ethId,(uint8_t *)KVA_TO_PA(&pMacD->mData._EnetTxBusyPtr->head->hwDcpt) );
+    }
+    DRV_ETH_TxRTSEnable(ethId);
+
+} //_EthTxKickList
+
+
 /****************************************************************************
  * Function:        _EthTxSchedList
  *
@@ -618,20 +649,11 @@ static DRV_ETHMAC_RESULT _EthTxSchedBuffer(DRV_ETHMAC_INSTANCE_DCPT* pMacD, cons
  *****************************************************************************/
 static void _EthTxSchedList(DRV_ETHMAC_INSTANCE_DCPT* pMacD, DRV_ETHMAC_DCPT_LIST* pList)
 {
-    DRV_ETHERNET_REGISTERS* ethId = pMacD->mData.pEthReg;
-
     if(!DRV_ETHMAC_LIB_ListIsEmpty(pList))
     {
         (pList->head)->hwDcpt.hdr.SOP=1;
         (pList->tail)->hwDcpt.hdr.EOP=1;
-        _EthAppendBusyList(pMacD, pMacD->mData._EnetTxBusyPtr, pList, 0);
-
-        if ( NULL == DRV_ETH_TxPacketDescAddrGet(ethId) )
-        {   // 1st time transmission!
-            DRV_ETH_TxPacketDescAddrSet(ethId,(uint8_t *)KVA_TO_PA(&pMacD->mData._EnetTxBusyPtr->head->hwDcpt) );
-        }
-        DRV_ETH_TxRTSEnable(ethId);
-
+        _EthTxKickList(pMacD, pList);
     }
 
 } //_EthTxSchedList
@@ -697,6 +719,55 @@ DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendPacket(DRV_ETHMAC_INSTANCE_DCPT* pMacD, co
 } //DRV_ETHMAC_LibTxSendPacket
 
 
+/****************************************************************************
+ * Function:        DRV_ETHMAC_LibTxSendPacketList
+ *****************************************************************************/
+DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendPacketList(DRV_ETHMAC_INSTANCE_DCPT* pMacD, const DRV_ETHMAC_PKT_DCPT** pPktTbl, int nPkts, int* pnSched)
+{
+    DRV_ETHMAC_RESULT res;
+    int pktIx;
+    const DRV_ETHMAC_PKT_DCPT* pPkt;
+    DRV_ETHMAC_DCPT_LIST   *pNewList, *pPktList;
+    uint8_t newList [(DRV_ETHMAC_DCPT_LIST_ALIGN -1) + sizeof(DRV_ETHMAC_DCPT_LIST)];
+    uint8_t pktList [(DRV_ETHMAC_DCPT_LIST_ALIGN -1) + sizeof(DRV_ETHMAC_DCPT_LIST)];
+
+    pNewList = DRV_ETHMAC_LIB_ListInit(_EthAlignAdjust(newList));
+    pPktList = _EthAlignAdjust(pktList);
+
+    res=DRV_ETHMAC_RES_OK;
+    for(pktIx = 0; pktIx < nPkts; pktIx++)
+    {
+        DRV_ETHMAC_LIB_ListInit(pPktList);
+        for(pPkt = pPktTbl[pktIx]; pPkt!=0 && pPkt->pBuff!=0 && pPkt->nBytes!=0 && res==DRV_ETHMAC_RES_OK; pPkt = pPkt->next)
+        {
+            res=_EthTxSchedBuffer(pMacD, pPkt->pBuff, pPkt->nBytes, pPktList);
+        }
+
+        if(res!=DRV_ETHMAC_RES_OK)
+        {   // this packet failed, put back its nodes; the previous ones are still sent
+            DRV_ETHMAC_LIB_ListAppendTail(pMacD->mData._EnetTxFreePtr, pPktList);
+            break;
+        }
+
+        if(!DRV_ETHMAC_LIB_ListIsEmpty(pPktList))
+        {   // mark the packet boundaries
+            (pPktList->head)->hwDcpt.hdr.SOP=1;
+            (pPktList->tail)->hwDcpt.hdr.EOP=1;
+            DRV_ETHMAC_LIB_ListAppendTail(pNewList, pPktList);
+        }
+    }
+
+    if(!DRV_ETHMAC_LIB_ListIsEmpty(pNewList))
+    {   // single hand over to the hw for all the packets
+        _EthTxKickList(pMacD, pNewList);
+    }
+
+    *pnSched = pktIx;
+    return res;
+
+} //DRV_ETHMAC_LibTxSendPacketList
+
+
 /****************************************************************************
  * Function:        DRV_ETHMAC_LibTxGetBufferStatus
  *****************************************************************************/
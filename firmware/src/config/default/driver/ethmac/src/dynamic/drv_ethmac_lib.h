@@ -831,6 +831,45 @@ DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendBuffer (DRV_ETHMAC_INSTANCE_DCPT* pMacD,
 DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendPacket (DRV_ETHMAC_INSTANCE_DCPT* pMacD,  const DRV_ETHMAC_PKT_DCPT *pPkt );
 
 
+/*******************************************************************************
+  Function:
+    DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendPacketList (DRV_ETHMAC_INSTANCE_DCPT* pMacD, const DRV_ETHMAC_PKT_DCPT** pPktTbl, int nPkts, int* pnSched )
+
+  Summary:
+    Schedules multiple packets for transmission.
+
+  Description:
+    This function schedules the supplied packets for transmission, in order.
+    It behaves like calling DRV_ETHMAC_LibTxSendPacket for each packet
+    but the descriptors of all packets are handed over to the hw
+    and the transmission is started just once.
+
+  Precondition:
+    DRV_ETHMAC_LibMACOpen, DRV_ETHMAC_LibDescriptorsPoolAdd should have been called.
+
+  Parameters:
+    pMacD       - driver instance.
+    pPktTbl     - table of packet descriptors, one per packet
+    nPkts       - number of entries in pPktTbl
+    pnSched     - address to store the number of packets that were scheduled
+
+  Returns:
+    DRV_ETHMAC_RES_OK              - success, all packets were scheduled
+
+    DRV_ETHMAC_RES_NO_DESCRIPTORS  - no descriptors available for packet pPktTbl[*pnSched]
+
+    DRV_ETHMAC_RES_USPACE_ERR      - packet pPktTbl[*pnSched] uses user space buffers
+
+  Remarks:
+    Not multithreaded safe. Don't call from from both ISR and non-ISR code or
+    multiple ISR's!
+
+    The packets before the failing one are scheduled for transmission.
+ *****************************************************************************/
+
+DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxSendPacketList (DRV_ETHMAC_INSTANCE_DCPT* pMacD, const DRV_ETHMAC_PKT_DCPT** pPktTbl, int nPkts, int* pnSched );
+
+
 /*******************************************************************************
   Function:
     DRV_ETHMAC_RESULT DRV_ETHMAC_LibTxGetBufferStatus (DRV_ETHMAC_INSTANCE_DCPT* pMacD,  const void *pBuff, const DRV_ETHMAC_PKT_STAT_TX **pTxStat )
@@ -180,6 +180,8 @@ const TCPIP_UDP_MODULE_CONFIG tcpipUDPInitData =
 {
     .nSockets       = TCPIP_UDP_MAX_SOCKETS,
     .sktTxBuffSize  = TCPIP_UDP_SOCKET_DEFAULT_TX_SIZE, 
+    .poolBuffers    = TCPIP_UDP_SOCKET_POOL_BUFFERS,
+    .poolBufferSize = TCPIP_UDP_SOCKET_POOL_BUFFER_SIZE,
 };
 
 /*** TCP Sockets Initialization Data ***/
@@ -213,6 +213,10 @@ typedef enum
     TCPIP_DNS_RES_CACHE_FULL          = -8,   // the cache is full and no entry could be added
     TCPIP_DNS_RES_INVALID_HOSTNAME    = -9,   // Invalid hostname
     TCPIP_DNS_RES_SOCKET_ERROR       = -10,   // DNS UDP socket error: not ready, TX error, etc.
+    TCPIP_DNS_RES_NAME_ERROR         = -11,   // the server reported that the name does not exist (NXDOMAIN)
+                                              // the answer is cached for the SOA minimum TTL
+    TCPIP_DNS_RES_SERVER_FAIL        = -12,   // the server failed or refused the query (SERVFAIL/REFUSED)
+                                              // the answer is cached for a short time
 }TCPIP_DNS_RESULT;
 
 
@@ -307,6 +311,11 @@ typedef struct
     uint16_t            pendingEntries;                 // number of entries that need to be solved
     uint16_t            currentEntries;                 // number of solved and unslolved name entries
     uint16_t            totalEntries;                   // total number of supported name entries
+    uint16_t            negativeEntries;                // number of cached negative answers
+    uint32_t            nQueries;                       // number of queries sent to the servers
+    uint32_t            nRetries;                       // number of queries sent again for lack of an answer
+    uint32_t            nCoalesced;                     // number of resolve requests joined to a query in flight
+    uint32_t            nNegCached;                     // number of resolve requests answered from the negative cache
 }TCPIP_DNS_CLIENT_INFO;
 
 // *****************************************************************************
@@ -340,11 +349,28 @@ typedef struct
     TCPIP_DNS_RES_PENDING     - operation is ongoing
     TCPIP_DNS_RES_NAME_IS_IPADDRESS   - name request is a IPv4 or IPv6 address
 
+    TCPIP_DNS_RES_NAME_ERROR  - the name does not exist, cached answer
+    TCPIP_DNS_RES_SERVER_FAIL - the server could not solve the name, cached answer
+
     or an error code if an error occurred
     
   Remarks:
     To clear the cache use TCPIP_DNS_Disable(hNet, true);
 
+    Concurrent requests for a name that is being solved do not generate
+    new queries; they wait for the query in flight.
+    Negative answers (NXDOMAIN, SERVFAIL) are cached as specified by RFC 2308.
+    Use TCPIP_DNS_RemoveEntry or TCPIP_DNS_Send_Query to query again before they expire.
+
+    A TCPIP_DNS_TYPE_ANY request is sent as separate A and AAAA queries,
+    in parallel. The name is solved as soon as the first answer arrives;
+    the addresses of the other type are added when its answer arrives.
+
+    When TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT != 0, a solved entry that
+    is in use is queried again in the background once that percentage
+    of its life time has elapsed. The cached addresses are still returned
+    while the refresh is pending, so a name in use does not expire.
+
   */
 TCPIP_DNS_RESULT  TCPIP_DNS_Resolve(const char* hostName, TCPIP_DNS_RESOLVE_TYPE type);
 
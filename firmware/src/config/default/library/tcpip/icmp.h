@@ -228,8 +228,11 @@ typedef struct
     The user has to enforce the fact that the "identifier" field has 
     to be unique per (destination address, source address) pair.
 
-    Currently there could be only one ping/echo request active at a time.
-    If another echo request is active, a ICMP_ECHO_BUSY code will be returned. 
+    Up to TCPIP_ICMP_MAX_ECHO_REQUESTS echo requests can be active at the same time.
+    Replies are matched on the (identifier, sequenceNumber, targetAddr) key,
+    so each active request needs a different key;
+    a request with a key already in flight returns ICMP_ECHO_PARAMETER_ERROR.
+    If all request slots are in use, a ICMP_ECHO_BUSY code will be returned. 
 
 
     Once the callback notification occurs, the echo request is completed
@@ -273,6 +276,74 @@ ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequest (TCPIP_ICMP_ECHO_REQUEST* pEchoRequest,
 */
 ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequestCancel (TCPIP_ICMP_REQUEST_HANDLE icmpHandle);
 
+// *****************************************************************************
+/* Function:
+    uint32_t TCPIP_ICMP_EchoRequestRttGet (TCPIP_ICMP_REQUEST_HANDLE icmpHandle);
+
+  Summary:
+    Returns the round trip time of an answered ICMP echo request
+
+
+  Description:
+    This function returns the time elapsed between the transmission
+    of the echo request and the processing of its reply, in microseconds.
+    The time is measured with the system counter (SYS_TMR_SystemCountGet).
+
+  Precondition:
+    The TCP/IP Stack must be initialized and up and running.
+    Valid handle obtained using TCPIP_ICMP_EchoRequest.
+
+
+  Parameters:
+    - icmpHandle    - valid ICMP handle
+
+  Returns:
+    - the round trip time, microseconds
+    - 0 if the handle is invalid or no reply has been received
+
+  Example:
+  <code>
+    void EchoCallback(const TCPIP_ICMP_ECHO_REQUEST* pReqData, TCPIP_ICMP_REQUEST_HANDLE icmpHandle, TCPIP_ICMP_ECHO_REQUEST_RESULT result)
+    {
+        if(result == TCPIP_ICMP_ECHO_REQUEST_RES_OK)
+        {
+            uint32_t rttUs = TCPIP_ICMP_EchoRequestRttGet(icmpHandle);
+        }
+    }
+  </code>
+
+  Remarks:
+    The handle is valid only until the request callback returns.
+    The function should be called from within the request callback.
+*/
+uint32_t TCPIP_ICMP_EchoRequestRttGet (TCPIP_ICMP_REQUEST_HANDLE icmpHandle);
+
+// *****************************************************************************
+/* Function:
+    int TCPIP_ICMP_EchoRequestsPending (void);
+
+  Summary:
+    Returns the number of ICMP echo requests in flight
+
+
+  Description:
+    This function returns the number of echo requests scheduled
+    with TCPIP_ICMP_EchoRequest that are still waiting for a reply.
+
+  Precondition:
+    The TCP/IP Stack must be initialized and up and running.
+
+  Parameters:
+    None
+
+  Returns:
+    Number of pending requests, <= TCPIP_ICMP_MAX_ECHO_REQUESTS
+
+  Remarks:
+    None
+*/
+int TCPIP_ICMP_EchoRequestsPending (void);
+
 // *****************************************************************************
 /* Function:
     ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequestSend (TCPIP_NET_HANDLE netH, IPV4_ADDR * targetAddr, 
@@ -327,7 +327,7 @@ typedef struct
     Structure describing the ARP statistics maintained by the IPv4 module
 
   Description:
-    Data structure updated by the IPv4 ARP process when ARP debugging is enabled
+    Data structure updated by the IPv4 ARP process
 
   Remarks:
     None
@@ -342,6 +342,12 @@ typedef struct
     size_t fwdSolved;   // solved for FWD
     size_t totSolved;   // total solved
     size_t totFailed;   // total failed 
+    size_t nSlots;      // currently allocated slots
+    size_t nTargets;    // ARP targets with pending packets
+    size_t poolFail;    // packets rejected: no ARP slot available
+    size_t waitCount;   // packets released from the ARP queue
+    size_t waitTotMs;   // total time the released packets waited for ARP, ms
+    size_t waitMaxMs;   // maximum time a packet waited for ARP, ms
 }TCPIP_IPV4_ARP_QUEUE_STAT;
 
 // *****************************************************************************
@@ -359,7 +365,9 @@ typedef struct
 typedef struct
 {
     /* The number of entries that IPv4 can queue up for ARP resolution.
-       Usually it should be <= the number of total ARP cache entries for all interfaces */
+       Usually it should be <= the number of total ARP cache entries for all interfaces.
+       If TCPIP_IPV4_ARP_SLOTS_MAX is defined, the queue grows in blocks
+       of arpEntries as needed, up to TCPIP_IPV4_ARP_SLOTS_MAX entries */
     size_t                  arpEntries;
 
 
@@ -1506,7 +1514,6 @@ bool TCPIP_IPv4_ForwardStatGet(size_t index, TCPIP_IPV4_FORWARD_STAT* pStat, boo
    
   Precondition:
     IPv4 properly initialized
-    IPv4 ARP debugging enabled
         
 
   Parameters:
@@ -1518,7 +1525,8 @@ bool TCPIP_IPv4_ForwardStatGet(size_t index, TCPIP_IPV4_FORWARD_STAT* pStat, boo
     - false otherwise
       
   Remarks:
-    Function exists only if IPv4 ARP debugging is enabled
+    The ARP queue slots are allocated in blocks of TCPIP_IPV4_MODULE_CONFIG::arpEntries
+    slots, up to TCPIP_IPV4_ARP_SLOTS_MAX.
 
  */
 bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear);
@@ -174,6 +174,37 @@ typedef struct
 }TCPIP_SNTP_EVENT_TIME_DATA;
 
 
+// *****************************************************************************
+/* TCPIP_SNTP_STATISTICS structure
+
+  Summary:
+    Clock synchronization statistics of the SNTP module.
+
+  Description:
+    Describes the state of the local clock discipline.
+    At each poll the SNTP module sends TCPIP_NTP_SAMPLES requests to up to
+    TCPIP_NTP_MAX_SERVERS server addresses and uses the reply with the
+    minimum round trip delay to update the local clock.
+
+  Remarks:
+    Offsets larger than TCPIP_NTP_STEP_THRESHOLD ms step the clock.
+    Smaller offsets are slewed and update the frequency correction.
+ */
+
+typedef struct
+{
+    int32_t             offsetUs;   // clock offset measured at the last update: server - local, microseconds
+    uint32_t            delayUs;    // round trip delay of the sample used at the last update, microseconds
+    uint32_t            jitterUs;   // average offset variation between successive updates, microseconds
+    int32_t             freqPpb;    // frequency correction applied to the system counter, parts per billion
+    uint32_t            nUpdates;   // number of clock updates
+    uint32_t            nSteps;     // number of updates that stepped the clock
+    uint16_t            nSamples;   // valid replies in the last poll
+    uint16_t            nServers;   // server addresses sampled in the last poll
+    IP_MULTI_ADDRESS    serverAddr; // server that provided the sample used at the last update
+}TCPIP_SNTP_STATISTICS;
+
+
 // *****************************************************************************
 /* TCPIP_SNTP_EVENT Enumeration
 
@@ -435,6 +466,65 @@ bool     TCPIP_SNTP_IsEnabled(void);
  */
 TCPIP_SNTP_RESULT     TCPIP_SNTP_TimeGet(uint32_t* pUTCSeconds, uint32_t* pMs);
 
+//*****************************************************************************
+/*
+  Function:
+    TCPIP_SNTP_RESULT TCPIP_SNTP_TimeGetUs(uint32_t* pUTCSeconds, uint32_t* pUs);
+
+  Summary:
+    Obtains the current time in UTC format with microsecond resolution.
+
+  Description:
+    This function is the microsecond resolution version of TCPIP_SNTP_TimeGet.
+    The time is read from the local clock that the SNTP module
+    disciplines on top of the system counter (SYS_TMR_SystemCountGet).
+    
+  Precondition:
+    The TCP/IP Stack should have been initialized.
+
+  Parameters:
+    pUTCSeconds - pointer to store the current UTC seconds 
+                  could be NULL if the UTC time is not needed
+    pUs         - pointer to store the current microsecond
+                  could be NULL if not needed
+
+  Returns:
+    - SNTP_RES_OK - if the call succeeded and the values are accurate
+    - SNTP_RES_TSTAMP_STALE error code - if there is no recent timestamp
+    - SNTP_RES_TSTAMP_ERROR error code - if there is no available timestamp
+
+  Remarks:
+    The accuracy is given by the offset and jitter reported by TCPIP_SNTP_StatisticsGet.
+ */
+TCPIP_SNTP_RESULT     TCPIP_SNTP_TimeGetUs(uint32_t* pUTCSeconds, uint32_t* pUs);
+
+//*****************************************************************************
+/*
+  Function:
+    TCPIP_SNTP_RESULT TCPIP_SNTP_StatisticsGet(TCPIP_SNTP_STATISTICS* pStat);
+
+  Summary:
+    Gets the clock synchronization statistics.
+
+  Description:
+    This function returns the offset, delay, jitter and frequency correction
+    of the local clock, as calculated at the last update.
+    
+  Precondition:
+    The TCP/IP Stack should have been initialized.
+
+  Parameters:
+    pStat   - pointer to store the statistics
+              could be NULL if only the status is needed
+
+  Returns:
+    The current timestamp status, as returned by TCPIP_SNTP_TimeStampStatus.
+
+  Remarks:
+    None
+ */
+TCPIP_SNTP_RESULT     TCPIP_SNTP_StatisticsGet(TCPIP_SNTP_STATISTICS* pStat);
+
 //*****************************************************************************
 /*
   Function:
@@ -57,6 +57,10 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
     Constants and Variables
   ***************************************************************************/
 
+#if !defined(TCPIP_ARP_CACHE_REFRESH_TMO)
+#define TCPIP_ARP_CACHE_REFRESH_TMO     0       // no proactive refresh
+#endif
+
 // global ARP module descriptor
 typedef struct
 {
@@ -77,6 +81,8 @@ typedef struct
     uint32_t            entryPendingTmo;     // timeout for a pending to be solved entry in the cache, in seconds
     uint32_t            entryRetryTmo;       // timeout for resending an ARP request for a pending entry - seconds
                                              // 1 sec < tmo < entryPendingTmo
+    uint32_t            entryRefreshTmo;     // an entry in use is refreshed this long before its entrySolvedTmo - seconds
+                                             // 0 if no refresh
     int                 permQuota;           // max percentage of permanent entries allowed in the cache - %
     uint16_t            entryRetries;        // number of retries for a regular ARP cache entry
     uint16_t            entryGratRetries;    // number of retries for a gratuitous ARP request; default is 1
@@ -145,7 +151,7 @@ void TCPIP_ARP_HashKeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const voi
 #endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
 
 /*static __inline__*/static  void /*__attribute__((always_inline))*/ _ARPSetEntry(ARP_HASH_ENTRY* arpHE, ARP_ENTRY_FLAGS newFlags,
-                                                                      TCPIP_MAC_ADDR* hwAdd, PROTECTED_SINGLE_LIST* addList)
+                                                                      TCPIP_MAC_ADDR* hwAdd, PROTECTED_DOUBLE_LIST* addList)
 {
     arpHE->hEntry.flags.value &= ~ARP_FLAG_ENTRY_VALID_MASK;
     arpHE->hEntry.flags.value |= newFlags;
@@ -155,21 +161,27 @@ void TCPIP_ARP_HashKeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const voi
         arpHE->hwAdd = *hwAdd;
     }
     
-    arpHE->tInsert = arpMod.timeSeconds;
+    arpHE->tInsert = arpHE->tSolved = arpMod.timeSeconds;
     arpHE->nRetries = 1;
     if(addList)
     {
-        TCPIP_Helper_ProtectedSingleListTailAdd(addList, (SGL_LIST_NODE*)&arpHE->next);
+        TCPIP_Helper_ProtectedDoubleListTailAdd(addList, (DBL_LIST_NODE*)&arpHE->next);
     }
 }
 
 
 // re-inserts at the tail, makes the entry fresh
-/*static __inline__*/static  void /*__attribute__((always_inline))*/ _ARPRefreshEntry(ARP_HASH_ENTRY* arpHE, PROTECTED_SINGLE_LIST* pL)
+// this is on the TX path: the move is O(1) and it's done at most once per ARP tick
+/*static __inline__*/static  void /*__attribute__((always_inline))*/ _ARPRefreshEntry(ARP_HASH_ENTRY* arpHE, PROTECTED_DOUBLE_LIST* pL)
 {
-    TCPIP_Helper_ProtectedSingleListNodeRemove(pL, (SGL_LIST_NODE*)&arpHE->next);
-    arpHE->tInsert = arpMod.timeSeconds;
-    TCPIP_Helper_ProtectedSingleListTailAdd(pL, (SGL_LIST_NODE*)&arpHE->next);
+    if(arpHE->tInsert != arpMod.timeSeconds)
+    {
+        TCPIP_Helper_ProtectedDoubleListLock(pL);
+        TCPIP_Helper_DoubleListNodeRemove(&pL->list, (DBL_LIST_NODE*)&arpHE->next);
+        arpHE->tInsert = arpMod.timeSeconds;
+        TCPIP_Helper_DoubleListTailAdd(&pL->list, (DBL_LIST_NODE*)&arpHE->next);
+        TCPIP_Helper_ProtectedDoubleListUnlock(pL);
+    }
 }
 
 /*static __inline__*/static  void /*__attribute__((always_inline))*/ _ARPRemoveCacheEntries(ARP_CACHE_DCPT* pArpDcpt)
@@ -178,15 +190,15 @@ void TCPIP_ARP_HashKeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const voi
     if(pArpDcpt->hashDcpt)
     {
         TCPIP_OAHASH_EntriesRemoveAll(pArpDcpt->hashDcpt);
-        TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->incompleteList);
-        TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->completeList);
-        TCPIP_Helper_ProtectedSingleListRemoveAll(&pArpDcpt->permList);
+        TCPIP_Helper_ProtectedDoubleListRemoveAll(&pArpDcpt->incompleteList);
+        TCPIP_Helper_ProtectedDoubleListRemoveAll(&pArpDcpt->completeList);
+        TCPIP_Helper_ProtectedDoubleListRemoveAll(&pArpDcpt->permList);
     }
 }
 
 static  void _ARPRemoveEntry(ARP_CACHE_DCPT* pArpDcpt, OA_HASH_ENTRY* hE)
 {
-    PROTECTED_SINGLE_LIST     *remList;
+    PROTECTED_DOUBLE_LIST     *remList;
 
     if((hE->flags.value & ARP_FLAG_ENTRY_PERM) != 0 )
     {
@@ -201,7 +213,7 @@ static  void _ARPRemoveEntry(ARP_CACHE_DCPT* pArpDcpt, OA_HASH_ENTRY* hE)
         remList =  &pArpDcpt->incompleteList;
     }
 
-    TCPIP_Helper_ProtectedSingleListNodeRemove(remList, (SGL_LIST_NODE*)&((ARP_HASH_ENTRY*)hE)->next);
+    TCPIP_Helper_ProtectedDoubleListNodeRemove(remList, (DBL_LIST_NODE*)&((ARP_HASH_ENTRY*)hE)->next);
 
     TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, hE);
 
@@ -422,9 +434,11 @@ static bool _ARPSendIfPkt(TCPIP_NET_IF* pIf, TCPIP_ARP_OPERATION_TYPE oper, uint
         TCPIP_PKT_FlightLogTx(pMacPkt, TCPIP_THIS_MODULE_ID);
         if(_TCPIPStackPacketTx(pIf, pMacPkt) >= 0)
         {   // MAC sets itself the TCPIP_MAC_PKT_FLAG_QUEUED
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
             return true;
         }
         TCPIP_PKT_FlightLogAcknowledge(pMacPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_MAC_REJECT_ERR);
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
     }
 
     // something failed
@@ -461,12 +475,12 @@ static void _ARPUpdateEntry(TCPIP_NET_IF* pIf, ARP_HASH_ENTRY* arpHE, TCPIP_MAC_
         if((arpHE->hEntry.flags.value & ARP_FLAG_ENTRY_COMPLETE) == 0)
         {   // was waiting for this one, it was queued
             evType = ARP_EVENT_SOLVED;
-            TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->incompleteList, (SGL_LIST_NODE*)&arpHE->next);
+            TCPIP_Helper_ProtectedDoubleListNodeRemove(&pArpDcpt->incompleteList, (DBL_LIST_NODE*)&arpHE->next);
         }
         else
         {   // completed entry, but now updated
             evType = ARP_EVENT_UPDATED;
-            TCPIP_Helper_ProtectedSingleListNodeRemove(&pArpDcpt->completeList, (SGL_LIST_NODE*)&arpHE->next);
+            TCPIP_Helper_ProtectedDoubleListNodeRemove(&pArpDcpt->completeList, (DBL_LIST_NODE*)&arpHE->next);
         }
         
         // move to tail, updated
@@ -631,6 +645,7 @@ bool TCPIP_ARP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
         arpMod.permQuota = arpData->permQuota;
         arpMod.entryRetries = arpData->retries;
         arpMod.entryGratRetries =  arpData->gratProbeCount;
+        arpMod.entryRefreshTmo = (TCPIP_ARP_CACHE_REFRESH_TMO < arpMod.entrySolvedTmo) ? TCPIP_ARP_CACHE_REFRESH_TMO : 0;
 
 
         if(arpMod.arpCacheDcpt == 0)
@@ -673,17 +688,17 @@ bool TCPIP_ARP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
                 pArpDcpt->hashDcpt = hashDcpt;
                 while(true)
                 {
-                    if((iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->permList)) == false)
+                    if((iniRes = TCPIP_Helper_ProtectedDoubleListInitialize(&pArpDcpt->permList)) == false)
                     {
                         break;
                     }
 
-                    if((iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->completeList)) == false)
+                    if((iniRes = TCPIP_Helper_ProtectedDoubleListInitialize(&pArpDcpt->completeList)) == false)
                     {
                         break;
                     }
 
-                    iniRes = TCPIP_Helper_ProtectedSingleListInitialize(&pArpDcpt->incompleteList);
+                    iniRes = TCPIP_Helper_ProtectedDoubleListInitialize(&pArpDcpt->incompleteList);
                     break;
                 }
 
@@ -811,9 +826,9 @@ static void _ARPDeleteCache(ARP_CACHE_DCPT* pArpDcpt)
     if(pArpDcpt->hashDcpt)
     {
         TCPIP_OAHASH_EntriesRemoveAll(pArpDcpt->hashDcpt);
-        TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->incompleteList);
-        TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->completeList);
-        TCPIP_Helper_ProtectedSingleListDeinitialize(&pArpDcpt->permList);
+        TCPIP_Helper_ProtectedDoubleListDeinitialize(&pArpDcpt->incompleteList);
+        TCPIP_Helper_ProtectedDoubleListDeinitialize(&pArpDcpt->completeList);
+        TCPIP_Helper_ProtectedDoubleListDeinitialize(&pArpDcpt->permList);
         
         TCPIP_HEAP_Free(arpMod.memH, pArpDcpt->hashDcpt);
         pArpDcpt->hashDcpt = 0;
@@ -838,6 +853,10 @@ static TCPIP_MAC_PACKET* _ARPAllocateTxPacket(void)
     {
         TCPIP_PKT_PacketAcknowledgeSet(pPkt, _ARPTxAckFnc, 0);
     }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
 
 
     return pPkt;
@@ -954,7 +973,7 @@ static void TCPIP_ARP_Timeout(void)
     int netIx, purgeIx;
     ARP_HASH_ENTRY  *pE;
     ARP_CACHE_DCPT  *pArpDcpt;
-    SGL_LIST_NODE   *pN;
+    DBL_LIST_NODE   *pN;
     TCPIP_NET_IF *pIf;
     int         nArpIfs;
     bool        isConfig;
@@ -984,7 +1003,7 @@ static void TCPIP_ARP_Timeout(void)
             if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entryPendingTmo)
             {   // expired, remove it
                 TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
-                TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->incompleteList);
+                TCPIP_Helper_ProtectedDoubleListHeadRemove(&pArpDcpt->incompleteList);
                 _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_TMO);
             }
             else
@@ -1024,7 +1043,7 @@ static void TCPIP_ARP_Timeout(void)
             if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entrySolvedTmo)
             {   // expired, remove it
                 TCPIP_OAHASH_EntryRemove(pArpDcpt->hashDcpt, &pE->hEntry);
-                TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->completeList);
+                TCPIP_Helper_ProtectedDoubleListHeadRemove(&pArpDcpt->completeList);
                 _ARPNotifyClients(pIf, &pE->ipAddress, 0, ARP_EVENT_REMOVED_EXPIRED);
             }
             else
@@ -1033,12 +1052,36 @@ static void TCPIP_ARP_Timeout(void)
             }
         }
 
+        // refresh the entries in use before they get stale
+        // so that the hot TX path does not stall waiting for a new resolution.
+        // The list is in LRU order: walk back from the most recently used
+        // and stop at the first entry that was not used during the refresh interval
+        if(arpMod.entryRefreshTmo != 0 && isConfig == false)
+        {
+            for(pN = pArpDcpt->completeList.list.tail; pN != 0; pN = pN->prev)
+            {
+                pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(ARP_HASH_ENTRY, next));
+                if( (arpMod.timeSeconds - pE->tInsert) >= arpMod.entryRefreshTmo)
+                {   // idle entry; the rest are idle too
+                    break;
+                }
+
+                if( pE->nRetries <= arpMod.entryRetries &&
+                    (arpMod.timeSeconds - pE->tSolved) >= arpMod.entrySolvedTmo - arpMod.entryRefreshTmo + (pE->nRetries - 1) * arpMod.entryRetryTmo)
+                {   // poll the known owner; the last retry is a broadcast
+                    // a reply updates the entry
+                    _ARPSendIfPkt(pIf, ARP_OPERATION_REQ, (uint32_t)pIf->netIPAddr.Val, pE->ipAddress.Val, pE->nRetries < arpMod.entryRetries ? &pE->hwAdd : &arpBcastAdd);
+                    pE->nRetries++;
+                }
+            }
+        }
+
         // finally purge, if needed
         if(pArpDcpt->hashDcpt->fullSlots >= pArpDcpt->purgeThres)
         {
             for(purgeIx = 0; purgeIx < pArpDcpt->purgeQuanta; purgeIx++)
             {
-                pN = TCPIP_Helper_ProtectedSingleListHeadRemove(&pArpDcpt->completeList);
+                pN = TCPIP_Helper_ProtectedDoubleListHeadRemove(&pArpDcpt->completeList);
                 if(pN)
                 {
                     pE = (ARP_HASH_ENTRY*) ((uint8_t*)pN - offsetof(ARP_HASH_ENTRY, next));
@@ -1072,8 +1115,10 @@ static void TCPIP_ARP_Process(void)
     IPV4_ADDR alignedIpV4Addr;
 
 
-    // extract queued ARP packets
-    while((pPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
+    // extract all queued ARP packets at once
+    SINGLE_LIST rxBatch;
+    _TCPIPStackModuleRxExtractAll(TCPIP_THIS_MODULE_ID, &rxBatch);
+    while((pPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxBatch)) != 0)
     {
         TCPIP_PKT_FlightLogRx(pPkt, TCPIP_THIS_MODULE_ID);
         arpReqRes = ARP_RES_OK;
@@ -1102,7 +1147,7 @@ static void TCPIP_ARP_Process(void)
 
             // Handle incoming ARP packet
             alignedIpV4Addr.Val = pArpPkt->SenderIPAddr.Val;
-            hE = TCPIP_OAHASH_EntryLookup(pArpDcpt->hashDcpt, &alignedIpV4Addr.Val);
+            hE = TCPIP_OAHASH_EntryLookupKey32(pArpDcpt->hashDcpt, alignedIpV4Addr.Val, offsetof(ARP_HASH_ENTRY, ipAddress));
             if(hE != 0)
             {   // we already have this sender and we should update it
                 _ARPUpdateEntry(pIf, (ARP_HASH_ENTRY*)hE, &pArpPkt->SenderMACAddr);
@@ -1220,7 +1265,12 @@ static TCPIP_ARP_RESULT _ARPProbeAddress(TCPIP_NET_IF* pIf, IPV4_ADDR* IPAddr, I
 
     pArpDcpt = _ARPGetIfDcpt(pIf);
 
-    hE = TCPIP_OAHASH_EntryLookupOrInsert(pArpDcpt->hashDcpt, &IPAddr->Val);
+    // most of the time the entry is already there
+    hE = TCPIP_OAHASH_EntryLookupKey32(pArpDcpt->hashDcpt, IPAddr->Val, offsetof(ARP_HASH_ENTRY, ipAddress));
+    if(hE == 0)
+    {
+        hE = TCPIP_OAHASH_EntryLookupOrInsert(pArpDcpt->hashDcpt, &IPAddr->Val);
+    }
     if(hE == 0)
     {   // oops!
         return ARP_RES_CACHE_FULL;
@@ -1282,7 +1332,7 @@ bool TCPIP_ARP_IsResolved(TCPIP_NET_HANDLE hNet, IPV4_ADDR* IPAddr, TCPIP_MAC_AD
 
     pArpDcpt = _ARPGetIfDcpt(pIf);
     
-    hE = TCPIP_OAHASH_EntryLookup(pArpDcpt->hashDcpt, &IPAddr->Val);
+    hE = TCPIP_OAHASH_EntryLookupKey32(pArpDcpt->hashDcpt, IPAddr->Val, offsetof(ARP_HASH_ENTRY, ipAddress));
     if(hE != 0 && (hE->flags.value & ARP_FLAG_ENTRY_VALID_MASK) != 0 )
     {   // found address in cache
         ARP_HASH_ENTRY  *arpHE = (ARP_HASH_ENTRY*)hE;
@@ -1331,7 +1381,7 @@ TCPIP_ARP_RESULT TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, IPV4_ADDR* ipAdd, TCP
     ARP_CACHE_DCPT  *pArpDcpt;
     ARP_HASH_ENTRY  *arpHE;
     OA_HASH_ENTRY   *hE;
-    PROTECTED_SINGLE_LIST     *oldList, *newList;
+    PROTECTED_DOUBLE_LIST     *oldList, *newList;
     ARP_ENTRY_FLAGS newFlags;
     TCPIP_ARP_RESULT      res;
     TCPIP_NET_IF    *pIf;
@@ -1386,7 +1436,7 @@ TCPIP_ARP_RESULT TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, IPV4_ADDR* ipAdd, TCP
 
         if(newList != oldList)
         {   // remove from the old list
-            TCPIP_Helper_ProtectedSingleListNodeRemove(oldList, (SGL_LIST_NODE*)&arpHE->next);
+            TCPIP_Helper_ProtectedDoubleListNodeRemove(oldList, (DBL_LIST_NODE*)&arpHE->next);
         }
         res = ARP_RES_ENTRY_EXIST;
     }
@@ -1398,7 +1448,7 @@ TCPIP_ARP_RESULT TCPIP_ARP_EntrySet(TCPIP_NET_HANDLE hNet, IPV4_ADDR* ipAdd, TCP
     // add it to where it belongs
     _ARPSetEntry(arpHE, newFlags, hwAdd, newList);
 
-    if(TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->permList) >= (arpMod.permQuota * pArpDcpt->hashDcpt->fullSlots)/100)
+    if(TCPIP_Helper_ProtectedDoubleListCount(&pArpDcpt->permList) >= (arpMod.permQuota * pArpDcpt->hashDcpt->fullSlots)/100)
     {   // quota exceeded
         res = ARP_RES_PERM_QUOTA_EXCEED;
     }
@@ -1649,13 +1699,13 @@ size_t TCPIP_ARP_CacheEntriesNoGet(TCPIP_NET_HANDLE hNet, TCPIP_ARP_ENTRY_TYPE t
            return pOH->hEntries - pOH->fullSlots;
 
         case ARP_ENTRY_TYPE_PERMANENT:
-           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->permList);
+           return TCPIP_Helper_ProtectedDoubleListCount(&pArpDcpt->permList);
 
         case ARP_ENTRY_TYPE_COMPLETE:
-           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->completeList);
+           return TCPIP_Helper_ProtectedDoubleListCount(&pArpDcpt->completeList);
 
         case ARP_ENTRY_TYPE_INCOMPLETE:
-           return TCPIP_Helper_ProtectedSingleListCount(&pArpDcpt->incompleteList);
+           return TCPIP_Helper_ProtectedDoubleListCount(&pArpDcpt->incompleteList);
 
         case ARP_ENTRY_TYPE_ANY:
            return pOH->fullSlots;
@@ -1684,13 +1734,21 @@ TCPIP_ARP_RESULT TCPIP_ARP_CacheThresholdSet(TCPIP_NET_HANDLE hNet, int purgeThr
     return ARP_RES_OK;
 }
 
+// the key is a 32-bit IPv4 address: hash it as a word
+// multiplicative hash; fold the high bits in, the table size is not a power of 2
+static __inline__ size_t __attribute__((always_inline)) _ARPHashKey(const void* key)
+{
+    uint32_t v = ((ARP_UNALIGNED_KEY*)key)->v * 0x9e3779b1U;
+    return v ^ (v >> 16);
+}
+
 #if !defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
 
 // static versions
 // 
 size_t TCPIP_OAHASH_KeyHash(OA_HASH_DCPT* pOH, const void* key)
 {
-    return fnv_32_hash(key, sizeof(((ARP_HASH_ENTRY*)0)->ipAddress)) % (pOH->hEntries);
+    return _ARPHashKey(key) % (pOH->hEntries);
 }
 
 #if defined(OA_DOUBLE_HASH_PROBING)
@@ -1710,8 +1768,8 @@ OA_HASH_ENTRY* TCPIP_OAHASH_EntryDelete(OA_HASH_DCPT* pOH)
 {
     ARP_CACHE_DCPT  *pArpDcpt;
     ARP_HASH_ENTRY  *pE;
-    SGL_LIST_NODE   *pN;
-    SINGLE_LIST     *pRemList = 0;    
+    DBL_LIST_NODE   *pN;
+    DOUBLE_LIST     *pRemList = 0;    
     
     pArpDcpt = (ARP_CACHE_DCPT*)pOH->hParam;
 
@@ -1729,7 +1787,7 @@ OA_HASH_ENTRY* TCPIP_OAHASH_EntryDelete(OA_HASH_DCPT* pOH)
             pRemList = &pArpDcpt->completeList;
     }
 
-    pN = TCPIP_Helper_SingleListHeadRemove(pRemList);
+    pN = TCPIP_Helper_DoubleListHeadRemove(pRemList);
 
     if(pN)
     {
@@ -1760,7 +1818,7 @@ void TCPIP_OAHASH_KeyCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const void
 // 
 size_t TCPIP_ARP_HashKeyHash(OA_HASH_DCPT* pOH, const void* key)
 {
-    return fnv_32_hash(key, sizeof(((ARP_HASH_ENTRY*)0)->ipAddress)) % (pOH->hEntries);
+    return _ARPHashKey(key) % (pOH->hEntries);
 }
 
 #if defined(OA_DOUBLE_HASH_PROBING)
@@ -1780,8 +1838,8 @@ OA_HASH_ENTRY* TCPIP_ARP_HashEntryDelete(OA_HASH_DCPT* pOH)
 {
     ARP_CACHE_DCPT  *pArpDcpt;
     ARP_HASH_ENTRY  *pE;
-    SGL_LIST_NODE   *pN;
-    PROTECTED_SINGLE_LIST     *pRemList = 0;
+    DBL_LIST_NODE   *pN;
+    PROTECTED_DOUBLE_LIST     *pRemList = 0;
     
     pArpDcpt = (ARP_CACHE_DCPT*)pOH->hParam;
 
@@ -1799,7 +1857,7 @@ OA_HASH_ENTRY* TCPIP_ARP_HashEntryDelete(OA_HASH_DCPT* pOH)
             pRemList = &pArpDcpt->completeList;
     }
 
-    pN = TCPIP_Helper_ProtectedSingleListHeadRemove(pRemList);
+    pN = TCPIP_Helper_ProtectedDoubleListHeadRemove(pRemList);
 
     if(pN)
     {
@@ -82,14 +82,18 @@ typedef struct __attribute__((aligned(2), packed))
 
 
 // ARP cache entry
+// Note: 32 bytes; keep it compact, it scales with the number of neighbors
 typedef struct _TAG_ARP_HASH_ENTRY 
 {
     OA_HASH_ENTRY               hEntry;         // hash header;
-    struct _TAG_ARP_HASH_ENTRY* next;           // ordered link list by tInsert
+    struct _TAG_ARP_HASH_ENTRY* next;           // link list ordered by tInsert; DBL_LIST_NODE safe cast
+    struct _TAG_ARP_HASH_ENTRY* prev;           // previous node in the list
     IPV4_ADDR                   ipAddress;      // the hash key: the IP address
-    uint32_t                    tInsert;        // arp time it was inserted 
+    uint32_t                    tInsert;        // arp time it was inserted or last used 
+    uint32_t                    tSolved;        // arp time the hardware address was last confirmed
     TCPIP_MAC_ADDR                    hwAdd;          // the hardware address
     uint16_t                    nRetries;       // number of retries for an incomplete entry
+                                                // or for refreshing a complete one
 }ARP_HASH_ENTRY;
 
 // ARP flags used in hEntry->flags
@@ -122,9 +126,10 @@ typedef struct
 {
     OA_HASH_DCPT*       hashDcpt;       // contiguous space for a hash descriptor
                                         // and hash table entries
-    PROTECTED_SINGLE_LIST         permList;       // list of active entries that never expire
-    PROTECTED_SINGLE_LIST         completeList;   // list of completed, valid entries
-    PROTECTED_SINGLE_LIST         incompleteList; // list of not completed yet entries
+    PROTECTED_DOUBLE_LIST         permList;       // list of active entries that never expire
+    PROTECTED_DOUBLE_LIST         completeList;   // list of completed, valid entries
+                                                  // LRU order: the least recently used at the head
+    PROTECTED_DOUBLE_LIST         incompleteList; // list of not completed yet entries
     size_t              purgeThres;     // threshold to start cache purging
     size_t              purgeQuanta;    // how many entries to purge
 }ARP_CACHE_DCPT;
@@ -44,6 +44,26 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 #include "tcpip/src/dns_private.h"
 #define TCPIP_THIS_MODULE_ID    TCPIP_MODULE_DNS_CLIENT
 
+// percentage of the entry life time after which a solved entry that is in use
+// is refreshed in the background, before it expires
+// 0 disables the refresh: entries are removed when they expire
+#if !defined(TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT)
+#define TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT     0
+#endif
+
+// negative caching, RFC 2308
+// maximum time to cache a NXDOMAIN answer, seconds
+// the answer is cached for the SOA minimum TTL, but not longer than this
+#if !defined(TCPIP_DNS_CLIENT_CACHE_NEGATIVE_TTL_MAX)
+#define TCPIP_DNS_CLIENT_CACHE_NEGATIVE_TTL_MAX     300
+#endif
+
+// time to cache a SERVFAIL/REFUSED answer, seconds
+// RFC 2308 limits this to 5 minutes
+#if !defined(TCPIP_DNS_CLIENT_CACHE_SERVER_FAIL_TMO)
+#define TCPIP_DNS_CLIENT_CACHE_SERVER_FAIL_TMO      30
+#endif
+
 /****************************************************************************
   Section:
     Constants and Global Variables
@@ -89,8 +109,14 @@ static void                 _DNSClientCleanup(TCPIP_DNS_DCPT* pDnsDcpt);
 #define _DNSClientCleanup(pDnsDcpt)
 #endif  // (TCPIP_STACK_DOWN_OPERATION != 0)
 static TCPIP_DNS_HASH_ENTRY *_DNSHashEntryFromTransactionId(TCPIP_DNS_DCPT* pDnsDcpt, const char* hostName, uint16_t transactionId);
-static bool                 _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* dnsHE);
+static bool                 _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RR_PROCESS* pProc, TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* dnsHE);
 static int                  _DNS_GetAddresses(const char* hostName, int startIndex, IP_MULTI_ADDRESS* pIPAddr, int nIPAddresses, TCPIP_DNS_ADDRESS_REC_MASK recMask);
+static TCPIP_DNS_RESULT     _DNS_Send_Question(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, uint8_t qType, TCPIP_UINT16_VAL* pTransId);
+static void                 _DNS_PendingSet(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, uint8_t pendMask);
+static uint8_t              _DNS_TransactionMask(TCPIP_DNS_HASH_ENTRY* pDnsHE, uint16_t transactionId);
+static TCPIP_DNS_RESULT     _DNS_QueryAdd(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE);
+static void                 _DNS_NegativeSet(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, TCPIP_DNS_RR_PROCESS* pProc);
+static bool                 _DNS_ReadSoaTTL(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DNS_RR_PROCESS* pProc);
 
 
 
@@ -226,7 +252,13 @@ static void _DNS_CleanCacheEntry(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY*
 {
     if(pDnsHE->hEntry.flags.busy)
     {
-        if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
+        _DNS_PendingSet(pDnsDcpt, pDnsHE, 0);
+        if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+        {   // deleting a negative entry
+            pDnsDcpt->negativeEntries--;
+            _DNSAssertCond(pDnsDcpt->negativeEntries >= 0, __func__, __LINE__);
+        }
+        else if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
         {   // deleting an unsolved entry
             pDnsDcpt->unsolvedEntries--;
             _DNSAssertCond(pDnsDcpt->unsolvedEntries >= 0, __func__, __LINE__);
@@ -263,7 +295,17 @@ static  TCPIP_DNS_RESULT  _DNSCompleteHashEntry(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_
 {
      
     dnsHE->hEntry.flags.value &= ~TCPIP_DNS_FLAG_ENTRY_TIMEOUT;
-    dnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_COMPLETE;
+    if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
+    {   // newly solved entry
+        dnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_COMPLETE;
+        pDnsDcpt->unsolvedEntries--;
+        _DNSAssertCond(pDnsDcpt->unsolvedEntries >= 0, __func__, __LINE__);
+        if(dnsHE->pendMask != 0)
+        {   // the other address type is still on its way
+            pDnsDcpt->solvedPending++;
+        }
+    }
+    // else refresh or late answer for the other address type
     dnsHE->recordMask = TCPIP_DNS_ADDRESS_REC_NONE;
 
     if(dnsHE->nIPv4Entries != 0)
@@ -280,12 +322,119 @@ static  TCPIP_DNS_RESULT  _DNSCompleteHashEntry(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_
         dnsHE->ipTTL.Val = TCPIP_DNS_CLIENT_CACHE_DEFAULT_TTL_VAL;
     }
     dnsHE->tRetry = dnsHE->tInsert = pDnsDcpt->dnsTime; 
-    pDnsDcpt->unsolvedEntries--;
-    _DNSAssertCond(pDnsDcpt->unsolvedEntries >= 0, __func__, __LINE__);
 
     return TCPIP_DNS_RES_OK;
 }
 
+// updates the pending queries of an entry
+// solved entries still waiting for answers are counted separately
+static void _DNS_PendingSet(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, uint8_t pendMask)
+{
+    if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0)
+    {
+        if(pDnsHE->pendMask == 0 && pendMask != 0)
+        {
+            pDnsDcpt->solvedPending++;
+        }
+        else if(pDnsHE->pendMask != 0 && pendMask == 0)
+        {
+            pDnsDcpt->solvedPending--;
+            _DNSAssertCond(pDnsDcpt->solvedPending >= 0, __func__, __LINE__);
+        }
+    }
+    pDnsHE->pendMask = pendMask;
+}
+
+// returns the address types still pending for the transaction ID of an entry
+// 0 if the transaction does not match
+static uint8_t _DNS_TransactionMask(TCPIP_DNS_HASH_ENTRY* pDnsHE, uint16_t transactionId)
+{
+    if(pDnsHE->resolve_type == TCPIP_DNS_TYPE_ANY)
+    {   // A and AAAA queried separately
+        if(transactionId == pDnsHE->transactionId6.Val)
+        {
+            return pDnsHE->pendMask & TCPIP_DNS_ADDRESS_REC_IPV6;
+        }
+        if(transactionId == pDnsHE->transactionId.Val)
+        {
+            return pDnsHE->pendMask & TCPIP_DNS_ADDRESS_REC_IPV4;
+        }
+        return 0;
+    }
+
+    return transactionId == pDnsHE->transactionId.Val ? pDnsHE->pendMask : 0;
+}
+
+// returns the result for a negative entry
+static TCPIP_DNS_RESULT _DNS_NegativeResult(TCPIP_DNS_HASH_ENTRY* pDnsHE)
+{
+    return pDnsHE->rCode == TCPIP_DNS_RCODE_NAME_ERROR ? TCPIP_DNS_RES_NAME_ERROR : TCPIP_DNS_RES_SERVER_FAIL;
+}
+
+// turns an entry into a negative one, RFC 2308
+// NXDOMAIN is cached for the SOA minimum TTL; w/o a SOA record, for the unsolved entry timeout
+// SERVFAIL/REFUSED is cached for a fixed time
+static void _DNS_NegativeSet(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, TCPIP_DNS_RR_PROCESS* pProc)
+{
+    uint32_t negTTL;
+
+    _DNS_PendingSet(pDnsDcpt, pDnsHE, 0);   // any other answer for this name is ignored
+    if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
+    {
+        pDnsDcpt->unsolvedEntries--;
+        _DNSAssertCond(pDnsDcpt->unsolvedEntries >= 0, __func__, __LINE__);
+    }
+    pDnsHE->hEntry.flags.value &= ~(TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_TIMEOUT | TCPIP_DNS_FLAG_ENTRY_REFRESH | TCPIP_DNS_FLAG_ENTRY_USED);
+    pDnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_NEGATIVE;
+    pDnsDcpt->negativeEntries++;
+
+    if(pProc->rCode == TCPIP_DNS_RCODE_NAME_ERROR)
+    {
+        negTTL = pProc->soaFound ? pProc->negTTL : TCPIP_DNS_CLIENT_CACHE_UNSOLVED_ENTRY_TMO;
+        if(negTTL > TCPIP_DNS_CLIENT_CACHE_NEGATIVE_TTL_MAX)
+        {
+            negTTL = TCPIP_DNS_CLIENT_CACHE_NEGATIVE_TTL_MAX;
+        }
+    }
+    else
+    {
+        negTTL = TCPIP_DNS_CLIENT_CACHE_SERVER_FAIL_TMO;
+    }
+
+    pDnsHE->rCode = pProc->rCode;
+    pDnsHE->ipTTL.Val = negTTL;
+    pDnsHE->nIPv4Entries = pDnsHE->nIPv6Entries = 0;
+    pDnsHE->recordMask = TCPIP_DNS_ADDRESS_REC_NONE;
+    pDnsHE->tRetry = pDnsHE->tInsert = pDnsDcpt->dnsTime; 
+}
+
+// adds a question for the missing address type to an unsolved A or AAAA entry
+// the query in flight is kept and both are answered in parallel
+static TCPIP_DNS_RESULT _DNS_QueryAdd(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE)
+{
+    TCPIP_DNS_RESULT res;
+    uint8_t addMask;
+
+    if(pDnsHE->resolve_type == TCPIP_DNS_TYPE_AAAA)
+    {   // the AAAA transaction in flight moves to its own slot
+        pDnsHE->transactionId6.Val = pDnsHE->transactionId.Val;
+        addMask = TCPIP_DNS_ADDRESS_REC_IPV4;
+        res = _DNS_Send_Question(pDnsDcpt, pDnsHE, TCPIP_DNS_TYPE_A, &pDnsHE->transactionId);
+    }
+    else
+    {
+        addMask = TCPIP_DNS_ADDRESS_REC_IPV6;
+        res = _DNS_Send_Question(pDnsDcpt, pDnsHE, TCPIP_DNS_TYPE_AAAA, &pDnsHE->transactionId6);
+    }
+
+    pDnsHE->resolve_type = TCPIP_DNS_TYPE_ANY;
+    pDnsHE->recordMask |= addMask;
+    pDnsHE->queryMask |= addMask;
+    _DNS_PendingSet(pDnsDcpt, pDnsHE, pDnsHE->pendMask | addMask);
+
+    return res;
+}
+
 static  void _DNSDeleteCacheEntries(TCPIP_DNS_DCPT* pDnsDcpt)
 {
     size_t          bktIx;
@@ -634,14 +783,31 @@ static TCPIP_DNS_RESULT _DNS_Resolve(const char* hostName, TCPIP_DNS_RESOLVE_TYP
 
     if(forceQuery == 0 && dnsHE->hEntry.flags.newEntry == 0)
     {   // already in hash
-        if((dnsHE->recordMask & recMask) == recMask)
-        {   // already have the requested type
+        if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+        {   // the server already said no; don't ask again until the answer expires
+            pDnsDcpt->nNegCached++;
+            return _DNS_NegativeResult(dnsHE);
+        }
+
+        if((dnsHE->queryMask & recMask) == recMask)
+        {   // already asked for the requested type
+            // a solved entry can be used while the other address type or a refresh is pending
             if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0)
             {
+               dnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_USED;
                return TCPIP_DNS_RES_OK; 
             }
+            // wait for the query in flight
+            pDnsDcpt->nCoalesced++;
             return (dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_TIMEOUT) == 0 ? TCPIP_DNS_RES_PENDING : TCPIP_DNS_RES_SERVER_TMO; 
         }
+
+        if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0 && dnsHE->currNet != 0 &&
+                (dnsHE->resolve_type == TCPIP_DNS_TYPE_A || dnsHE->resolve_type == TCPIP_DNS_TYPE_AAAA))
+        {   // in flight for the other address type: keep it and ask just for the missing one
+            pDnsDcpt->nCoalesced++;
+            return _DNS_QueryAdd(pDnsDcpt, dnsHE);
+        }
         // else new query is needed, for new type
     }
 
@@ -651,10 +817,26 @@ static TCPIP_DNS_RESULT _DNS_Resolve(const char* hostName, TCPIP_DNS_RESOLVE_TYP
     {
         dnsHE->nIPv4Entries = 0;
         dnsHE->nIPv6Entries = 0;
-        dnsHE->hEntry.flags.value &= ~(TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_TIMEOUT);
+        dnsHE->hEntry.flags.value &= ~(TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_TIMEOUT | TCPIP_DNS_FLAG_ENTRY_REFRESH | TCPIP_DNS_FLAG_ENTRY_USED | TCPIP_DNS_FLAG_ENTRY_NEGATIVE);
+        dnsHE->queryMask = 0;
+        dnsHE->recordMask = 0;
+        dnsHE->pendMask = 0;
+        pDnsDcpt->unsolvedEntries++;
     }
     else
     {   // forced
+        _DNS_PendingSet(pDnsDcpt, dnsHE, 0);
+        if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+        {
+            pDnsDcpt->negativeEntries--;
+            pDnsDcpt->unsolvedEntries++;
+        }
+        else if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0)
+        {
+            pDnsDcpt->unsolvedEntries++;
+        }
+        // else already counted as unsolved
+        dnsHE->hEntry.flags.value &= ~(TCPIP_DNS_FLAG_ENTRY_REFRESH | TCPIP_DNS_FLAG_ENTRY_NEGATIVE);
         if((recMask & TCPIP_DNS_ADDRESS_REC_IPV4) != 0)
         {
             dnsHE->nIPv4Entries = 0;
@@ -670,8 +852,8 @@ static TCPIP_DNS_RESULT _DNS_Resolve(const char* hostName, TCPIP_DNS_RESOLVE_TYP
     dnsHE->currServerIx = 0;
     dnsHE->resolve_type = type;
     dnsHE->recordMask |= recMask;
+    dnsHE->queryMask |= recMask;
     dnsHE->tRetry = dnsHE->tInsert = pDnsDcpt->dnsTime;
-    pDnsDcpt->unsolvedEntries++;
     return _DNS_Send_Query(pDnsDcpt, dnsHE);
 }
 
@@ -697,6 +879,7 @@ static int _DNS_GetAddresses(const char* hostName, int startIndex, IP_MULTI_ADDR
         return 0;
     }
 
+    dnsHashEntry->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_USED;
     recMask &= (TCPIP_DNS_ADDRESS_REC_MASK)dnsHashEntry->recordMask;
 
     if(recMask == 0)
@@ -865,12 +1048,18 @@ static TCPIP_DNS_RESULT  _DNS_IsNameResolved(const char* hostName, IPV4_ADDR* ho
         return TCPIP_DNS_RES_NO_NAME_ENTRY;
     }
 
+    if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+    {   // negative answer
+        return _DNS_NegativeResult(pDnsHE);
+    }
+
     if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
     {   // unsolved entry   
         return (pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_TIMEOUT) == 0 ? TCPIP_DNS_RES_PENDING : TCPIP_DNS_RES_SERVER_TMO; 
     }
 
     // completed entry
+    pDnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_USED;
     nIPv6Entries = pDnsHE->nIPv6Entries;
     nIPv4Entries = pDnsHE->nIPv4Entries;
 
@@ -918,6 +1107,11 @@ TCPIP_DNS_RESULT TCPIP_DNS_ClientInfoGet(TCPIP_DNS_CLIENT_INFO* pClientInfo)
         pClientInfo->pendingEntries = pDnsDcpt->unsolvedEntries;
         pClientInfo->currentEntries = pDnsDcpt->hashDcpt->fullSlots;
         pClientInfo->totalEntries = pDnsDcpt->hashDcpt->hEntries;
+        pClientInfo->negativeEntries = pDnsDcpt->negativeEntries;
+        pClientInfo->nQueries = pDnsDcpt->nQueries;
+        pClientInfo->nRetries = pDnsDcpt->nRetries;
+        pClientInfo->nCoalesced = pDnsDcpt->nCoalesced;
+        pClientInfo->nNegCached = pDnsDcpt->nNegCached;
     }
     return TCPIP_DNS_RES_OK;
 }
@@ -983,6 +1177,13 @@ TCPIP_DNS_RESULT TCPIP_DNS_EntryQuery(TCPIP_DNS_ENTRY_QUERY *pDnsQuery, int quer
 
             return TCPIP_DNS_RES_OK;
         }
+        else if((pBkt->flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+        {
+            pDnsQuery->status = _DNS_NegativeResult(pE);
+            pDnsQuery->ttlTime = pE->ipTTL.Val - (pDnsDcpt->dnsTime - pE->tInsert);
+            pDnsQuery->nIPv4ValidEntries = 0;
+            pDnsQuery->nIPv6ValidEntries = 0;
+        }
         else
         {
             pDnsQuery->status = (pE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_TIMEOUT) == 0 ? TCPIP_DNS_RES_PENDING : TCPIP_DNS_RES_SERVER_TMO; 
@@ -1167,106 +1368,154 @@ static void _DNSSocketRxSignalHandler(UDP_SOCKET hUDP, TCPIP_NET_HANDLE hNet, TC
     }
 }
 
+// sends the queries for a hash entry
+// an A + AAAA (TCPIP_DNS_TYPE_ANY) request is sent as 2 separate questions, back to back,
+// so that both address types are resolved in parallel
+// and the entry can be used as soon as the first answer arrives
 static TCPIP_DNS_RESULT _DNS_Send_Query(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE)
 {
-    TCPIP_DNS_HEADER    DNSPutHeader;
-    uint8_t             *wrPtr, *startPtr;
-    uint16_t            sktPayload;
     TCPIP_DNS_EVENT_TYPE evType;
     TCPIP_DNS_RESULT    res;
-    IPV4_ADDR           dnsServerAdd;
-    UDP_SOCKET          dnsSocket = pDnsDcpt->dnsSocket;
+    uint8_t             pendMask;
     
-    pDnsHE->hEntry.flags.value &= ~TCPIP_DNS_FLAG_ENTRY_COMPLETE;
+    if(pDnsHE->resolve_type == TCPIP_DNS_TYPE_ANY)
+    {
+        pendMask = TCPIP_DNS_ADDRESS_REC_IPV4 | TCPIP_DNS_ADDRESS_REC_IPV6;
+    }
+    else if(pDnsHE->resolve_type == TCPIP_DNS_TYPE_AAAA)
+    {
+        pendMask = TCPIP_DNS_ADDRESS_REC_IPV6;
+    }
+    else
+    {
+        pendMask = TCPIP_DNS_ADDRESS_REC_IPV4;
+    }
+    _DNS_PendingSet(pDnsDcpt, pDnsHE, pendMask);
 
     while(true)
     {
-        if(!TCPIP_UDP_PutIsReady(dnsSocket))
+        if(!TCPIP_UDP_PutIsReady(pDnsDcpt->dnsSocket))
         {   // failed to allocate another TX buffer
             res = TCPIP_DNS_RES_SOCKET_ERROR;
-            evType = TCPIP_DNS_EVENT_SOCKET_ERROR;
             break; 
         }
 
         if(!_DNS_SelectIntf(pDnsDcpt, pDnsHE))
         {   // couldn't get an output interface
             res = TCPIP_DNS_RES_NO_INTERFACE;
-            evType = TCPIP_DNS_EVENT_NO_INTERFACE;
             break; 
         }
 
-        // this will put the start pointer at the beginning of the TX buffer
-        TCPIP_UDP_TxOffsetSet(dnsSocket, 0, false);    
-
-        //Get the write pointer:
-        wrPtr = TCPIP_UDP_TxPointerGet(dnsSocket);
-        if(wrPtr == 0)
+        if(pDnsHE->resolve_type == TCPIP_DNS_TYPE_ANY)
         {
-            res = TCPIP_DNS_RES_SOCKET_ERROR;
-            evType = TCPIP_DNS_EVENT_SOCKET_ERROR;
-            break; 
-        }
-
-        // set up the socket
-        TCPIP_UDP_Bind(dnsSocket, IP_ADDRESS_TYPE_IPV4, 0, (IP_MULTI_ADDRESS*)&pDnsHE->currNet->netIPAddr);
-        dnsServerAdd.Val = pDnsHE->currNet->dnsServer[pDnsHE->currServerIx].Val;
-        TCPIP_UDP_DestinationIPAddressSet(dnsSocket, pDnsDcpt->ipAddressType, (IP_MULTI_ADDRESS*)&dnsServerAdd);
-        TCPIP_UDP_DestinationPortSet(dnsSocket, TCPIP_DNS_SERVER_PORT);
-
-        startPtr = wrPtr;
-        // Put DNS query here
-        // Set a new Transaction ID
-        pDnsHE->transactionId.Val = (uint16_t)SYS_RANDOM_PseudoGet();
-        DNSPutHeader.TransactionID.Val = TCPIP_Helper_htons(pDnsHE->transactionId.Val);
-        // Flag -- Standard query with recursion
-        DNSPutHeader.Flags.Val = TCPIP_Helper_htons(0x0100); // Standard query with recursion
-        // Question -- only one question at this time
-        DNSPutHeader.Questions.Val = TCPIP_Helper_htons(0x0001); // questions
-        // Answers set to zero
-        // Name server resource address also set to zero
-        // Additional records also set to zero
-        DNSPutHeader.Answers.Val = DNSPutHeader.AuthoritativeRecords.Val = DNSPutHeader.AdditionalRecords.Val = 0;
-
-        // copy the DNS header to the UDP buffer
-        memcpy(wrPtr, &DNSPutHeader, sizeof(TCPIP_DNS_HEADER));
-        wrPtr += sizeof(TCPIP_DNS_HEADER);
-
-        // Put hostname string to resolve
-        _DNSPutString(&wrPtr, pDnsHE->pHostName);
-
-        // Type: TCPIP_DNS_TYPE_A A (host address) or TCPIP_DNS_TYPE_MX for mail exchange
-        *wrPtr++ = 0x00;
-        *wrPtr++ = pDnsHE->resolve_type;
-
-        // Class: IN (Internet)
-        *wrPtr++ = 0x00;
-        *wrPtr++ = 0x01; // 0x0001
-    
-        // Put complete DNS query packet buffer to the UDP buffer
-        // Once it is completed writing into the buffer, you need to update the Tx offset again,
-        // because the socket flush function calculates how many bytes are in the buffer using the current write pointer:
-        sktPayload = (uint16_t)(wrPtr - startPtr);
-        TCPIP_UDP_TxOffsetSet(dnsSocket, sktPayload, false);
-
-        if(TCPIP_UDP_Flush(dnsSocket) != sktPayload)
-        {
-            res = TCPIP_DNS_RES_SOCKET_ERROR;
-            evType = TCPIP_DNS_EVENT_SOCKET_ERROR;
+            res = _DNS_Send_Question(pDnsDcpt, pDnsHE, TCPIP_DNS_TYPE_A, &pDnsHE->transactionId);
+            if(res == TCPIP_DNS_RES_PENDING)
+            {
+                res = _DNS_Send_Question(pDnsDcpt, pDnsHE, TCPIP_DNS_TYPE_AAAA, &pDnsHE->transactionId6);
+            }
         }
         else
         {
-            res = TCPIP_DNS_RES_PENDING;
-            evType = TCPIP_DNS_EVENT_NAME_QUERY;
+            res = _DNS_Send_Question(pDnsDcpt, pDnsHE, pDnsHE->resolve_type, &pDnsHE->transactionId);
         }
         break;
     }
 
+    if(res == TCPIP_DNS_RES_PENDING)
+    {
+        evType = TCPIP_DNS_EVENT_NAME_QUERY;
+    }
+    else if(res == TCPIP_DNS_RES_NO_INTERFACE)
+    {
+        evType = TCPIP_DNS_EVENT_NO_INTERFACE;
+    }
+    else
+    {
+        evType = TCPIP_DNS_EVENT_SOCKET_ERROR;
+    }
+
     // Send a DNS notification
     evType = evType;    // hush compiler warning if notifications disabled
     _DNSNotifyClients(pDnsDcpt, pDnsHE, evType);
     return res;
 }
 
+// sends one DNS question of the qType for the hash entry
+// on the currently selected interface and server
+// a new transaction ID is stored at pTransId
+static TCPIP_DNS_RESULT _DNS_Send_Question(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* pDnsHE, uint8_t qType, TCPIP_UINT16_VAL* pTransId)
+{
+    TCPIP_DNS_HEADER    DNSPutHeader;
+    uint8_t             *wrPtr, *startPtr;
+    uint16_t            sktPayload;
+    IPV4_ADDR           dnsServerAdd;
+    UDP_SOCKET          dnsSocket = pDnsDcpt->dnsSocket;
+
+    if(!TCPIP_UDP_PutIsReady(dnsSocket))
+    {   // failed to allocate another TX buffer
+        return TCPIP_DNS_RES_SOCKET_ERROR;
+    }
+
+    // this will put the start pointer at the beginning of the TX buffer
+    TCPIP_UDP_TxOffsetSet(dnsSocket, 0, false);    
+
+    //Get the write pointer:
+    wrPtr = TCPIP_UDP_TxPointerGet(dnsSocket);
+    if(wrPtr == 0)
+    {
+        return TCPIP_DNS_RES_SOCKET_ERROR;
+    }
+
+    // set up the socket
+    TCPIP_UDP_Bind(dnsSocket, IP_ADDRESS_TYPE_IPV4, 0, (IP_MULTI_ADDRESS*)&pDnsHE->currNet->netIPAddr);
+    dnsServerAdd.Val = pDnsHE->currNet->dnsServer[pDnsHE->currServerIx].Val;
+    TCPIP_UDP_DestinationIPAddressSet(dnsSocket, pDnsDcpt->ipAddressType, (IP_MULTI_ADDRESS*)&dnsServerAdd);
+    TCPIP_UDP_DestinationPortSet(dnsSocket, TCPIP_DNS_SERVER_PORT);
+
+    startPtr = wrPtr;
+    // Put DNS query here
+    // Set a new Transaction ID
+    pTransId->Val = (uint16_t)SYS_RANDOM_PseudoGet();
+    DNSPutHeader.TransactionID.Val = TCPIP_Helper_htons(pTransId->Val);
+    // Flag -- Standard query with recursion
+    DNSPutHeader.Flags.Val = TCPIP_Helper_htons(0x0100); // Standard query with recursion
+    // Question -- only one question at this time
+    DNSPutHeader.Questions.Val = TCPIP_Helper_htons(0x0001); // questions
+    // Answers set to zero
+    // Name server resource address also set to zero
+    // Additional records also set to zero
+    DNSPutHeader.Answers.Val = DNSPutHeader.AuthoritativeRecords.Val = DNSPutHeader.AdditionalRecords.Val = 0;
+
+    // copy the DNS header to the UDP buffer
+    memcpy(wrPtr, &DNSPutHeader, sizeof(TCPIP_DNS_HEADER));
+    wrPtr += sizeof(TCPIP_DNS_HEADER);
+
+    // Put hostname string to resolve
+    _DNSPutString(&wrPtr, pDnsHE->pHostName);
+
+    // Type: TCPIP_DNS_TYPE_A A (host address), TCPIP_DNS_TYPE_AAAA or TCPIP_DNS_TYPE_MX for mail exchange
+    *wrPtr++ = 0x00;
+    *wrPtr++ = qType;
+
+    // Class: IN (Internet)
+    *wrPtr++ = 0x00;
+    *wrPtr++ = 0x01; // 0x0001
+
+    // Put complete DNS query packet buffer to the UDP buffer
+    // Once it is completed writing into the buffer, you need to update the Tx offset again,
+    // because the socket flush function calculates how many bytes are in the buffer using the current write pointer:
+    sktPayload = (uint16_t)(wrPtr - startPtr);
+    TCPIP_UDP_TxOffsetSet(dnsSocket, sktPayload, false);
+
+    if(TCPIP_UDP_Flush(dnsSocket) != sktPayload)
+    {
+        return TCPIP_DNS_RES_SOCKET_ERROR;
+    }
+
+    pDnsDcpt->nQueries++;
+    return TCPIP_DNS_RES_PENDING;
+}
+
 TCPIP_DNS_RESULT TCPIP_DNS_RemoveEntry(const char *hostName)
 {
     TCPIP_DNS_HASH_ENTRY  *pDnsHE;
@@ -1359,9 +1608,16 @@ static void TCPIP_DNS_CacheTimeout(TCPIP_DNS_DCPT* pDnsDcpt)
                 // if cacheEntryTMO is equal to zero, then TTL time is the timeout period. 
                 if((timeout = pDnsDcpt->cacheEntryTMO) == 0)
                 {
-                    timeout = pDnsHE->ipTTL.Val;
+                    if((timeout = pDnsHE->ipTTL.Val) == 0)
+                    {   // refresh answer being processed
+                        timeout = TCPIP_DNS_CLIENT_CACHE_DEFAULT_TTL_VAL;
+                    }
                 }
             }
+            else if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+            {   // negative entry: its own TTL
+                timeout = pDnsHE->ipTTL.Val;
+            }
             else
             {   // unsolved entry
                 timeout = TCPIP_DNS_CLIENT_CACHE_UNSOLVED_ENTRY_TMO;
@@ -1371,12 +1627,36 @@ static void TCPIP_DNS_CacheTimeout(TCPIP_DNS_DCPT* pDnsDcpt)
             {
                 _DNS_UpdateExpiredHashEntry_Notify(pDnsDcpt, pDnsHE);
             }
-            else if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0 && (currTime - pDnsHE->tRetry) >= TCPIP_DNS_CLIENT_LOOKUP_RETRY_TMO)
+            else if((pDnsHE->hEntry.flags.value & (TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_NEGATIVE)) == 0 && (currTime - pDnsHE->tRetry) >= TCPIP_DNS_CLIENT_LOOKUP_RETRY_TMO)
             {   // send further probes for unsolved entries
+                pDnsDcpt->nRetries++;
                 _DNS_Send_Query(pDnsDcpt, pDnsHE);
                 pDnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_TIMEOUT;
                 pDnsHE->tRetry = currTime;
             }
+#if (TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT != 0)
+            else if((pDnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_REFRESH) != 0)
+            {   // refresh in progress; the old addresses are still valid
+                if(pDnsHE->pendMask != 0 && (currTime - pDnsHE->tRetry) >= TCPIP_DNS_CLIENT_LOOKUP_RETRY_TMO)
+                {
+                    pDnsDcpt->nRetries++;
+                    _DNS_Send_Query(pDnsDcpt, pDnsHE);
+                    pDnsHE->tRetry = currTime;
+                }
+            }
+            else if((pDnsHE->hEntry.flags.value & (TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_USED)) == (TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_USED))
+            {   // entry in use: re-query it before it expires so that the users never wait for it
+                if((currTime - pDnsHE->tInsert) >= (timeout * TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT) / 100)
+                {
+                    pDnsHE->hEntry.flags.value &= ~TCPIP_DNS_FLAG_ENTRY_USED;
+                    pDnsHE->hEntry.flags.value |= TCPIP_DNS_FLAG_ENTRY_REFRESH;
+                    pDnsHE->currNet = 0;     // re-select the interface and server
+                    pDnsHE->currServerIx = 0;
+                    _DNS_Send_Query(pDnsDcpt, pDnsHE);
+                    pDnsHE->tRetry = currTime;
+                }
+            }
+#endif  // (TCPIP_DNS_CLIENT_CACHE_PREFETCH_PERCENT != 0)
         }
     } 
 }
@@ -1404,8 +1684,8 @@ static void TCPIP_DNS_ClientProcess(bool isTmo)
             break;
         }
 
-        _DNSDbgCond(pDnsDcpt->unsolvedEntries != 0, __func__, __LINE__);
-        if(pDnsDcpt->unsolvedEntries != 0)
+        _DNSDbgCond(pDnsDcpt->unsolvedEntries != 0 || pDnsDcpt->solvedPending != 0, __func__, __LINE__);
+        if(pDnsDcpt->unsolvedEntries != 0 || pDnsDcpt->solvedPending != 0)
         {   // waiting for a reply; process the packet
             _DNS_ProcessPacket(pDnsDcpt);
         }
@@ -1421,13 +1701,15 @@ static void TCPIP_DNS_ClientProcess(bool isTmo)
 
 // extracts the IPv4/IPv6 addresses and updates the hash entry if dnsHE != 0
 // if dnsHE == 0, than it just discards
+// the addresses of a solved entry are replaced only when the first new address of that type is found
 // returns true if processing was successful
 // false if some error occurred
-static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* dnsHE)
+static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RR_PROCESS* pProc, TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_HASH_ENTRY* dnsHE)
 {
     TCPIP_DNS_ANSWER_HEADER DNSAnswerHeader;    
     IP_MULTI_ADDRESS        ipAddr;
     bool                    discardData;
+    TCPIP_DNS_RX_DATA*      dnsRxData = pProc->dnsRxData;
 
     if(!_DNSGetData(dnsRxData, (uint8_t *)&DNSAnswerHeader, sizeof(TCPIP_DNS_ANSWER_HEADER)))
     {   // failed to read the RR header
@@ -1444,6 +1726,12 @@ static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DN
     {
         if (DNSAnswerHeader.ResponseType.Val == TCPIP_DNS_TYPE_A && DNSAnswerHeader.ResponseLen.Val == 4)
         {            
+            if((pProc->clrMask & TCPIP_DNS_ADDRESS_REC_IPV4) != 0)
+            {   // first new IPv4 address: replace the old ones
+                pProc->clrMask &= ~TCPIP_DNS_ADDRESS_REC_IPV4;
+                dnsHE->nIPv4Entries = 0;
+            }
+
             if(dnsHE->nIPv4Entries >= pDnsDcpt->nIPv4Entries)
             {   // we have enough IPv4 entries
                 break;
@@ -1456,6 +1744,11 @@ static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DN
             }
 
             discardData = false;
+            if(pProc->ttlReset)
+            {   // refresh: the new answer sets the TTL
+                pProc->ttlReset = false;
+                dnsHE->ipTTL.Val = 0;
+            }
             // update the Hash entry for IPv4 address
             dnsHE->pip4Address[dnsHE->nIPv4Entries].Val = ipAddr.v4Add.Val;
             if((DNSAnswerHeader.ResponseTTL.Val < dnsHE->ipTTL.Val) || (dnsHE->ipTTL.Val == 0))
@@ -1469,8 +1762,19 @@ static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DN
 
         if (DNSAnswerHeader.ResponseType.Val == TCPIP_DNS_TYPE_AAAA && DNSAnswerHeader.ResponseLen.Val == 16)
         {
-            if((dnsHE->recordMask & TCPIP_DNS_ADDRESS_REC_IPV6) == 0 || (dnsHE->nIPv6Entries >= pDnsDcpt->nIPv6Entries))
-            {   // not needed or enough IPvr entries
+            if((dnsHE->queryMask & TCPIP_DNS_ADDRESS_REC_IPV6) == 0)
+            {   // not needed
+                break;
+            }           
+
+            if((pProc->clrMask & TCPIP_DNS_ADDRESS_REC_IPV6) != 0)
+            {   // first new IPv6 address: replace the old ones
+                pProc->clrMask &= ~TCPIP_DNS_ADDRESS_REC_IPV6;
+                dnsHE->nIPv6Entries = 0;
+            }
+
+            if(dnsHE->nIPv6Entries >= pDnsDcpt->nIPv6Entries)
+            {   // enough IPv6 entries
                 break;
             }           
 
@@ -1481,6 +1785,11 @@ static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DN
             }
 
             discardData = false;
+            if(pProc->ttlReset)
+            {   // refresh: the new answer sets the TTL
+                pProc->ttlReset = false;
+                dnsHE->ipTTL.Val = 0;
+            }
             // update the Hash entry for IPv6 address
             memcpy( &dnsHE->pip6Address[dnsHE->nIPv6Entries], ipAddr.v6Add.v, sizeof(IPV6_ADDR));
             if((DNSAnswerHeader.ResponseTTL.Val < dnsHE->ipTTL.Val) || (dnsHE->ipTTL.Val == 0))
@@ -1506,13 +1815,45 @@ static bool _DNS_RESPONSE_HashEntryUpdate(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DN
     return true;
 }
 
+// reads a RR of a negative answer
+// a SOA record sets the negative answer TTL: min(SOA TTL, SOA MINIMUM), RFC 2308
+// returns false if the RR could not be read
+static bool _DNS_ReadSoaTTL(TCPIP_DNS_RX_DATA* dnsRxData, TCPIP_DNS_RR_PROCESS* pProc)
+{
+    TCPIP_DNS_ANSWER_HEADER DNSAnswerHeader;    
+    TCPIP_UINT32_VAL        soaMin;
+
+    if(!_DNSGetData(dnsRxData, (uint8_t *)&DNSAnswerHeader, sizeof(TCPIP_DNS_ANSWER_HEADER)))
+    {   // failed to read the RR header
+        return false;
+    }
+
+    _SwapDNSAnswerPacket(&DNSAnswerHeader);
+
+    if(DNSAnswerHeader.ResponseType.Val != TCPIP_DNS_RECORD_TYPE_SOA || DNSAnswerHeader.ResponseClass.Val != 1 || DNSAnswerHeader.ResponseLen.Val < sizeof(soaMin))
+    {   // discard
+        return _DNSGetData(dnsRxData, 0, DNSAnswerHeader.ResponseLen.Val);
+    }
+
+    // MINIMUM is the last field of the SOA data
+    if(!_DNSGetData(dnsRxData, 0, DNSAnswerHeader.ResponseLen.Val - sizeof(soaMin)) || !_DNSGetData(dnsRxData, soaMin.v, sizeof(soaMin)))
+    {
+        return false;
+    }
+
+    soaMin.Val = TCPIP_Helper_ntohl(soaMin.Val);
+    pProc->negTTL = DNSAnswerHeader.ResponseTTL.Val < soaMin.Val ? DNSAnswerHeader.ResponseTTL.Val : soaMin.Val;
+    pProc->soaFound = true;
+    return true;
+}
+
 static TCPIP_DNS_HASH_ENTRY* _DNSHashEntryFromTransactionId(TCPIP_DNS_DCPT* pDnsDcpt, const char* hostName, uint16_t transactionId)
 {
     TCPIP_DNS_HASH_ENTRY* pDnsHE;
     pDnsHE = (TCPIP_DNS_HASH_ENTRY*)TCPIP_OAHASH_EntryLookup(pDnsDcpt->hashDcpt, hostName);
     if(pDnsHE != 0)
     {
-        if(pDnsHE->transactionId.Val == transactionId)
+        if(_DNS_TransactionMask(pDnsHE, transactionId) != 0)
         {
             return pDnsHE;
         }
@@ -1608,8 +1949,8 @@ static int _DNS_ProcessRR(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_RR_PROCESS* pProc,
 
         if(dnsHE != 0)
         {
-            if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0)
-            {
+            if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0 && _DNS_TransactionMask(dnsHE, pProc->dnsHeader->TransactionID.Val) == 0)
+            {   // nothing pending for a solved entry
                 evDbgType = TCPIP_DNS_DBG_EVENT_COMPLETE_ERROR;
                 break;
             }
@@ -1617,6 +1958,18 @@ static int _DNS_ProcessRR(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_RR_PROCESS* pProc,
             if(pProc->dnsHE == 0)
             {
                 pProc->dnsHE = dnsHE;
+                pProc->ansMask = _DNS_TransactionMask(dnsHE, pProc->dnsHeader->TransactionID.Val);
+                if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0 && pProc->rCode == TCPIP_DNS_RCODE_NO_ERROR)
+                {   // refresh or the other address type of a parallel query
+                    // the new addresses replace the old ones of their type
+                    // an empty answer leaves the old addresses in place
+                    if((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_REFRESH) != 0)
+                    {
+                        dnsHE->hEntry.flags.value &= ~TCPIP_DNS_FLAG_ENTRY_REFRESH;
+                        pProc->ttlReset = true;
+                    }
+                    pProc->clrMask = pProc->ansMask;
+                }
             }
             else if(pProc->dnsHE != dnsHE)
             {
@@ -1634,9 +1987,17 @@ static int _DNS_ProcessRR(TCPIP_DNS_DCPT* pDnsDcpt, TCPIP_DNS_RR_PROCESS* pProc,
                 break;
             }
         }
+        else if(pProc->rCode != TCPIP_DNS_RCODE_NO_ERROR)
+        {   // negative answer: only the SOA TTL is of interest
+            if(!_DNS_ReadSoaTTL(pProc->dnsRxData, pProc))
+            {
+                evDbgType = TCPIP_DNS_DBG_EVENT_RR_DATA_ERROR;
+                break;
+            }
+        }
         else
         {
-            bool entryUpdate = _DNS_RESPONSE_HashEntryUpdate(pProc->dnsRxData, pDnsDcpt, dnsHE);
+            bool entryUpdate = _DNS_RESPONSE_HashEntryUpdate(pProc, pDnsDcpt, dnsHE);
             if(entryUpdate == false)
             {
                 evDbgType = TCPIP_DNS_DBG_EVENT_RR_DATA_ERROR;
@@ -1699,14 +2060,21 @@ static bool _DNS_ProcessPacket(TCPIP_DNS_DCPT* pDnsDcpt)
     procRR.dnsRxData = &dnsRxData;
     procRR.dnsPacketSize = dnsPacketSize;
     procRR.dnsHE = 0;
+    procRR.ansMask = 0;
+    procRR.clrMask = 0;
+    procRR.ttlReset = false;
+    procRR.rCode = DNSHeader.Flags.v[0] & TCPIP_DNS_RCODE_MASK;
+    procRR.soaFound = false;
+    procRR.negTTL = 0;
 
     while(true)
     {
         dnsHE = 0;
         procFail = false;
 
-        if((DNSHeader.Flags.v[0] & 0x03) != 0)
-        {   
+        if(procRR.rCode != TCPIP_DNS_RCODE_NO_ERROR && procRR.rCode != TCPIP_DNS_RCODE_NAME_ERROR &&
+                procRR.rCode != TCPIP_DNS_RCODE_SERVER_FAIL && procRR.rCode != TCPIP_DNS_RCODE_REFUSED)
+        {   // format error, not implemented, etc.
             evType = TCPIP_DNS_EVENT_NAME_ERROR;
             procFail = true;
             break;
@@ -1733,8 +2101,20 @@ static bool _DNS_ProcessPacket(TCPIP_DNS_DCPT* pDnsDcpt)
         // save the entry
         dnsHE = procRR.dnsHE;
 
+        if(procRR.rCode != TCPIP_DNS_RCODE_NO_ERROR)
+        {   // negative answer for one of our names
+            if(dnsHE != 0)
+            {
+                evType = TCPIP_DNS_EVENT_NAME_ERROR;
+            }
+            procFail = true;
+            break;
+        }
+
         // finally
-        if(dnsHE != 0 && (dnsHE->nIPv4Entries > 0 || dnsHE->nIPv6Entries > 0))
+        // a solved entry is updated only if the answer brought new addresses
+        if(dnsHE != 0 && (dnsHE->nIPv4Entries > 0 || dnsHE->nIPv6Entries > 0) &&
+                ((dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0 || procRR.clrMask != procRR.ansMask))
         {
             evType = TCPIP_DNS_EVENT_NAME_RESOLVED;
         }           
@@ -1747,6 +2127,11 @@ static bool _DNS_ProcessPacket(TCPIP_DNS_DCPT* pDnsDcpt)
         break;
     }
 
+    if(procRR.dnsHE != 0 && evType != TCPIP_DNS_EVENT_NAME_ERROR)
+    {   // answer received for these address types
+        _DNS_PendingSet(pDnsDcpt, procRR.dnsHE, procRR.dnsHE->pendMask & ~procRR.ansMask);
+    }
+
     if(evType != TCPIP_DNS_EVENT_NONE)
     {
         _DNSNotifyClients(pDnsDcpt, dnsHE, evType);
@@ -1756,8 +2141,16 @@ static bool _DNS_ProcessPacket(TCPIP_DNS_DCPT* pDnsDcpt)
             _DNSCompleteHashEntry(pDnsDcpt, dnsHE);
         }
         else if(evType == TCPIP_DNS_EVENT_NAME_ERROR && dnsHE != 0)
-        {   // Remove name if "No Such name"
-            TCPIP_DNS_RemoveEntry(dnsHE->pHostName);
+        {   // cache the negative answer
+            // a failing server doesn't invalidate addresses already known
+            if(procRR.rCode == TCPIP_DNS_RCODE_NAME_ERROR || (dnsHE->hEntry.flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) == 0)
+            {
+                _DNS_NegativeSet(pDnsDcpt, dnsHE, &procRR);
+            }
+            else
+            {
+                _DNS_PendingSet(pDnsDcpt, dnsHE, dnsHE->pendMask & ~procRR.ansMask);
+            }
         }
     }
     else if (evDbgType != TCPIP_DNS_DBG_EVENT_NONE)
@@ -1952,7 +2345,7 @@ static size_t TCPIP_DNS_OAHASH_KeyHash(OA_HASH_DCPT* pOH, const void* key)
 
     dnsHostNameKey = (uint8_t *)key;
     hostnameLen = strlen((const char*)dnsHostNameKey);
-    return fnv_32_hash(dnsHostNameKey, hostnameLen) % (pOH->hEntries);
+    return xxh_32_hash(dnsHostNameKey, hostnameLen, 0) % (pOH->hEntries);
 }
 
 
@@ -1971,13 +2364,25 @@ static OA_HASH_ENTRY* TCPIP_DNS_OAHASH_DeleteEntry(OA_HASH_DCPT* pOH)
     for(bktIx = 0; bktIx < pOH->hEntries; bktIx++)
     {
         pBkt = TCPIP_OAHASH_EntryGet(pOH, bktIx);       
-        if(pBkt->flags.busy != 0 && (pBkt->flags.value & TCPIP_DNS_FLAG_ENTRY_COMPLETE) != 0)
+        if(pBkt->flags.busy != 0 && (pBkt->flags.value & (TCPIP_DNS_FLAG_ENTRY_COMPLETE | TCPIP_DNS_FLAG_ENTRY_NEGATIVE)) != 0)
         {
             pE = (TCPIP_DNS_HASH_ENTRY*)pBkt;
-            timeout = (pDnsDcpt->cacheEntryTMO > 0) ? pDnsDcpt->cacheEntryTMO : pE->ipTTL.Val;
+            if((pBkt->flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+            {
+                timeout = pE->ipTTL.Val;
+            }
+            else
+            {
+                timeout = (pDnsDcpt->cacheEntryTMO > 0) ? pDnsDcpt->cacheEntryTMO : pE->ipTTL.Val;
+            }
 
             if((currTime - pE->tInsert) >= timeout)
             {
+                if((pBkt->flags.value & TCPIP_DNS_FLAG_ENTRY_NEGATIVE) != 0)
+                {
+                    pDnsDcpt->negativeEntries--;
+                }
+                _DNS_PendingSet(pDnsDcpt, pE, 0);
                 _DNSNotifyClients(pDnsDcpt, pE, TCPIP_DNS_EVENT_NAME_REMOVED);
                 return pBkt;
             }
@@ -106,10 +106,30 @@ typedef enum
     TCPIP_DNS_FLAG_ENTRY_COMPLETE     = 0x0080,     // regular entry, complete
                                                     // else it's incomplete
     TCPIP_DNS_FLAG_ENTRY_TIMEOUT      = 0x0100,     // entry has timed out
+    TCPIP_DNS_FLAG_ENTRY_REFRESH      = 0x0200,     // solved entry being refreshed before it expires
+                                                    // the old addresses are still used until the answer arrives
+    TCPIP_DNS_FLAG_ENTRY_USED         = 0x0400,     // solved entry was accessed since the last refresh
+    TCPIP_DNS_FLAG_ENTRY_NEGATIVE     = 0x0800,     // negative answer cached: rCode, ipTTL
                                                   
 }TCPIP_DNS_HASH_ENTRY_FLAGS;
 
 
+// DNS header response codes
+typedef enum
+{
+    TCPIP_DNS_RCODE_NO_ERROR        = 0,    // no error
+    TCPIP_DNS_RCODE_FORMAT_ERROR    = 1,    // the server could not interpret the query
+    TCPIP_DNS_RCODE_SERVER_FAIL     = 2,    // server failure
+    TCPIP_DNS_RCODE_NAME_ERROR      = 3,    // NXDOMAIN: the name does not exist
+    TCPIP_DNS_RCODE_NOT_IMPLEMENTED = 4,    // query type not supported
+    TCPIP_DNS_RCODE_REFUSED         = 5,    // the server refused the query
+
+    TCPIP_DNS_RCODE_MASK            = 0x0f, // mask in the low byte of the header flags
+}TCPIP_DNS_RCODE;
+
+// record types used internally
+#define TCPIP_DNS_RECORD_TYPE_SOA   6       // start of authority
+
 typedef enum
 {
     TCPIP_DNS_ADDRESS_REC_NONE  = 0x0,      // no type
@@ -130,13 +150,16 @@ typedef struct
     TCPIP_NET_IF*               currNet;        // current Interface used 
     char*                       pHostName;
     // unaligned members
-    TCPIP_UINT16_VAL            transactionId;
+    TCPIP_UINT16_VAL            transactionId;  // A or single query transaction
+    TCPIP_UINT16_VAL            transactionId6; // AAAA transaction, when A and AAAA are queried in parallel
     uint8_t                     nIPv4Entries;   // number of valid entries in the ip4Address[] array;
     uint8_t                     nIPv6Entries;   // number of valid entries in the ip6Address[] array;
     uint8_t                     resolve_type;   // TCPIP_DNS_RESOLVE_TYPE value
     uint8_t                     currServerIx;   // current server used
     uint8_t                     recordMask;     // a TCPIP_DNS_ADDRESS_REC_MASK mask: IPv6/IPv4 
-    uint8_t                     padding[1];     // padding, unused
+    uint8_t                     queryMask;      // a TCPIP_DNS_ADDRESS_REC_MASK mask: address types requested for this entry
+    uint8_t                     pendMask;       // a TCPIP_DNS_ADDRESS_REC_MASK mask: queries still waiting for an answer
+    uint8_t                     rCode;          // TCPIP_DNS_RCODE of a negative entry
 }TCPIP_DNS_HASH_ENTRY;
 
 
@@ -158,6 +181,14 @@ typedef struct
     uint16_t                nIPv6Entries;
     UDP_SOCKET              dnsSocket;                      // Socket used by DHCP Server
     int16_t                 unsolvedEntries;                // number of entries in the cache that need to be solved
+    int16_t                 solvedPending;                  // number of solved entries still waiting for an answer:
+                                                            // refresh or the other address type of a parallel query
+    int16_t                 negativeEntries;                // number of cached negative answers
+    // statistics
+    uint32_t                nQueries;                       // queries sent
+    uint32_t                nRetries;                       // queries sent again
+    uint32_t                nCoalesced;                     // resolve requests joined to a query in flight
+    uint32_t                nNegCached;                     // resolve requests answered from the negative cache
 }TCPIP_DNS_DCPT;    // DNS descriptor
 
 
@@ -216,6 +247,12 @@ typedef struct
     TCPIP_DNS_RX_DATA*      dnsRxData;  // current pointer into the packet
     uint16_t                dnsPacketSize;  // packet size
     TCPIP_DNS_HASH_ENTRY*   dnsHE;          // associated hash entry
+    uint8_t                 ansMask;        // TCPIP_DNS_ADDRESS_REC_MASK: address type(s) this answer is for
+    uint8_t                 clrMask;        // TCPIP_DNS_ADDRESS_REC_MASK: old addresses to be replaced by the new ones
+    bool                    ttlReset;       // refresh answer: the TTL is reset by the first new address
+    uint8_t                 rCode;          // TCPIP_DNS_RCODE of the packet
+    bool                    soaFound;       // SOA record found in a negative answer
+    uint32_t                negTTL;         // negative answer TTL, from the SOA
     TCPIP_DNS_DBG_EVENT_TYPE evDbgType;     // associated parsing event, if any
 }TCPIP_DNS_RR_PROCESS;
 
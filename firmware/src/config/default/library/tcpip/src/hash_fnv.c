@@ -67,6 +67,8 @@ FNV Code terms of use:
 
 
 
+#include <string.h>
+
 #include "tcpip/src/hash_fnv.h"
 
 
@@ -111,4 +113,150 @@ uint32_t fnv_32a_hash(const void *key, size_t keyLen)
     return hval;
 }
 
+// xxHash32 implementation
+
+static __inline__ uint32_t __attribute__((always_inline)) _xxh_rotl(uint32_t x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static __inline__ uint32_t __attribute__((always_inline)) _xxh_read32(const uint8_t* p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));   // unaligned read; the target is little endian
+    return w;
+}
+
+static __inline__ uint32_t __attribute__((always_inline)) _xxh_round(uint32_t acc, uint32_t w)
+{
+    acc += w * XXH_32_PRIME2;
+    acc = _xxh_rotl(acc, 13);
+    return acc * XXH_32_PRIME1;
+}
+
+// processes the 16 byte rounds; returns the number of bytes consumed
+static size_t _xxh_rounds(uint32_t* v, const uint8_t* p, size_t len)
+{
+    const uint8_t* pStart = p;
+    uint32_t v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];
+
+    while(len >= 16)
+    {
+        v0 = _xxh_round(v0, _xxh_read32(p));
+        v1 = _xxh_round(v1, _xxh_read32(p + 4));
+        v2 = _xxh_round(v2, _xxh_read32(p + 8));
+        v3 = _xxh_round(v3, _xxh_read32(p + 12));
+        p += 16;
+        len -= 16;
+    }
+
+    v[0] = v0; v[1] = v1; v[2] = v2; v[3] = v3;
+    return p - pStart;
+}
+
+// merges the accumulators and the remaining (< 16) bytes
+static uint32_t _xxh_finalize(const uint32_t* v, uint32_t totLen, uint32_t seed, const uint8_t* p, size_t len)
+{
+    uint32_t h;
+
+    if(totLen >= 16)
+    {
+        h = _xxh_rotl(v[0], 1) + _xxh_rotl(v[1], 7) + _xxh_rotl(v[2], 12) + _xxh_rotl(v[3], 18);
+    }
+    else
+    {
+        h = seed + XXH_32_PRIME5;
+    }
+    h += totLen;
+
+    while(len >= 4)
+    {
+        h += _xxh_read32(p) * XXH_32_PRIME3;
+        h = _xxh_rotl(h, 17) * XXH_32_PRIME4;
+        p += 4;
+        len -= 4;
+    }
+
+    while(len != 0)
+    {
+        h += (*p++) * XXH_32_PRIME5;
+        h = _xxh_rotl(h, 11) * XXH_32_PRIME1;
+        len--;
+    }
+
+    h ^= h >> 15;
+    h *= XXH_32_PRIME2;
+    h ^= h >> 13;
+    h *= XXH_32_PRIME3;
+    h ^= h >> 16;
+
+    return h;
+}
+
+static __inline__ void __attribute__((always_inline)) _xxh_seed(uint32_t* v, uint32_t seed)
+{
+    v[0] = seed + XXH_32_PRIME1 + XXH_32_PRIME2;
+    v[1] = seed + XXH_32_PRIME2;
+    v[2] = seed;
+    v[3] = seed - XXH_32_PRIME1;
+}
+
+uint32_t xxh_32_hash(const void *key, size_t keyLen, uint32_t seed)
+{
+    uint32_t v[4];
+    size_t   done;
+    const uint8_t* p = (const uint8_t*)key;
+
+    _xxh_seed(v, seed);
+    done = _xxh_rounds(v, p, keyLen);
+
+    return _xxh_finalize(v, keyLen, seed, p + done, keyLen - done);
+}
+
+void xxh_32_init(XXH_32_STATE* pState, uint32_t seed)
+{
+    _xxh_seed(pState->v, seed);
+    pState->totLen = 0;
+    pState->seed = seed;
+    pState->memSize = 0;
+}
+
+void xxh_32_update(XXH_32_STATE* pState, const void *data, size_t dataLen)
+{
+    size_t   fill;
+    const uint8_t* p = (const uint8_t*)data;
+
+    pState->totLen += dataLen;
+
+    if(pState->memSize != 0)
+    {   // complete the partial round
+        fill = sizeof(pState->mem) - pState->memSize;
+        if(dataLen < fill)
+        {
+            memcpy(pState->mem + pState->memSize, p, dataLen);
+            pState->memSize += dataLen;
+            return;
+        }
+        memcpy(pState->mem + pState->memSize, p, fill);
+        _xxh_rounds(pState->v, pState->mem, sizeof(pState->mem));
+        p += fill;
+        dataLen -= fill;
+        pState->memSize = 0;
+    }
+
+    fill = _xxh_rounds(pState->v, p, dataLen);
+    p += fill;
+    dataLen -= fill;
+
+    if(dataLen != 0)
+    {   // save the leftover
+        memcpy(pState->mem, p, dataLen);
+        pState->memSize = dataLen;
+    }
+}
+
+uint32_t xxh_32_final(const XXH_32_STATE* pState)
+{
+    return _xxh_finalize(pState->v, pState->totLen, pState->seed, pState->mem, pState->memSize);
+}
 
@@ -86,6 +86,63 @@ uint32_t fnv_32_hash(const void *key, size_t keyLen);
 uint32_t fnv_32a_hash(const void *key, size_t keyLen);
 
 
+// compile time FNV-1a hash of a string literal, not including the terminating \0
+// same result as fnv_32a_hash(s, strlen(s))
+// for example: FNV_32A_LITERAL("https") == 0xdedea8e2
+// The string has to be a literal of at most FNV_32A_LITERAL_MAX characters,
+// longer strings fail to compile.
+// Note: the result is folded by the compiler but it's not an integer constant expression;
+// it cannot be used as a case label.
+#define FNV_32A_LITERAL_MAX     32
+
+#define FNV_32A_LITERAL(s)  ((uint32_t)(0 * sizeof(char[(sizeof(s) <= FNV_32A_LITERAL_MAX + 1) ? 1 : -1]) + \
+        _FNV_32A_LIT8(_FNV_32A_LIT8(_FNV_32A_LIT8(_FNV_32A_LIT8(FNV_32_INIT, s, 0), s, 8), s, 16), s, 24)))
+
+// one FNV-1a round of the s[i] character; h is not changed past the end of s
+#define _FNV_32A_LIT1(h, s, i)  ((uint32_t)(((h) ^ (uint8_t)((i) < sizeof(s) - 1 ? (s)[(i) < sizeof(s) - 1 ? (i) : 0] : 0)) * \
+                                ((i) < sizeof(s) - 1 ? FNV_32_PRIME : 1u)))
+#define _FNV_32A_LIT2(h, s, i)  _FNV_32A_LIT1(_FNV_32A_LIT1(h, s, i), s, (i) + 1)
+#define _FNV_32A_LIT4(h, s, i)  _FNV_32A_LIT2(_FNV_32A_LIT2(h, s, i), s, (i) + 2)
+#define _FNV_32A_LIT8(h, s, i)  _FNV_32A_LIT4(_FNV_32A_LIT4(h, s, i), s, (i) + 4)
+
+
+
+// xxHash32: word at a time hash, 16 bytes per round
+// much faster than FNV for keys longer than a few bytes,
+// with a better distribution.
+// The data is read as little endian 32-bit words, unaligned access is allowed.
+
+#define XXH_32_PRIME1   ((uint32_t)0x9E3779B1ul)
+#define XXH_32_PRIME2   ((uint32_t)0x85EBCA77ul)
+#define XXH_32_PRIME3   ((uint32_t)0xC2B2AE3Dul)
+#define XXH_32_PRIME4   ((uint32_t)0x27D4EB2Ful)
+#define XXH_32_PRIME5   ((uint32_t)0x165667B1ul)
+
+// state of a streaming xxHash32 calculation
+typedef struct
+{
+    uint32_t    v[4];       // accumulators
+    uint32_t    totLen;     // total number of bytes hashed so far
+    uint32_t    seed;       // hash seed
+    uint8_t     mem[16];    // partial round data
+    uint32_t    memSize;    // bytes in mem
+}XXH_32_STATE;
+
+
+// one shot hash
+uint32_t xxh_32_hash(const void *key, size_t keyLen, uint32_t seed);
+
+
+// streaming API:
+// xxh_32_init(), then xxh_32_update() for each piece of data, then xxh_32_final()
+// produces the same result as xxh_32_hash() over the concatenated data
+void     xxh_32_init(XXH_32_STATE* pState, uint32_t seed);
+
+void     xxh_32_update(XXH_32_STATE* pState, const void *data, size_t dataLen);
+
+uint32_t xxh_32_final(const XXH_32_STATE* pState);
+
+
 
 #endif  // _HASH_FNV_H_
 
@@ -100,10 +100,26 @@ typedef struct  _TAG_ICMP_LIST_NODE
 }ICMP_LIST_NODE;
 
 
-static TCPIP_ICMP_ECHO_REQUEST     icmpEchoRequest;            // one and only request (for now)
-static TCPIP_ICMP_ECHO_REQUEST*    pIcmpEchoRequest = 0;       // one and only request (for now)
-static uint32_t                    icmpEchoStart;              // tick when the request started 
-static uint32_t                    icmpEchoTmo;                // # of ticks for a request to time out 
+// maximum number of echo requests that can be in flight at the same time
+#if !defined(TCPIP_ICMP_MAX_ECHO_REQUESTS)
+#define TCPIP_ICMP_MAX_ECHO_REQUESTS    4
+#endif
+
+// descriptor of an outstanding echo request
+typedef struct _TAG_ICMP_ECHO_DCPT
+{
+    struct _TAG_ICMP_ECHO_DCPT* next;       // next node in list
+                                            // makes it valid SGL_LIST_NODE node
+    TCPIP_ICMP_ECHO_REQUEST     echoReq;    // copy of the user request
+    uint64_t                    txCount;    // SYS_TMR_SystemCountGet() when the request was transmitted
+    uint32_t                    rttUs;      // round trip time, microseconds; valid when the reply is received
+    uint32_t                    txTick;     // tick when the request was transmitted; used for timeout
+}ICMP_ECHO_DCPT;
+
+static ICMP_ECHO_DCPT       icmpEchoPool[TCPIP_ICMP_MAX_ECHO_REQUESTS]; // requests storage
+static SINGLE_LIST          icmpEchoFreeList;           // available descriptors
+static SINGLE_LIST          icmpEchoBusyList;           // requests in flight, oldest first
+static uint32_t             icmpEchoTmo;                // # of ticks for a request to time out 
 
 #endif
 
@@ -123,6 +139,9 @@ static bool _ICMPProcessEchoRequest(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRxP
 static IPV4_PACKET * _ICMPAllocateTxPacketStruct (uint16_t totICMPLen);
 static bool _ICMPTxPktAcknowledge(TCPIP_MAC_PACKET* pkt, const void* ackParam);
 static void  TCPIP_ICMP_Timeout(void);
+static void _ICMPEchoListsInit(void);
+static ICMP_ECHO_DCPT* _ICMPEchoFind(uint16_t identifier, uint16_t sequenceNumber, uint32_t srcAdd);
+static void _ICMPEchoRelease(ICMP_ECHO_DCPT* pDcpt);
 #if (_TCPIP_ICMP_CLIENT_USER_NOTIFICATION != 0)
 static void _ICMPNotifyClients(TCPIP_NET_HANDLE hNetIf, IPV4_ADDR * remoteIP, void * data);
 #else
@@ -174,7 +193,7 @@ bool TCPIP_ICMP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
                 break;
             }
 #if defined(TCPIP_STACK_USE_ICMP_CLIENT)
-            pIcmpEchoRequest = 0;        // one and only request (for now)
+            _ICMPEchoListsInit();
             icmpEchoTmo = 0;
 #if (_TCPIP_ICMP_CLIENT_USER_NOTIFICATION != 0)
             iniRes = TCPIP_Notification_Initialize(&icmpRegisteredUsers);
@@ -276,6 +295,10 @@ static IPV4_PACKET * _ICMPAllocateTxPacketStruct (uint16_t totICMPLen)
     {
         TCPIP_PKT_PacketAcknowledgeSet(&ptrPacket->macPkt, _ICMPTxPktAcknowledge, 0);
     }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
 
     return ptrPacket;
 }
@@ -294,22 +317,28 @@ ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequest (TCPIP_ICMP_ECHO_REQUEST* pEchoRequest,
     ICMP_PACKET*    pICMPPkt;
     uint16_t        pktSize;
     ICMP_ECHO_RESULT res;
+    ICMP_ECHO_DCPT* pDcpt;
 
     if(pHandle)
     {
         *pHandle = 0;
     }
 
-    if(pIcmpEchoRequest != 0)
-    {   // already going on
-        return ICMP_ECHO_BUSY;
-    }
-
     if(pEchoRequest == 0)
     {
         return ICMP_ECHO_PARAMETER_ERROR;
     }
 
+    if(_ICMPEchoFind(pEchoRequest->identifier, pEchoRequest->sequenceNumber, pEchoRequest->targetAddr.Val) != 0)
+    {   // same key already in flight; the reply could not be matched
+        return ICMP_ECHO_PARAMETER_ERROR;
+    }
+
+    if((pDcpt = (ICMP_ECHO_DCPT*)TCPIP_Helper_SingleListHeadRemove(&icmpEchoFreeList)) == 0)
+    {   // all slots taken
+        return ICMP_ECHO_BUSY;
+    }
+
     while(true)
     {
         // allocate TX packet
@@ -340,51 +369,117 @@ ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequest (TCPIP_ICMP_ECHO_REQUEST* pEchoRequest,
             break;
         }
 
-        icmpEchoRequest = *pEchoRequest;
+        pDcpt->echoReq = *pEchoRequest;
+        pDcpt->rttUs = 0;
         pTxPkt->macPkt.pDSeg->segLen += pktSize;
         TCPIP_IPV4_PacketFormatTx(pTxPkt, IP_PROT_ICMP, pktSize, 0);
         TCPIP_PKT_FlightLogTx(&pTxPkt->macPkt, TCPIP_THIS_MODULE_ID);
+        // stamp before transmit: the reply could be processed before the call returns
+        pDcpt->txCount = SYS_TMR_SystemCountGet();
+        pDcpt->txTick = SYS_TMR_TickCountGet();
         if(!TCPIP_IPV4_PacketTransmit(pTxPkt))
         {
             TCPIP_PKT_FlightLogAcknowledge(&pTxPkt->macPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
             res = ICMP_ECHO_TRANSMIT_ERROR;
             break;
         }
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
 
-        pIcmpEchoRequest = &icmpEchoRequest; // mark as busy
-        icmpEchoStart = SYS_TMR_TickCountGet();
+        // mark as busy; requests are sent in order so the busy list stays sorted by age
+        TCPIP_Helper_SingleListTailAdd(&icmpEchoBusyList, (SGL_LIST_NODE*)pDcpt);
 
         if(pHandle)
         {
-            *pHandle = pIcmpEchoRequest;
+            *pHandle = pDcpt;
         }
 
         res = ICMP_ECHO_OK;
         break;
     }
 
-    if(res < 0 && pTxPkt != 0)
+    if(res < 0)
     {
-        TCPIP_PKT_PacketFree(&pTxPkt->macPkt);
+        if(pTxPkt != 0)
+        {
+            TCPIP_PKT_PacketFree(&pTxPkt->macPkt);
+        }
+        TCPIP_Helper_SingleListHeadAdd(&icmpEchoFreeList, (SGL_LIST_NODE*)pDcpt);
     }
 
     return res;
 }
 
 // cancel a echo request
-// Currently only 1 request at a time is supported 
-// so the icmpHandle is unused
 ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequestCancel (TCPIP_ICMP_REQUEST_HANDLE icmpHandle)
 {
-    if(icmpHandle == pIcmpEchoRequest && pIcmpEchoRequest != 0)
-    {   // we have an extended  request in place
-        pIcmpEchoRequest = 0;    // free
+    ICMP_ECHO_DCPT* pDcpt = (ICMP_ECHO_DCPT*)icmpHandle;
+
+    if(pDcpt != 0 && TCPIP_Helper_SingleListFind(&icmpEchoBusyList, (SGL_LIST_NODE*)pDcpt))
+    {   // valid request in place
+        _ICMPEchoRelease(pDcpt);
         return ICMP_ECHO_OK;
     }
 
     return ICMP_ECHO_BAD_HANDLE;
 }
 
+uint32_t TCPIP_ICMP_EchoRequestRttGet (TCPIP_ICMP_REQUEST_HANDLE icmpHandle)
+{
+    ICMP_ECHO_DCPT* pDcpt = (ICMP_ECHO_DCPT*)icmpHandle;
+
+    if(pDcpt != 0 && TCPIP_Helper_SingleListFind(&icmpEchoBusyList, (SGL_LIST_NODE*)pDcpt))
+    {
+        return pDcpt->rttUs;
+    }
+
+    return 0;
+}
+
+int TCPIP_ICMP_EchoRequestsPending (void)
+{
+    return TCPIP_Helper_SingleListCount(&icmpEchoBusyList);
+}
+
+static void _ICMPEchoListsInit(void)
+{
+    int ix;
+
+    TCPIP_Helper_SingleListInitialize(&icmpEchoFreeList);
+    TCPIP_Helper_SingleListInitialize(&icmpEchoBusyList);
+    for(ix = 0; ix < sizeof(icmpEchoPool) / sizeof(*icmpEchoPool); ix++)
+    {
+        TCPIP_Helper_SingleListTailAdd(&icmpEchoFreeList, (SGL_LIST_NODE*)(icmpEchoPool + ix));
+    }
+}
+
+// finds the in flight request matching the reply key
+static ICMP_ECHO_DCPT* _ICMPEchoFind(uint16_t identifier, uint16_t sequenceNumber, uint32_t srcAdd)
+{
+    ICMP_ECHO_DCPT* pDcpt;
+
+    for(pDcpt = (ICMP_ECHO_DCPT*)icmpEchoBusyList.head; pDcpt != 0; pDcpt = pDcpt->next)
+    {
+        if(pDcpt->echoReq.identifier == identifier && pDcpt->echoReq.sequenceNumber == sequenceNumber &&
+                pDcpt->echoReq.targetAddr.Val == srcAdd)
+        {
+            return pDcpt;
+        }
+    }
+
+    return 0;
+}
+
+// returns a request to the free pool
+// safe to call if the user already cancelled the request from within the callback
+static void _ICMPEchoRelease(ICMP_ECHO_DCPT* pDcpt)
+{
+    if(TCPIP_Helper_SingleListNodeRemove(&icmpEchoBusyList, (SGL_LIST_NODE*)pDcpt) != 0)
+    {
+        TCPIP_Helper_SingleListTailAdd(&icmpEchoFreeList, (SGL_LIST_NODE*)pDcpt);
+    }
+}
+
 ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequestSend (TCPIP_NET_HANDLE netH, IPV4_ADDR * targetAddr, uint16_t sequenceNumber, uint16_t identifier)
 {
     IPV4_PACKET*    pTxPkt;
@@ -428,9 +523,11 @@ ICMP_ECHO_RESULT TCPIP_ICMP_EchoRequestSend (TCPIP_NET_HANDLE netH, IPV4_ADDR *
         if(!TCPIP_IPV4_PacketTransmit(pTxPkt))
         {
             TCPIP_PKT_FlightLogAcknowledge(&pTxPkt->macPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
             res = ICMP_ECHO_TRANSMIT_ERROR;
             break;
         }
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
 
         res = ICMP_ECHO_OK;
         break;
@@ -480,8 +577,10 @@ static void  TCPIP_ICMP_Process(void)
 
 
 
-    // extract queued ICMP packets
-    while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
+    // extract all queued ICMP packets at once
+    SINGLE_LIST rxBatch;
+    _TCPIPStackModuleRxExtractAll(TCPIP_THIS_MODULE_ID, &rxBatch);
+    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxBatch)) != 0)
     {
         TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
         pRxHdr = (ICMP_PACKET*)pRxPkt->pTransportLayer;
@@ -544,19 +643,18 @@ static void  TCPIP_ICMP_Process(void)
             if(pRxHdr->vType == ICMP_TYPE_ECHO_REPLY && pRxHdr->vCode == ICMP_CODE_ECHO_REPLY)
             {   // echo reply; check if our own
                 // Get the sequence number and identifier fields
-                if(pIcmpEchoRequest != 0)
-                {   // we have an extended  request in place
-                    if(pIcmpEchoRequest->identifier == pRxHdr->wIdentifier && pIcmpEchoRequest->sequenceNumber == pRxHdr->wSequenceNumber &&
-                            pIcmpEchoRequest->targetAddr.Val == srcAdd)
-                    {   // our reply
-                        if(pIcmpEchoRequest->callback)
-                        {
-                            (*pIcmpEchoRequest->callback)(pIcmpEchoRequest, pIcmpEchoRequest, TCPIP_ICMP_ECHO_REQUEST_RES_OK);
-                        }
-                        pIcmpEchoRequest = 0;    // free
-                        ackRes = TCPIP_MAC_PKT_ACK_RX_OK;
-                        break;
+                ICMP_ECHO_DCPT* pDcpt = _ICMPEchoFind(pRxHdr->wIdentifier, pRxHdr->wSequenceNumber, srcAdd);
+                if(pDcpt != 0)
+                {   // our reply to an extended request
+                    uint64_t rxCount = SYS_TMR_SystemCountGet() - pDcpt->txCount;
+                    pDcpt->rttUs = (uint32_t)((rxCount * 1000000ull) / SYS_TMR_SystemCountFrequencyGet());
+                    if(pDcpt->echoReq.callback)
+                    {
+                        (*pDcpt->echoReq.callback)(&pDcpt->echoReq, pDcpt, TCPIP_ICMP_ECHO_REQUEST_RES_OK);
                     }
+                    _ICMPEchoRelease(pDcpt);
+                    ackRes = TCPIP_MAC_PKT_ACK_RX_OK;
+                    break;
                 }
                 else
                 {   // it must be a non-extended query 
@@ -597,16 +695,21 @@ static void  TCPIP_ICMP_Timeout(void)
         icmpEchoTmo = (TCPIP_ICMP_ECHO_REQUEST_TIMEOUT * SYS_TMR_TickCounterFrequencyGet() + 999) / 1000;
     }
 
-    if(pIcmpEchoRequest != 0)
-    {   // some request in progress
-        if((SYS_TMR_TickCountGet() - icmpEchoStart) >= icmpEchoTmo) 
-        {   // expired: mark it as invalid
-            if(pIcmpEchoRequest->callback)
-            {
-                (*pIcmpEchoRequest->callback)(pIcmpEchoRequest, pIcmpEchoRequest, TCPIP_ICMP_ECHO_REQUEST_RES_TMO);
-            }
-            pIcmpEchoRequest = 0;    // free
+    // the busy list is ordered by transmit time: stop at the first request still in time
+    ICMP_ECHO_DCPT* pDcpt;
+    uint32_t currTick = SYS_TMR_TickCountGet();
+    while((pDcpt = (ICMP_ECHO_DCPT*)icmpEchoBusyList.head) != 0)
+    {
+        if((currTick - pDcpt->txTick) < icmpEchoTmo) 
+        {
+            break;
+        }
+        // expired: mark it as invalid
+        if(pDcpt->echoReq.callback)
+        {
+            (*pDcpt->echoReq.callback)(&pDcpt->echoReq, pDcpt, TCPIP_ICMP_ECHO_REQUEST_RES_TMO);
         }
+        _ICMPEchoRelease(pDcpt);
     }
 }
 #endif  // defined(TCPIP_STACK_USE_ICMP_CLIENT)
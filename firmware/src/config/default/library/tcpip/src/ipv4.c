@@ -63,10 +63,23 @@ static const void*          ipv4MemH = 0;                 // memory handle
 
 static tcpipSignalHandle    signalHandle = 0;
 
-static PROTECTED_SINGLE_LIST ipv4ArpQueue = { {0} };    // queue of packets waiting for ARP resolution
+// number of hash buckets for the targets waiting for ARP resolution; power of 2
+#define _TCPIP_IPV4_ARP_TARGET_BUCKETS  16
+
+#if !defined(TCPIP_IPV4_ARP_SLOTS_MAX)
+#define TCPIP_IPV4_ARP_SLOTS_MAX    0       // no growth beyond TCPIP_IPV4_MODULE_CONFIG::arpEntries
+#endif
+
+static PROTECTED_SINGLE_LIST ipv4ArpQueue = { {0} };    // list of allocated IPV4_ARP_BLOCK blocks
+                                                        // its lock protects all the ARP queue data
 static SINGLE_LIST          ipv4ArpPool = {0};          // pool of ARP entries
+static SINGLE_LIST          ipv4ArpTargetPool = {0};    // pool of ARP targets
+static SINGLE_LIST          ipv4ArpTargetHash[_TCPIP_IPV4_ARP_TARGET_BUCKETS];  // targets waiting for ARP resolution
+static size_t               ipv4ArpSlots = 0;           // currently allocated slots
+static size_t               ipv4ArpSlotsMax = 0;        // maximum number of slots
+static size_t               ipv4ArpBlockSlots = 0;      // number of slots allocated at once
+static TCPIP_IPV4_ARP_QUEUE_STAT _ipv4_arp_stat = {0};  // ARP queue statistics
                                                         // access protected by ipv4ArpQueue!
-static IPV4_ARP_ENTRY*      ipv4ArpEntries = 0;         // allocated nodes for ipv4ArpPool 
 
 static TCPIP_ARP_HANDLE     ipv4ArpHandle = 0;          // ARP registration handle
 
@@ -88,6 +101,17 @@ static TCPIP_IPV4_FILTER_TYPE ipv4FilterType = 0;       // IPv4 current filter
 static SINGLE_LIST          ipv4FragmentQueue = {0};  // IPv4 fragments to be processed
 #endif  // (_TCPIP_IPV4_FRAGMENTATION != 0)
 
+#if defined(TCPIP_IPV4_TX_BATCH_SIZE) && (TCPIP_IPV4_TX_BATCH_SIZE != 0)
+#define _TCPIP_IPV4_TX_BATCH    1
+static TCPIP_MAC_PACKET*    ipv4TxBatch[TCPIP_IPV4_TX_BATCH_SIZE];  // packets waiting to be passed to the MAC
+static TCPIP_NET_IF*        ipv4TxBatchIf = 0;          // interface of the current batch
+static int                  ipv4TxBatchCount = 0;       // packets in the batch
+static int                  ipv4TxBatchOpen = 0;        // Begin/End nesting level
+                                                        // access protected by critical sections
+#else
+#define _TCPIP_IPV4_TX_BATCH    0
+#endif  // defined(TCPIP_IPV4_TX_BATCH_SIZE) && (TCPIP_IPV4_TX_BATCH_SIZE != 0)
+
 typedef enum
 {
     TCPIP_IPV4_DEST_FAIL    = -1,   // cannot find a destination
@@ -292,16 +316,23 @@ static void _IPv4FwdMacDestDebug(const IPV4_ADDR* pDestAdd, const IPV4_ADDR* arp
 #define _IPv4FwdMacDestDebug(pDestAdd, arpTarget, pNetIf, destType, solved)
 #endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_FWD_MAC_DEST) != 0)
 
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-
-static TCPIP_IPV4_ARP_QUEUE_STAT _ipv4_arp_stat = {0};
-
 bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear)
 {
+    int ix;
+    size_t nTargets;
+
+    TCPIP_Helper_ProtectedSingleListLock(&ipv4ArpQueue);
     if(pStat)
     {
+        nTargets = 0;
+        for(ix = 0; ix < sizeof(ipv4ArpTargetHash) / sizeof(*ipv4ArpTargetHash); ix++)
+        {
+            nTargets += TCPIP_Helper_SingleListCount(ipv4ArpTargetHash + ix);
+        }
         _ipv4_arp_stat.nPool = TCPIP_Helper_SingleListCount(&ipv4ArpPool); 
-        _ipv4_arp_stat.nPend = TCPIP_Helper_SingleListCount(&ipv4ArpQueue.list); 
+        _ipv4_arp_stat.nPend = ipv4ArpSlots - _ipv4_arp_stat.nPool; 
+        _ipv4_arp_stat.nSlots = ipv4ArpSlots;
+        _ipv4_arp_stat.nTargets = nTargets;
 
         *pStat = _ipv4_arp_stat;
     }
@@ -309,16 +340,10 @@ bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear)
     {
         memset(&_ipv4_arp_stat, 0, sizeof(_ipv4_arp_stat));
     }
+    TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
     return true;
 }
 
-#else
-bool TCPIP_IPv4_ArpStatGet(TCPIP_IPV4_ARP_QUEUE_STAT* pStat, bool clear)
-{
-    return false;
-}
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0) && ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_PROC_EXT) != 0)
 
 static uint32_t _ipv4DbgExtTbl[] = {0xf002a8c0};   // table with addresses (src, dest) to be matched against
@@ -412,6 +437,7 @@ static void _IPv4FiltCountDbg(const char* msg)
 static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE type, IPV4_ADDR* arpTarget);
 
 static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, const TCPIP_MAC_ADDR* MACAddr, TCPIP_ARP_EVENT_TYPE evType, const void* param);
+static bool TCPIP_IPV4_ArpPoolGrow(void);
 
 static IPV4_PKT_PROC_TYPE TCPIP_IPV4_VerifyPktHost(TCPIP_NET_IF* pNetIf, IPV4_HEADER* pHeader, TCPIP_MAC_PACKET* pRxPkt);
 
@@ -440,7 +466,9 @@ static bool TCPIP_IPV4_TxMacPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pPkt);
 // if no fragment support, transmit just the head
 static __inline__ bool __attribute__((always_inline)) TCPIP_IPV4_TxMacPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pPkt)
 {
-    return _TCPIPStackPacketTx(pNetIf, pPkt) == TCPIP_MAC_RES_OK;
+    bool txOk = _TCPIPStackPacketTx(pNetIf, pPkt) == TCPIP_MAC_RES_OK;
+    TCPIP_STACK_STAT_INC(txOk ? TCPIP_STACK_STAT_TX_PKTS : TCPIP_STACK_STAT_TX_FAIL);
+    return txOk;
 }
 
 // if no fragment support, acknowledge just the head
@@ -467,6 +495,11 @@ static TCPIP_MAC_PKT_ACK_RES TCPIP_IPV4_DispatchPacket(TCPIP_MAC_PACKET* pRxPkt)
 
 static IPV4_OPTION_FIELD* _IPv4CheckPacketOption(TCPIP_MAC_PACKET* pRxPkt, int* pOptLen);
 
+#if (_TCPIP_IPV4_TX_BATCH != 0)
+static bool TCPIP_IPV4_TxBatchJoin(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pPkt);
+static void TCPIP_IPV4_TxBatchFlush(void);
+#endif  // (_TCPIP_IPV4_TX_BATCH != 0)
+
 #if (TCPIP_STACK_DOWN_OPERATION != 0)
 static void TCPIP_IPV4_Cleanup(void);
 static void TCPIP_IPV4_ArpListPurge(TCPIP_NET_IF* pNetIf);
@@ -527,7 +560,6 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
 {
     int ix;
     TCPIP_IPV4_RES iniRes;
-    IPV4_ARP_ENTRY* pEntry;
 
     if(stackInit->stackAction == TCPIP_STACK_ACTION_IF_UP)
     {   // interface restart
@@ -545,8 +577,14 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
             ipv4ArpHandle = 0;
             signalHandle = 0;
             memset(&ipv4ArpQueue, 0, sizeof(ipv4ArpQueue));
-            memset(&ipv4ArpPool, 0, sizeof(ipv4ArpPool));
-            ipv4ArpEntries = 0;
+            TCPIP_Helper_SingleListInitialize(&ipv4ArpPool);
+            TCPIP_Helper_SingleListInitialize(&ipv4ArpTargetPool);
+            for(ix = 0; ix < sizeof(ipv4ArpTargetHash) / sizeof(*ipv4ArpTargetHash); ix++)
+            {
+                TCPIP_Helper_SingleListInitialize(ipv4ArpTargetHash + ix);
+            }
+            ipv4ArpSlots = 0;
+            memset(&_ipv4_arp_stat, 0, sizeof(_ipv4_arp_stat));
             memset(&ipv4PacketFilters, 0, sizeof(ipv4PacketFilters));
             ipv4ActFilterCount = 0;
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
@@ -586,19 +624,14 @@ bool TCPIP_IPV4_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackInit, const
                 break;
             }
 
-            ipv4ArpEntries = (IPV4_ARP_ENTRY*)TCPIP_HEAP_Calloc(ipv4MemH, pIpInit->arpEntries , sizeof(*ipv4ArpEntries));
-            if(ipv4ArpEntries == 0)
+            // build the ARP pool
+            ipv4ArpBlockSlots = pIpInit->arpEntries;
+            ipv4ArpSlotsMax = TCPIP_IPV4_ARP_SLOTS_MAX > pIpInit->arpEntries ? TCPIP_IPV4_ARP_SLOTS_MAX : pIpInit->arpEntries;
+            if(!TCPIP_IPV4_ArpPoolGrow())
             {   // allocation failed
                 iniRes = TCPIP_IPV4_RES_MEM_ERR;
                 break;
             }
-            // build the ARP pool
-            TCPIP_Helper_SingleListInitialize(&ipv4ArpPool);
-            pEntry = ipv4ArpEntries;
-            for(ix = 0; ix < pIpInit->arpEntries; ix++, pEntry++)
-            {
-                TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
-            }
 
 
 #if (TCPIP_IPV4_EXTERN_PACKET_PROCESS != 0)
@@ -688,6 +721,8 @@ void TCPIP_IPV4_DeInitialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl)
 
 static void TCPIP_IPV4_Cleanup(void)
 {
+    IPV4_ARP_BLOCK* pBlock;
+
     if(ipv4ArpHandle)
     {
         TCPIP_ARP_HandlerDeRegister(ipv4ArpHandle);
@@ -697,6 +732,11 @@ static void TCPIP_IPV4_Cleanup(void)
     TCPIP_Notification_Deinitialize(&ipv4PacketFilters, ipv4MemH);
     ipv4ActFilterCount = 0;
 
+    while((pBlock = (IPV4_ARP_BLOCK*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpQueue.list)) != 0)
+    {
+        TCPIP_HEAP_Free(ipv4MemH, pBlock);
+    }
+    ipv4ArpSlots = 0;
     TCPIP_Helper_ProtectedSingleListDeinitialize(&ipv4ArpQueue);
 
     if(signalHandle)
@@ -705,12 +745,6 @@ static void TCPIP_IPV4_Cleanup(void)
         signalHandle = 0;
     }
 
-    if(ipv4ArpEntries != 0)
-    {
-        TCPIP_HEAP_Free(ipv4MemH, ipv4ArpEntries);
-        ipv4ArpEntries = 0;
-    }
-
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
     if(ipv4ForwardDcpt != 0)
     {
@@ -733,62 +767,84 @@ static void TCPIP_IPV4_Cleanup(void)
 // if pNetIf == 0 everything matches
 static void TCPIP_IPV4_ArpListPurge(TCPIP_NET_IF* pNetIf)
 {
-    SINGLE_LIST         newList;
+    int                 ix;
+    SINGLE_LIST         newList, newTargets;
+    SINGLE_LIST*        pBucket;
+    IPV4_ARP_TARGET*    pTarget;
     IPV4_ARP_ENTRY*     pEntry;
     TCPIP_MAC_PACKET*   pMacPkt;
     TCPIP_NET_IF*       pPktIf;
     
 
-    TCPIP_Helper_SingleListInitialize (&newList);
-
     PROTECTED_SINGLE_LIST* pList = &ipv4ArpQueue;
     TCPIP_Helper_ProtectedSingleListLock(pList);
-    // traverse the list
+    // traverse all the pending targets
     // and find all the packets matching the pNetIf
 
-    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pList->list)) != 0)
+    pBucket = ipv4ArpTargetHash;
+    for(ix = 0; ix < sizeof(ipv4ArpTargetHash) / sizeof(*ipv4ArpTargetHash); ix++, pBucket++)
     {
-        if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
-        {   // IPV4_PACKET*
-            pMacPkt = &pEntry->pTxPkt->macPkt;
-        }
+        TCPIP_Helper_SingleListInitialize (&newTargets);
+        while((pTarget = (IPV4_ARP_TARGET*)TCPIP_Helper_SingleListHeadRemove(pBucket)) != 0)
+        {
+            TCPIP_Helper_SingleListInitialize (&newList);
+            while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pTarget->pktList)) != 0)
+            {
+                if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
+                {   // IPV4_PACKET*
+                    pMacPkt = &pEntry->pTxPkt->macPkt;
+                }
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-        else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
-        {   // TCPIP_MAC_PACKET*
-            pMacPkt = pEntry->pFwdPkt; 
-        }
+                else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
+                {   // TCPIP_MAC_PACKET*
+                    pMacPkt = pEntry->pFwdPkt; 
+                }
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-        else
-        {   // should not happen!
-            _IPv4AssertCond(false, __func__, __LINE__);
-            return;
-        }
+                else
+                {   // should not happen!
+                    _IPv4AssertCond(false, __func__, __LINE__);
+                    TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
+                    continue;
+                }
 
-        pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->arpIfIx);
+                pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->arpIfIx);
 
-        if(pNetIf == 0 || pNetIf == pPktIf)
-        {   // match
-            if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
-            {   // IPV4_PACKET TX packet 
-                TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
-            }
+                if(pNetIf == 0 || pNetIf == pPktIf)
+                {   // match
+                    if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
+                    {   // IPV4_PACKET TX packet 
+                        TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
+                    }
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-            else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
-            {   // FWD Packet
-                TCPIP_PKT_PacketAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
-            }
+                    else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
+                    {   // FWD Packet
+                        TCPIP_PKT_PacketAcknowledge(pMacPkt, TCPIP_MAC_PKT_ACK_ARP_NET_ERR);
+                    }
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
-            // back to pool
-            TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
-        }
-        else
-        {
-            TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pEntry);
+                    // back to pool
+                    TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
+                }
+                else
+                {
+                    TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pEntry);
+                }
+            }
+
+            if(newList.nNodes != 0)
+            {   // still pending
+                pTarget->pktList = newList;
+                TCPIP_Helper_SingleListTailAdd(&newTargets, (SGL_LIST_NODE*)pTarget);
+            }
+            else
+            {
+                TCPIP_Helper_SingleListTailAdd(&ipv4ArpTargetPool, (SGL_LIST_NODE*)pTarget);
+            }
         }
+
+        // update the bucket
+        *pBucket = newTargets;
     }
 
-    // update the arp queue
-    pList->list = newList;
     TCPIP_Helper_ProtectedSingleListUnlock(pList);
 }
 #endif  // (TCPIP_STACK_DOWN_OPERATION != 0)
@@ -955,7 +1011,6 @@ static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TA
     IPV4_ADDR       arpTarget;
     bool            macRes;
     uint16_t        pktPayload, linkMtu;
-    uint8_t         headerLen;
 
 #if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_FWD) != 0)
         TCPIP_IPV4_FORWARD_STAT* pFwdDbg = _ipv4_fwd_stat + (pEntry->outIfIx < 2 ? pEntry->outIfIx : 2);
@@ -1040,12 +1095,12 @@ static bool TCPIP_IPV4_ForwardPkt(TCPIP_MAC_PACKET* pFwdPkt, const IPV4_ROUTE_TA
     pFwdPkt->pDSeg->segLen += sizeof(TCPIP_MAC_ETHERNET_HEADER);
     pFwdPkt->pktFlags |= TCPIP_MAC_PKT_FLAG_TX; 
 
-    // adjust the TTL and recalculate the IP checksum
+    // adjust the TTL and update the IP checksum; the TTL shares a 16 bit word with the protocol
     IPV4_HEADER* pHeader = (IPV4_HEADER*)pFwdPkt->pNetLayer;
+    uint16_t* pTtlWord = (uint16_t*)&pHeader->TimeToLive;
+    uint16_t oldTtlWord = *pTtlWord;
     pHeader->TimeToLive -= 1;
-    pHeader->HeaderChecksum = 0;
-    headerLen = pHeader->IHL << 2;
-    pHeader->HeaderChecksum = TCPIP_Helper_CalcIPChecksum((uint8_t*)pHeader, headerLen, 0);
+    pHeader->HeaderChecksum = TCPIP_Helper_ChecksumAdjust(pHeader->HeaderChecksum, oldTtlWord, *pTtlWord);
 
     if(pMacDst == 0)
     {   // ARP target not known yet; queue it
@@ -1762,6 +1817,13 @@ bool TCPIP_IPV4_PacketTransmit(IPV4_PACKET* pPkt)
     }
 
   
+#if (_TCPIP_IPV4_TX_BATCH != 0)
+    if(TCPIP_IPV4_TxBatchJoin(pNetIf, &pPkt->macPkt))
+    {   // will be passed to the MAC when the batch is flushed
+        return true;
+    }
+#endif  // (_TCPIP_IPV4_TX_BATCH != 0)
+
     // MAC sets itself the TCPIP_MAC_PKT_FLAG_QUEUED
     txRes = TCPIP_IPV4_TxMacPkt(pNetIf, &pPkt->macPkt);
     if(txRes == false)
@@ -1772,6 +1834,133 @@ bool TCPIP_IPV4_PacketTransmit(IPV4_PACKET* pPkt)
     return txRes;
 }
 
+#if (_TCPIP_IPV4_TX_BATCH != 0)
+void TCPIP_IPV4_TxBatchBegin(void)
+{
+    OSAL_CRITSECT_DATA_TYPE critSect = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    ipv4TxBatchOpen++;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+}
+
+void TCPIP_IPV4_TxBatchEnd(void)
+{
+    bool flush = false;
+    OSAL_CRITSECT_DATA_TYPE critSect = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    if(ipv4TxBatchOpen != 0)
+    {
+        flush = --ipv4TxBatchOpen == 0;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+
+    if(flush)
+    {
+        TCPIP_IPV4_TxBatchFlush();
+    }
+}
+
+// adds a packet to the current TX batch
+// returns true if the packet was added, false if it needs to be transmitted now
+// Note: a fragmented packet is not added; the pending batch is flushed
+// so that the packet order is preserved
+static bool TCPIP_IPV4_TxBatchJoin(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pPkt)
+{
+    bool needFlush, added;
+    OSAL_CRITSECT_DATA_TYPE critSect;
+
+    while(true)
+    {
+        added = needFlush = false;
+        critSect = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        if(ipv4TxBatchOpen != 0)
+        {
+            if(ipv4TxBatchCount != 0 && (pPkt->pkt_next != 0 || ipv4TxBatchIf != pNetIf || ipv4TxBatchCount == sizeof(ipv4TxBatch) / sizeof(*ipv4TxBatch)))
+            {   // cannot join the current batch
+                needFlush = true;
+            }
+            else if(pPkt->pkt_next == 0)
+            {
+                pPkt->pktFlags |= TCPIP_MAC_PKT_FLAG_QUEUED;
+                ipv4TxBatchIf = pNetIf;
+                ipv4TxBatch[ipv4TxBatchCount++] = pPkt;
+                added = true;
+            }
+        }
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+
+        if(!needFlush)
+        {
+            return added;
+        }
+
+        TCPIP_IPV4_TxBatchFlush();
+        if(pPkt->pkt_next != 0)
+        {   // fragments go directly
+            return false;
+        }
+        // try again with an empty batch
+    }
+}
+
+// passes the pending batch to the MAC as a packet chain
+static void TCPIP_IPV4_TxBatchFlush(void)
+{
+    int ix, nPkts;
+    TCPIP_NET_IF* pNetIf;
+    TCPIP_MAC_RES macRes;
+    TCPIP_MAC_PACKET* pktTbl[sizeof(ipv4TxBatch) / sizeof(*ipv4TxBatch)];
+
+    OSAL_CRITSECT_DATA_TYPE critSect = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    nPkts = ipv4TxBatchCount;
+    pNetIf = ipv4TxBatchIf;
+    memcpy(pktTbl, ipv4TxBatch, nPkts * sizeof(*pktTbl));
+    ipv4TxBatchCount = 0;
+    ipv4TxBatchIf = 0;
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+
+    if(nPkts == 0)
+    {
+        return;
+    }
+
+    for(ix = 0; ix < nPkts - 1; ix++)
+    {
+        pktTbl[ix]->next = pktTbl[ix + 1];
+    }
+    pktTbl[nPkts - 1]->next = 0;
+
+    macRes = _TCPIPStackPacketTx(pNetIf, pktTbl[0]);
+    if(macRes == TCPIP_MAC_RES_OK)
+    {
+        _TCPIPStackStatAdd(TCPIP_THIS_MODULE_ID, TCPIP_STACK_STAT_TX_PKTS, nPkts);
+        return;
+    }
+
+    // on TCPIP_MAC_RES_PACKET_ERR the MAC clears TCPIP_MAC_PKT_FLAG_QUEUED for the packets
+    // it did not schedule; any other failure means none of the chain was taken
+    // the caller has already been told these were sent, so acknowledge them here
+    for(ix = 0; ix < nPkts; ix++)
+    {
+        if((macRes != TCPIP_MAC_RES_PACKET_ERR && macRes != TCPIP_MAC_RES_PENDING) || (pktTbl[ix]->pktFlags & TCPIP_MAC_PKT_FLAG_QUEUED) == 0)
+        {
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
+            TCPIP_PKT_PacketAcknowledge(pktTbl[ix], TCPIP_MAC_PKT_ACK_MAC_REJECT_ERR);
+        }
+        else
+        {
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
+        }
+    }
+}
+#else
+void TCPIP_IPV4_TxBatchBegin(void)
+{
+}
+
+void TCPIP_IPV4_TxBatchEnd(void)
+{
+}
+#endif  // (_TCPIP_IPV4_TX_BATCH != 0)
+
 
 // IPv4 formats a IPV4_PACKET and calculates the header checksum
 // the source and destination addresses should be updated in the packet 
@@ -1846,26 +2035,120 @@ void TCPIP_IPV4_PacketFormatTx(IPV4_PACKET* pPkt, uint8_t protocol, uint16_t ipL
     pPkt->macPkt.pktIf = pPkt->netIfH;
 }
 
+// hash of an ARP target address into ipv4ArpTargetHash
+static __inline__ size_t __attribute__((always_inline)) TCPIP_IPV4_ArpTargetHash(uint32_t addVal)
+{
+    addVal ^= addVal >> 16;
+    addVal ^= addVal >> 8;
+    return addVal & (_TCPIP_IPV4_ARP_TARGET_BUCKETS - 1);
+}
+
+// finds the target waiting for the ARP resolution of addVal
+// if remove, the target is also taken out of the hash
+// Note: called with ipv4ArpQueue locked
+static IPV4_ARP_TARGET* TCPIP_IPV4_ArpTargetFind(uint32_t addVal, bool remove)
+{
+    IPV4_ARP_TARGET *pTarget, *pPrev;
+    SINGLE_LIST* pBucket = ipv4ArpTargetHash + TCPIP_IPV4_ArpTargetHash(addVal);
+
+    pPrev = 0;
+    for(pTarget = (IPV4_ARP_TARGET*)pBucket->head; pTarget != 0; pPrev = pTarget, pTarget = pTarget->next)
+    {
+        if(pTarget->arpTarget.Val == addVal)
+        {
+            if(remove)
+            {
+                TCPIP_Helper_SingleListNextRemove(pBucket, (SGL_LIST_NODE*)pPrev);
+            }
+            return pTarget;
+        }
+    }
+
+    return 0;
+}
+
+// allocates a new block of ARP slots and adds it to the pools
+// returns false if the maximum number of slots was reached or the allocation failed
+// Note: called with ipv4ArpQueue locked or at initialization
+static bool TCPIP_IPV4_ArpPoolGrow(void)
+{
+    size_t ix, nSlots;
+    IPV4_ARP_BLOCK* pBlock;
+    IPV4_ARP_ENTRY* pEntry;
+    IPV4_ARP_TARGET* pTarget;
+
+    nSlots = ipv4ArpSlotsMax - ipv4ArpSlots;
+    if(nSlots > ipv4ArpBlockSlots)
+    {
+        nSlots = ipv4ArpBlockSlots;
+    }
+
+    if(nSlots == 0)
+    {
+        return false;
+    }
+
+    pBlock = (IPV4_ARP_BLOCK*)TCPIP_HEAP_Calloc(ipv4MemH, 1, sizeof(*pBlock) + nSlots * (sizeof(IPV4_ARP_ENTRY) + sizeof(IPV4_ARP_TARGET)));
+    if(pBlock == 0)
+    {
+        return false;
+    }
+
+    pBlock->nSlots = nSlots;
+    pEntry = pBlock->entries;
+    pTarget = (IPV4_ARP_TARGET*)(pBlock->entries + nSlots);
+    for(ix = 0; ix < nSlots; ix++, pEntry++, pTarget++)
+    {
+        TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
+        TCPIP_Helper_SingleListTailAdd(&ipv4ArpTargetPool, (SGL_LIST_NODE*)pTarget); 
+    }
+
+    TCPIP_Helper_SingleListTailAdd(&ipv4ArpQueue.list, (SGL_LIST_NODE*)pBlock); 
+    ipv4ArpSlots += nSlots;
+
+    return true;
+}
+
 // queues a packet waiting for ARP resolution
+// the packet is added to the pending list of its ARP target
 static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE type, IPV4_ADDR* arpTarget)
 {
+    IPV4_ARP_ENTRY* pEntry;
+    IPV4_ARP_TARGET* pTarget;
     PROTECTED_SINGLE_LIST* pList = &ipv4ArpQueue;
+
     TCPIP_Helper_ProtectedSingleListLock(pList);
-    IPV4_ARP_ENTRY* pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpPool);
+    pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpPool);
+    if(pEntry == 0 && TCPIP_IPV4_ArpPoolGrow())
+    {
+        pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpPool);
+    }
+
     if(pEntry == 0)
     {   // out of ARP entries in the pool
+        _ipv4_arp_stat.poolFail++;
         SYS_ERROR(SYS_ERROR_WARNING, "IPv4: ARP entries pool empty!\r\n");
         TCPIP_Helper_ProtectedSingleListUnlock(pList);
         return false;
     }
 
+    pTarget = TCPIP_IPV4_ArpTargetFind(arpTarget->Val, false);
+    if(pTarget == 0)
+    {   // new target; there's always a free target if there's a free entry
+        pTarget = (IPV4_ARP_TARGET*)TCPIP_Helper_SingleListHeadRemove(&ipv4ArpTargetPool);
+        _IPv4AssertCond(pTarget != 0, __func__, __LINE__);
+        pTarget->arpTarget.Val = arpTarget->Val;
+        TCPIP_Helper_SingleListInitialize(&pTarget->pktList);
+        TCPIP_Helper_SingleListTailAdd(ipv4ArpTargetHash + TCPIP_IPV4_ArpTargetHash(arpTarget->Val), (SGL_LIST_NODE*)pTarget);
+    }
+
     pEntry->type = (uint8_t)type;
     pEntry->arpIfIx = (uint8_t)arpIfIx;
     pEntry->pPkt = pPkt;     
     pEntry->arpTarget.Val = arpTarget->Val;
-    TCPIP_Helper_SingleListTailAdd(&pList->list, (SGL_LIST_NODE*)pEntry);
-    TCPIP_Helper_ProtectedSingleListUnlock(pList);
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
+    pEntry->tQueue = SYS_TMR_TickCountGet();
+    TCPIP_Helper_SingleListTailAdd(&pTarget->pktList, (SGL_LIST_NODE*)pEntry);
+
     if(type == IPV4_ARP_PKT_TYPE_TX)
     {
         _ipv4_arp_stat.txSubmit++;
@@ -1878,30 +2161,29 @@ static bool TCPIP_IPV4_QueueArpPacket(void* pPkt, int arpIfIx, IPV4_ARP_PKT_TYPE
     {
         _IPv4AssertCond(false, __func__, __LINE__);
     }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
+    TCPIP_Helper_ProtectedSingleListUnlock(pList);
+
     return true;
 }
 
 
 
 // ARP resolution done
+// releases in one batch only the packets waiting for the solved address
 static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd, const TCPIP_MAC_ADDR* MACAddr, TCPIP_ARP_EVENT_TYPE evType, const void* param)
 {
     TCPIP_NET_IF* pPktIf;
-    SINGLE_LIST newList, *arpList;
+    SINGLE_LIST pktList, doneList;
     IPV4_ARP_ENTRY *pEntry;
-    TCPIP_MAC_PACKET*   pMacPkt = 0;
+    IPV4_ARP_TARGET *pTarget;
+    TCPIP_MAC_PACKET*   pMacPkt;
     TCPIP_MAC_PKT_ACK_RES   pktAckFail;
     TCPIP_MAC_ETHERNET_HEADER* macHdr;
+    uint32_t tNow, tickFreq;
+    size_t nTx, nFwd, waitMs, waitTot, waitMax;
     
 
-    TCPIP_Helper_SingleListInitialize (&newList);
-    
     TCPIP_Helper_ProtectedSingleListLock(&ipv4ArpQueue);
-    // traverse the ipv4ArpQueue list
-    // and find all the packets waiting for the solved address
-
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
     if(evType >= 0)
     {
         _ipv4_arp_stat.totSolved++;
@@ -1910,77 +2192,104 @@ static void TCPIP_IPV4_ArpHandler(TCPIP_NET_HANDLE hNet, const IPV4_ADDR* ipAdd,
     {
         _ipv4_arp_stat.totFailed++;
     }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-    arpList = &ipv4ArpQueue.list;
 
-    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(arpList)) != 0)
+    pTarget = TCPIP_IPV4_ArpTargetFind(ipAdd->Val, true);
+    if(pTarget == 0)
+    {   // nothing waiting for this address
+        TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
+        return;
+    }
+
+    pktList = pTarget->pktList;
+    TCPIP_Helper_SingleListTailAdd(&ipv4ArpTargetPool, (SGL_LIST_NODE*)pTarget);
+    TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
+
+    // the target packets are no longer reachable from the queue
+    // process them without holding the lock
+    TCPIP_Helper_SingleListInitialize (&doneList);
+    tNow = SYS_TMR_TickCountGet();
+    tickFreq = SYS_TMR_TickCounterFrequencyGet();
+    nTx = nFwd = waitTot = waitMax = 0;
+
+    TCPIP_IPV4_TxBatchBegin();
+    while((pEntry = (IPV4_ARP_ENTRY*)TCPIP_Helper_SingleListHeadRemove(&pktList)) != 0)
     {
         if(pEntry->type == IPV4_ARP_PKT_TYPE_TX)
         {   // IPV4_PACKET*
             pMacPkt = &pEntry->pTxPkt->macPkt;
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-            if(evType >= 0)
-            {
-                _ipv4_arp_stat.txSolved++;
-            }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
+            nTx++;
         }
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
         else if(pEntry->type == IPV4_ARP_PKT_TYPE_FWD)
         {   // TCPIP_MAC_PACKET*
             pMacPkt = pEntry->pFwdPkt; 
-#if ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
-            if(evType >= 0)
-            {
-                _ipv4_arp_stat.fwdSolved++;
-            }
-#endif  // ((TCPIP_IPV4_DEBUG_LEVEL & TCPIP_IPV4_DEBUG_MASK_ARP_QUEUE) != 0)
+            nFwd++;
         }
 #endif  // (TCPIP_IPV4_FORWARDING_ENABLE != 0)
         else
         {   // should not happen!
             _IPv4AssertCond(false, __func__, __LINE__);
-            return;
+            TCPIP_Helper_SingleListTailAdd(&doneList, (SGL_LIST_NODE*)pEntry);
+            continue;
         }
 
         pPktIf = (TCPIP_NET_IF*)TCPIP_STACK_IndexToNet(pEntry->arpIfIx);
             
         pktAckFail = TCPIP_MAC_PKT_ACK_NONE; 
-        if(pEntry->arpTarget.Val == ipAdd->Val)
-        {   // match
-            if(evType >= 0)
-            {   // successfully resolved the ARP; update the packet destination
-                macHdr = (TCPIP_MAC_ETHERNET_HEADER*)pMacPkt->pMacLayer;
-                memcpy(&macHdr->DestMACAddr, MACAddr, sizeof(*MACAddr));
-                pMacPkt->next = 0;  // send single packet
-                if(pPktIf == 0 || !TCPIP_IPV4_TxMacPkt(pPktIf, pMacPkt))
-                {
-                    pktAckFail = TCPIP_MAC_PKT_ACK_ARP_NET_ERR; 
-                }
+        if(evType >= 0)
+        {   // successfully resolved the ARP; update the packet destination
+            macHdr = (TCPIP_MAC_ETHERNET_HEADER*)pMacPkt->pMacLayer;
+            memcpy(&macHdr->DestMACAddr, MACAddr, sizeof(*MACAddr));
+            pMacPkt->next = 0;
+            if(pPktIf == 0)
+            {
+                pktAckFail = TCPIP_MAC_PKT_ACK_ARP_NET_ERR; 
             }
-            else
-            {   // some error;
-                pktAckFail = TCPIP_MAC_PKT_ACK_ARP_TMO; 
+#if (_TCPIP_IPV4_TX_BATCH != 0)
+            else if(TCPIP_IPV4_TxBatchJoin(pPktIf, pMacPkt))
+            {   // will go out with the rest of the batch
             }
-
-            if(pktAckFail != TCPIP_MAC_PKT_ACK_NONE)
-            {   // some error; discard the packet
-                TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, pktAckFail, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
+#endif  // (_TCPIP_IPV4_TX_BATCH != 0)
+            else if(!TCPIP_IPV4_TxMacPkt(pPktIf, pMacPkt))
+            {
+                pktAckFail = TCPIP_MAC_PKT_ACK_ARP_NET_ERR; 
             }
-
-            // back to pool
-            TCPIP_Helper_SingleListTailAdd(&ipv4ArpPool, (SGL_LIST_NODE*)pEntry); 
         }
         else
+        {   // some error;
+            pktAckFail = TCPIP_MAC_PKT_ACK_ARP_TMO; 
+        }
+
+        if(pktAckFail != TCPIP_MAC_PKT_ACK_NONE)
+        {   // some error; discard the packet
+            TCPIP_IPV4_FragmentTxAcknowledge(pMacPkt, pktAckFail, IPV4_FRAG_TX_ACK_HEAD | IPV4_FRAG_TX_ACK_FRAGS);
+        }
+
+        waitMs = (size_t)(((uint64_t)(tNow - pEntry->tQueue) * 1000) / tickFreq);
+        waitTot += waitMs;
+        if(waitMs > waitMax)
         {
-            TCPIP_Helper_SingleListTailAdd(&newList, (SGL_LIST_NODE*)pEntry);
+            waitMax = waitMs;
         }
+        TCPIP_Helper_SingleListTailAdd(&doneList, (SGL_LIST_NODE*)pEntry);
     }
+    TCPIP_IPV4_TxBatchEnd();
 
-    // update the arp queue
-    ipv4ArpQueue.list = newList;
+    // entries back to pool
+    TCPIP_Helper_ProtectedSingleListLock(&ipv4ArpQueue);
+    if(evType >= 0)
+    {
+        _ipv4_arp_stat.txSolved += nTx;
+        _ipv4_arp_stat.fwdSolved += nFwd;
+    }
+    _ipv4_arp_stat.waitCount += nTx + nFwd;
+    _ipv4_arp_stat.waitTotMs += waitTot;
+    if(waitMax > _ipv4_arp_stat.waitMaxMs)
+    {
+        _ipv4_arp_stat.waitMaxMs = waitMax;
+    }
+    TCPIP_Helper_SingleListAppend(&ipv4ArpPool, &doneList);
     TCPIP_Helper_ProtectedSingleListUnlock(&ipv4ArpQueue);
-
 }
 
 void  TCPIP_IPV4_Task(void)
@@ -2015,8 +2324,10 @@ static void TCPIP_IPV4_Process(void)
     IPV4_PKT_PROC_TYPE procType;
     TCPIP_MAC_PKT_ACK_RES ackRes;
 
-    // extract queued IPv4 packets
-    while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
+    // extract all queued IPv4 packets at once
+    SINGLE_LIST rxBatch;
+    _TCPIPStackModuleRxExtractAll(TCPIP_THIS_MODULE_ID, &rxBatch);
+    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxBatch)) != 0)
     {
 #if (TCPIP_IPV4_FORWARDING_ENABLE != 0)
         if(pRxPkt->ipv4PktData != 0)
@@ -3413,8 +3724,10 @@ static bool TCPIP_IPV4_TxMacPkt(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pPkt)
         pFragNext = pFragPkt->pkt_next;
         if(_TCPIPStackPacketTx(pNetIf, pFragPkt) != TCPIP_MAC_RES_OK)
         {
+            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
             return false;
         }
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
     }
 
     return true;
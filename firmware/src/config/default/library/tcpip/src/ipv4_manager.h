@@ -121,6 +121,18 @@ bool                    Ipv4DeRegisterFilter(IPV4_FILTER_HANDLE hFilter);
 //
 void                    TCPIP_IPV4_MacPacketSwitchTxToRx(TCPIP_MAC_PACKET* pRxPkt, bool setChecksum);
 
+// TX batching
+// between TCPIP_IPV4_TxBatchBegin and TCPIP_IPV4_TxBatchEnd
+// the (non fragmented) packets transmitted over the same interface are collected
+// and handed over to the MAC as a chain, with one TCPIP_MAC_PacketTx call
+// the packets are marked TCPIP_MAC_PKT_FLAG_QUEUED while waiting in the batch
+// a packet rejected at the flush time is acknowledged with TCPIP_MAC_PKT_ACK_MAC_REJECT_ERR
+// calls can be nested; the batch is flushed by the outermost TCPIP_IPV4_TxBatchEnd
+// Note: no-ops if TCPIP_IPV4_TX_BATCH_SIZE == 0
+void                    TCPIP_IPV4_TxBatchBegin(void);
+
+void                    TCPIP_IPV4_TxBatchEnd(void);
+
 #endif // _IPV4_MANAGER_H_
 
 
@@ -169,8 +169,26 @@ typedef struct _tag_IPV4_ARP_ENTRY
         void*               pPkt;       // generic   
     };
     IPV4_ADDR               arpTarget;  // ARP resolution target
+    uint32_t                tQueue;     // tick when the packet was queued for ARP
 }IPV4_ARP_ENTRY;
 
+// ARP target with packets waiting for its resolution
+typedef struct _tag_IPV4_ARP_TARGET
+{
+    struct _tag_IPV4_ARP_TARGET* next;  // SGL_LIST_NODE safe cast
+    IPV4_ADDR               arpTarget;  // ARP resolution target
+    SINGLE_LIST             pktList;    // IPV4_ARP_ENTRY list of packets waiting for arpTarget
+}IPV4_ARP_TARGET;
+
+// block of ARP slots, allocated as needed
+// each slot is an IPV4_ARP_ENTRY + IPV4_ARP_TARGET
+typedef struct _tag_IPV4_ARP_BLOCK
+{
+    struct _tag_IPV4_ARP_BLOCK* next;   // SGL_LIST_NODE safe cast
+    size_t                  nSlots;     // number of slots in this block
+    IPV4_ARP_ENTRY          entries[];  // nSlots entries followed by nSlots targets
+}IPV4_ARP_BLOCK;
+
 
 // routing
 
@@ -59,10 +59,19 @@ static __inline__ void __attribute__((always_inline)) _OAHashRemoveEntry(OA_HASH
     if(pOE->flags.busy)
     {
         pOE->flags.busy = 0;
-        pOH->fullSlots--;
+        if(--pOH->fullSlots == 0)
+        {   // empty table, no more long probe sequences
+            pOH->maxProbe = 0;
+        }
     }
 }
 
+// number of slots a look up has to traverse
+static __inline__ size_t __attribute__((always_inline)) _OAHashProbeLimit(OA_HASH_DCPT* pOH)
+{
+    return pOH->maxProbe < pOH->hEntries ? pOH->maxProbe + 1 : pOH->hEntries;
+}
+
 
 /*static __inline__*/static  size_t /*__attribute__((always_inline))*/ _OAHashProbeStep(OA_HASH_DCPT* pOH, const void* key)
 {
@@ -96,6 +105,7 @@ void TCPIP_OAHASH_Initialize(OA_HASH_DCPT* pOH)
     size_t  ix;
 
     pOH->fullSlots = 0; 
+    pOH->maxProbe = 0; 
     
     pHE = (OA_HASH_ENTRY*)pOH->memBlk;
     for(ix = 0; ix < pOH->hEntries; ix++)
@@ -114,7 +124,9 @@ OA_HASH_ENTRY* TCPIP_OAHASH_EntryLookup(OA_HASH_DCPT* pOH, const void* key)
     size_t      bkts = 0;
     size_t      bktIx;
     size_t      probeStep;
+    size_t      probeLimit;
    
+    probeLimit = _OAHashProbeLimit(pOH);
     probeStep = _OAHashProbeStep(pOH, key);
 #if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
     bktIx = (*pOH->hashF)(pOH, key);
@@ -127,7 +139,7 @@ OA_HASH_ENTRY* TCPIP_OAHASH_EntryLookup(OA_HASH_DCPT* pOH, const void* key)
         bktIx += pOH->hEntries;
     }
     
-    while(bkts < pOH->hEntries)
+    while(bkts < probeLimit)
     {
         pBkt = (OA_HASH_ENTRY*)((uint8_t*)(pOH->memBlk) + bktIx * pOH->hEntrySize);
 #if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
@@ -261,16 +273,57 @@ OA_HASH_ENTRY* TCPIP_OAHASH_EntryGet(OA_HASH_DCPT* pOH, size_t entryIx)
     return 0;
 }
 
+OA_HASH_ENTRY* TCPIP_OAHASH_EntryLookupKey32(OA_HASH_DCPT* pOH, uint32_t key, size_t keyOffset)
+{
+    OA_HASH_ENTRY*  pBkt;
+    size_t      bkts;
+    size_t      bktIx;
+    size_t      probeStep;
+    size_t      probeLimit;
+   
+    probeLimit = _OAHashProbeLimit(pOH);
+    probeStep = _OAHashProbeStep(pOH, &key);
+#if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+    bktIx = (*pOH->hashF)(pOH, &key);
+#else
+    bktIx = TCPIP_OAHASH_KeyHash(pOH, &key);
+#endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+
+    for(bkts = 0; bkts < probeLimit; bkts++)
+    {
+        pBkt = (OA_HASH_ENTRY*)((uint8_t*)(pOH->memBlk) + bktIx * pOH->hEntrySize);
+        if(pBkt->flags.busy && *(uint32_t*)((uint8_t*)pBkt + keyOffset) == key)
+        {   // found entry
+            pBkt->flags.newEntry = 0;
+            return pBkt;
+        }
+
+        // advance to the next hash slot
+        bktIx += probeStep;
+        if(bktIx >= pOH->hEntries)
+        {
+            bktIx -= pOH->hEntries;
+        }
+    }
+    
+    return 0;   // not found
+}
+
 // implementation
 
 // finds a entry that either contains the desired key
 // or is empty and can be used to insert the key 
+// Note: the key is searched for along the whole probe sequence (maxProbe)
+// even after an empty slot is found; removed entries leave holes
+// and the key could be further away
 static OA_HASH_ENTRY* _OAHashFindBkt(OA_HASH_DCPT* pOH, const void* key)
 {
     OA_HASH_ENTRY*  pBkt;
+    OA_HASH_ENTRY*  pFree;
     size_t      bktIx;
     size_t      probeStep;
     size_t      bkts = 0;
+    size_t      freeProbe = 0;
 
     probeStep = _OAHashProbeStep(pOH, key);
 #if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
@@ -284,33 +337,35 @@ static OA_HASH_ENTRY* _OAHashFindBkt(OA_HASH_DCPT* pOH, const void* key)
         bktIx += pOH->hEntries;
     }
     
+    pFree = 0;
     while(bkts < pOH->hEntries)
     {
         pBkt = (OA_HASH_ENTRY*)((uint8_t*)(pOH->memBlk) + bktIx * pOH->hEntrySize);
         if(pBkt->flags.busy == 0)
         {   // found unused entry
-#if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
-            (*pOH->cpyF)(pOH, pBkt, key);   // set the key
-#else
-            TCPIP_OAHASH_KeyCopy(pOH, pBkt, key);   // set the key
-#endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
-            pBkt->probeCount = bkts;
-            pOH->fullSlots++;
-            return pBkt;
+            if(pFree == 0)
+            {
+                pFree = pBkt;
+                freeProbe = bkts;
+            }
         }
-
 #if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
-        if((*pOH->cmpF)(pOH, pBkt, key) == 0)
+        else if((*pOH->cmpF)(pOH, pBkt, key) == 0)
         {   // found entry
             return pBkt;
         }
 #else
-        if(TCPIP_OAHASH_KeyCompare(pOH, pBkt, key) == 0)
+        else if(TCPIP_OAHASH_KeyCompare(pOH, pBkt, key) == 0)
         {   // found entry
             return pBkt;
         }
 #endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
 
+        if(pFree != 0 && bkts >= pOH->maxProbe)
+        {   // the key cannot be further away
+            break;
+        }
+
         // advance to the next hash slot
         bktIx += probeStep;
         if(bktIx < 0)
@@ -325,8 +380,24 @@ static OA_HASH_ENTRY* _OAHashFindBkt(OA_HASH_DCPT* pOH, const void* key)
         bkts++;
     }
     
-    return 0;   // cache full, not found
+    if(pFree != 0)
+    {   // use the first free slot
+#if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+        (*pOH->cpyF)(pOH, pFree, key);   // set the key
+#else
+        TCPIP_OAHASH_KeyCopy(pOH, pFree, key);   // set the key
+#endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+        pFree->probeCount = freeProbe;
+        pOH->fullSlots++;
+        if(freeProbe > pOH->maxProbe)
+        {
+            pOH->maxProbe = freeProbe;
+        }
+    }
+
+    return pFree;   // 0 if cache full, not found
 }
 
 
 
+
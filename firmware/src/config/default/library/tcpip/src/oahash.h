@@ -123,6 +123,9 @@ typedef void (*OA_HASH_KEY_COPY_F)(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, c
 // the performance degrades when the load factor gets >= 0.7
 // Use the probeCount number to check the hash
 // performance and choose the number of entries carefully!
+// Entries are never moved once inserted: the hash users keep pointers to them.
+// Instead, the hash keeps track of the longest probe sequence (maxProbe)
+// so that a look up, including a miss, stops after maxProbe + 1 slots.
 // For best performance the number of elements should be prime
 // and a good hash function should be used.
 //
@@ -162,6 +165,9 @@ struct _TAG_OA_HASH_DCPT
     // fields updated by the TCPIP_OAHASH_Initialize()
     // and maintained by the hash itself  
     size_t                  fullSlots;  // number of elements/slots having valid data                         
+    size_t                  maxProbe;   // longest probe sequence of an entry in the table
+                                        // a look up stops after maxProbe + 1 slots,
+                                        // not after traversing the whole table
 };
 
 
@@ -238,6 +244,13 @@ void            TCPIP_OAHASH_EntriesRemoveAll(OA_HASH_DCPT* pOH);
 // otherwise it returns 0 
 OA_HASH_ENTRY*   TCPIP_OAHASH_EntryGet(OA_HASH_DCPT* pOH, size_t entryIx);
 
+// look up specialized for hashes having a 32-bit key
+// stored at keyOffset inside the hash entry.
+// The key is compared inline, no key compare function call per probe.
+// The hash function is still used to get the start slot (with &key as parameter).
+// if no such entry found, it returns NULL
+OA_HASH_ENTRY*   TCPIP_OAHASH_EntryLookupKey32(OA_HASH_DCPT* pOH, uint32_t key, size_t keyOffset);
+
 
 #if !defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
 
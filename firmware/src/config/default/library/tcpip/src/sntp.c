@@ -61,6 +61,29 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 #define TCPIP_SNTP_DEBUG_LEVEL  (0)
 
 
+// number of requests sent at each poll
+// the reply with the minimum round trip delay is used to update the clock
+#if !defined(TCPIP_NTP_SAMPLES)
+#define TCPIP_NTP_SAMPLES               4
+#endif
+
+// max number of server addresses sampled at each poll
+// the addresses are taken from the DNS answer for the server name
+#if !defined(TCPIP_NTP_MAX_SERVERS)
+#define TCPIP_NTP_MAX_SERVERS           4
+#endif
+
+// clock offset, in ms, above which the local clock is stepped instead of slewed
+#if !defined(TCPIP_NTP_STEP_THRESHOLD)
+#define TCPIP_NTP_STEP_THRESHOLD        128
+#endif
+
+#define _TCPIP_NTP_SLEW_PPM             500         // rate at which a phase offset is slewed
+#define _TCPIP_NTP_FREQ_MAX_PPB         500000      // max frequency correction
+#define _TCPIP_NTP_FREQ_GAIN            4           // the frequency loop applies 1/gain of the measured error
+#define _TCPIP_NTP_FREQ_MIN_INTERVAL    16          // min seconds between updates to estimate the frequency
+#define _TCPIP_NTP_JITTER_GAIN          8           // jitter exponential average weight
+
 // Defines the structure of an NTP packet
 typedef struct
 {
@@ -111,6 +134,7 @@ typedef enum
     SM_HOME,
     SM_WAIT_DNS,
     SM_DNS_RESOLVED,
+    SM_SERVER_BIND,
     SM_UDP_SEND,
     SM_UDP_RECV,
     SM_SHORT_WAIT,
@@ -133,9 +157,51 @@ static TCPIP_SNTP_RESULT    ntpLastError;
 
 static TCPIP_SNTP_EVENT_HANDLER ntpEventHandler;    // the (only) sntp module event handler
 
+// local clock, disciplined to the NTP time
+// time(sysCount) = baseStamp + ntp(sysCount - baseCount) + frequency correction + slewed phase
+// all stamps are in NTP 32.32 format
+typedef struct
+{
+    uint64_t    baseStamp;      // NTP time at baseCount
+    uint64_t    baseCount;      // SYS_TMR_SystemCountGet() value of the base
+    int64_t     slewPhase;      // phase offset to be slewed since the base
+    int32_t     freqPpb;        // frequency correction of the system counter, ppb
+    uint32_t    countFreq;      // SYS_TMR_SystemCountFrequencyGet()
+}SNTP_LOCAL_CLOCK;
+
+// a time sample obtained from a server
+typedef struct
+{
+    int64_t     offset;         // server - local clock
+    uint64_t    delay;          // round trip delay
+    uint64_t    rxCount;        // system count when the reply was received
+    int         serverIx;       // index in the ntpServers
+}SNTP_SAMPLE;
+
+static SNTP_LOCAL_CLOCK     sntpClock;
+
+// the server addresses sampled at each poll
+static IP_MULTI_ADDRESS     ntpServers[TCPIP_NTP_MAX_SERVERS];
+static int                  ntpServersNo;
+
+static int                  ntpSampleIx;        // current request in the poll burst
+static int                  ntpGoodSamples;     // valid replies in the burst
+static SNTP_SAMPLE          ntpBestSample;      // reply with the minimum delay in the burst
+static uint64_t             ntpTxStamp;         // local transmit time of the current request: T1
+static volatile uint64_t    ntpRxCount;         // system count of the last received packet: T4
+static uint64_t             ntpLastUpdateCount; // system count of the last clock update
+
+static TCPIP_SNTP_STATISTICS ntpStat;
+
 // local prototypes
 
-static uint32_t TCPIP_SNTP_CurrTime(uint32_t* pMs);
+static uint32_t TCPIP_SNTP_CurrTime(uint32_t* pUs);
+
+static uint64_t _SNTP_ClockStamp(uint64_t sysCount);
+
+static void     _SNTP_ClockUpdate(void);
+
+static int      _SNTP_ServersGet(void);
 
 static void     TCPIP_SNTP_Event(TCPIP_SNTP_EVENT evType, const void* param);
 
@@ -191,6 +257,7 @@ static const char* const _SNTP_DbgState_Tbl[] =
     "home",            //    SM_HOME,
     "wait_dns",        //    SM_WAIT_DNS,
     "dns_solved",      //    SM_DNS_RESOLVED,
+    "bind",            //    SM_SERVER_BIND,
     "send",            //    SM_UDP_SEND,
     "recv",            //    SM_UDP_RECV,
     "s_wait",          //    SM_SHORT_WAIT,
@@ -381,6 +448,143 @@ static bool _SntpCanStart(void)
     return (sntpState == SM_HOME || sntpState == SM_SHORT_WAIT || sntpState == SM_WAIT);
 }
 
+// NTP time of the local clock for the sysCount moment
+static uint64_t _SNTP_ClockStamp(uint64_t sysCount)
+{
+    uint32_t countFreq = sntpClock.countFreq;
+    uint64_t deltaCount = sysCount - sntpClock.baseCount;
+    uint64_t deltaSec = deltaCount / countFreq;
+    // (deltaCount % countFreq) < 2^32, so the fraction does not overflow
+    uint64_t delta = (deltaSec << 32) + (((deltaCount - deltaSec * countFreq) << 32) / countFreq);
+
+    // corrections are calculated with 2^-16 s resolution; enough and no 64 bit overflow
+    int64_t delta16 = (int64_t)(delta >> 16);
+    int64_t corr = (delta16 * sntpClock.freqPpb) / 1000000000 * 65536;
+
+    if(sntpClock.slewPhase != 0)
+    {   // slew the phase at a fixed rate, until all of it has been applied
+        int64_t slew = (delta16 * _TCPIP_NTP_SLEW_PPM) / 1000000 * 65536;
+        if(sntpClock.slewPhase > 0)
+        {
+            corr += slew < sntpClock.slewPhase ? slew : sntpClock.slewPhase;
+        }
+        else
+        {
+            corr -= slew < -sntpClock.slewPhase ? slew : -sntpClock.slewPhase;
+        }
+    }
+
+    return sntpClock.baseStamp + delta + corr;
+}
+
+// converts an NTP 32.32 signed interval to microseconds
+static int32_t _SNTP_StampToUs(int64_t stamp)
+{
+    int64_t us = (stamp / 65536 * 1000000) / 65536;
+
+    return us > 0x7fffffff ? 0x7fffffff : us < -0x7fffffff ? -0x7fffffff : (int32_t)us;
+}
+
+// builds the list of server addresses to sample
+// ntpServerIP is already solved
+static int _SNTP_ServersGet(void)
+{
+    int nServers = 0;
+
+#if defined (TCPIP_STACK_USE_IPV6)           
+    if(ntpConnection == IP_ADDRESS_TYPE_IPV6)
+    {
+        IPV6_ADDR addBuff[TCPIP_NTP_MAX_SERVERS];
+        nServers = TCPIP_DNS_GetIPv6Addresses(sntpServerName, 0, addBuff, TCPIP_NTP_MAX_SERVERS);
+        while(nServers > 0)
+        {
+            nServers--;
+            ntpServers[nServers].v6Add = addBuff[nServers];
+        }
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV6)
+#if defined (TCPIP_STACK_USE_IPV4)
+    if(ntpConnection == IP_ADDRESS_TYPE_IPV4)
+    {
+        IPV4_ADDR addBuff[TCPIP_NTP_MAX_SERVERS];
+        int ix;
+        nServers = TCPIP_DNS_GetIPv4Addresses(sntpServerName, 0, addBuff, TCPIP_NTP_MAX_SERVERS);
+        for(ix = 0; ix < nServers; ix++)
+        {
+            ntpServers[ix].v4Add = addBuff[ix];
+        }
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+    if(nServers <= 0)
+    {   // IP address provided or the name is no longer in the DNS cache
+        ntpServers[0] = ntpServerIP;
+        nServers = 1;
+    }
+
+    return nServers;
+}
+
+// updates the local clock with the best sample of the burst
+static void _SNTP_ClockUpdate(void)
+{
+    TCPIP_SNTP_TIME_STAMP msStamp;
+    int64_t offset = ntpBestSample.offset;
+    int64_t stepThres = ((int64_t)TCPIP_NTP_STEP_THRESHOLD << 32) / 1000;
+    uint64_t rxCount = ntpBestSample.rxCount;
+
+    if(ntpData.nUpdates == 0 || offset > stepThres || offset < -stepThres)
+    {   // step the clock
+        // on the 1st update the local clock has no meaning
+        ntpStat.offsetUs = ntpData.nUpdates == 0 ? 0 : _SNTP_StampToUs(offset);
+        sntpClock.baseStamp = _SNTP_ClockStamp(rxCount) + offset;
+        sntpClock.slewPhase = 0;
+        ntpStat.nSteps++;
+    }
+    else
+    {   // slew
+        uint32_t intervalSec = (uint32_t)((rxCount - ntpLastUpdateCount) / sntpClock.countFreq);
+        if(intervalSec >= _TCPIP_NTP_FREQ_MIN_INTERVAL)
+        {   // the phase was corrected at the previous update
+            // so the offset accumulated since then is the frequency error
+            int64_t offsetNs = (offset * 1000000000) / 4294967296ll;
+            int32_t freqPpb = sntpClock.freqPpb + (int32_t)(offsetNs / intervalSec) / _TCPIP_NTP_FREQ_GAIN;
+            sntpClock.freqPpb = freqPpb > _TCPIP_NTP_FREQ_MAX_PPB ? _TCPIP_NTP_FREQ_MAX_PPB : freqPpb < -_TCPIP_NTP_FREQ_MAX_PPB ? -_TCPIP_NTP_FREQ_MAX_PPB : freqPpb;
+        }
+
+        int32_t offsetUs = _SNTP_StampToUs(offset);
+        int32_t diffUs = offsetUs - ntpStat.offsetUs;
+        ntpStat.jitterUs += ((int32_t)(diffUs < 0 ? -diffUs : diffUs) - (int32_t)ntpStat.jitterUs) / _TCPIP_NTP_JITTER_GAIN;
+        ntpStat.offsetUs = offsetUs;
+
+        // rebase: continuous time, the new phase offset replaces any remaining slew
+        sntpClock.baseStamp = _SNTP_ClockStamp(rxCount);
+        sntpClock.slewPhase = offset;
+    }
+
+    sntpClock.baseCount = rxCount;
+    ntpLastUpdateCount = rxCount;
+
+    ntpStat.delayUs = _SNTP_StampToUs(ntpBestSample.delay);
+    ntpStat.freqPpb = sntpClock.freqPpb;
+    ntpStat.serverAddr = ntpServers[ntpBestSample.serverIx];
+    ntpStat.nSamples = ntpGoodSamples;
+    ntpStat.nServers = ntpServersNo;
+    ntpStat.nUpdates++;
+
+    // report the current time
+    ntpData.tStamp.llStamp = _SNTP_ClockStamp(SYS_TMR_SystemCountGet());
+    ntpData.tStampTick = SYS_TMR_TickCountGetLong();
+    ntpData.tUnixSeconds = ntpData.tStamp.tStampSeconds - TCPIP_NTP_EPOCH;
+    msStamp.llStamp = (uint64_t)ntpData.tStamp.tStampFraction * 1000;
+    ntpData.tMilliseconds = msStamp.tStampSeconds;
+    ntpData.nUpdates++;
+
+    TCPIP_SNTP_Event(TCPIP_SNTP_EVENT_TSTAMP_OK, (const void*)&ntpData);
+
+    _SNTP_DbgNewTimeStamp(ntpData.tUnixSeconds);
+}
+
 // returns true if the module is idle
 // and SNTP parameters changed
 static bool _SntpCanChangeParams(void)
@@ -424,6 +628,8 @@ bool TCPIP_SNTP_Initialize(const TCPIP_STACK_MODULE_CTRL* const stackCtrl, const
 #endif  // !defined (TCPIP_STACK_USE_IPV4)
 
         memset(&ntpData, 0, sizeof(ntpData));
+        memset(&sntpClock, 0, sizeof(sntpClock));
+        memset(&ntpStat, 0, sizeof(ntpStat));
         sntpServerName[0] = 0;
         if(pSNTPConfig->ntp_server != 0)
         {
@@ -534,7 +740,8 @@ void TCPIP_SNTP_Task(void)
 static void TCPIP_SNTP_SocketRxSignalHandler(UDP_SOCKET hUDP, TCPIP_NET_HANDLE hNet, TCPIP_UDP_SIGNAL_TYPE sigType, const void* param)
 {
     if(sigType == TCPIP_UDP_SIGNAL_RX_DATA)
-    {
+    {   // the signal is raised at packet reception: the most accurate T4
+        ntpRxCount = SYS_TMR_SystemCountGet();
         _TCPIPStackModuleSignalRequest(TCPIP_THIS_MODULE_ID, TCPIP_MODULE_SIGNAL_RX_PENDING, true); 
     }
 }
@@ -547,6 +754,7 @@ static void TCPIP_SNTP_Process(void)
     TCPIP_NET_IF*       pNetIf;
     bool                dataAvlbl;
     bool                bindRes;
+    TCPIP_SNTP_TIME_STAMP txStamp;
 
 
     switch(sntpState)
@@ -558,6 +766,7 @@ static void TCPIP_SNTP_Process(void)
             sntp_tstamp_timeout *= SYS_TMR_TickCounterFrequencyGet();
             sntp_query_interval *= SYS_TMR_TickCounterFrequencyGet();
             sntp_error_interval *= SYS_TMR_TickCounterFrequencyGet();
+            sntpClock.countFreq = SYS_TMR_SystemCountFrequencyGet();
             TCPIP_SNTP_SetNewState(SM_HOME);
             break;
 
@@ -625,6 +834,16 @@ static void TCPIP_SNTP_Process(void)
 
         case SM_DNS_RESOLVED:
             _SNTP_DbgNewDns(sntpServerName, &ntpServerIP);
+            // start a new poll burst
+            ntpServersNo = _SNTP_ServersGet();
+            ntpSampleIx = 0;
+            ntpGoodSamples = 0;
+            TCPIP_SNTP_SetNewState(SM_SERVER_BIND);
+            // no break needed here!
+
+        case SM_SERVER_BIND:
+            // the burst samples the servers round robin
+            ntpServerIP = ntpServers[ntpSampleIx % ntpServersNo];
             // select a running interface
             pSntpIf = pSntpDefIf;
             if(!TCPIP_STACK_NetworkIsLinked(pSntpIf))
@@ -664,7 +883,7 @@ static void TCPIP_SNTP_Process(void)
             {   // Wait no more than 1 sec
                 if((SYS_TMR_TickCountGet() - SNTPTimer > 1 * SYS_TMR_TickCounterFrequencyGet()))
                 {
-                    TCPIP_SNTP_SetErrorState(SM_DNS_RESOLVED, SNTP_RES_SKT_ERR, TCPIP_SNTP_EVENT_SKT_ERROR, false);
+                    TCPIP_SNTP_SetErrorState(SM_SERVER_BIND, SNTP_RES_SKT_ERR, TCPIP_SNTP_EVENT_SKT_ERROR, false);
                 }
                 break;
             }
@@ -674,10 +893,15 @@ static void TCPIP_SNTP_Process(void)
             memset(&pkt, 0, sizeof(pkt));
             pkt.flags.versionNumber = TCPIP_NTP_VERSION;
             pkt.flags.mode = 3;             // NTP Client
-            pkt.orig_ts_secs = TCPIP_Helper_htonl(TCPIP_NTP_EPOCH);
+            // the local transmit time is echoed by the server in orig_ts
+            // the local clock is not meaningful before the 1st update but it is used only for differences
+            txStamp.llStamp = _SNTP_ClockStamp(SYS_TMR_SystemCountGet());
+            pkt.tx_ts_secs = TCPIP_Helper_htonl(txStamp.tStampSeconds);
+            pkt.tx_ts_fraq = TCPIP_Helper_htonl(txStamp.tStampFraction);
             // enable packets RX
             TCPIP_UDP_OptionsSet(sntpSocket, UDP_OPTION_RX_QUEUE_LIMIT, (void*)TCPIP_NTP_RX_QUEUE_LIMIT);
             TCPIP_UDP_ArrayPut(sntpSocket, (uint8_t*) &pkt, sizeof(pkt));
+            ntpTxStamp = txStamp.llStamp;
             TCPIP_UDP_Flush(sntpSocket);
 
             SNTPTimer = SYS_TMR_TickCountGet();
@@ -701,8 +925,6 @@ static void TCPIP_SNTP_Process(void)
             }
 
             // either we have data or timeout
-            // set the error state in case the process is not successful
-            TCPIP_SNTP_SetNewState(SM_SHORT_WAIT);
             dataAvlbl = false;
 
             // consume all available data
@@ -711,7 +933,7 @@ static void TCPIP_SNTP_Process(void)
                 dataAvlbl = true;
                 if(TCPIP_SNTP_ProcessPkt())
                 {   // successful SNTP packet
-                    TCPIP_SNTP_SetNewState(SM_WAIT);
+                    ntpGoodSamples++;
                     break;
                 }
             }
@@ -727,6 +949,19 @@ static void TCPIP_SNTP_Process(void)
             TCPIP_UDP_Disconnect(sntpSocket, true);
 
             SNTPTimer = SYS_TMR_TickCountGet();
+            if(++ntpSampleIx < TCPIP_NTP_SAMPLES)
+            {   // next request in the burst
+                TCPIP_SNTP_SetNewState(SM_SERVER_BIND);
+            }
+            else if(ntpGoodSamples != 0)
+            {   // burst done
+                _SNTP_ClockUpdate();
+                TCPIP_SNTP_SetNewState(SM_WAIT);
+            }
+            else
+            {   // retry after waiting a while
+                TCPIP_SNTP_SetNewState(SM_SHORT_WAIT);
+            }
             break;
 
         case SM_SHORT_WAIT:
@@ -753,11 +988,10 @@ static void TCPIP_SNTP_Process(void)
 }
 
 // returns true if successful packet
-// and current time updated
+// and the burst best sample updated
 static bool TCPIP_SNTP_ProcessPkt(void)
 {
     NTP_PACKET          pkt;
-    TCPIP_SNTP_TIME_STAMP msStamp;
     uint16_t            w;
 
 
@@ -786,55 +1020,63 @@ static bool TCPIP_SNTP_ProcessPkt(void)
         return false;
     }
 
+    // the server echoes our transmit timestamp; discard replies to other requests
+    TCPIP_SNTP_TIME_STAMP origStamp, rxStamp, txStamp;
+    origStamp.tStampSeconds = TCPIP_Helper_ntohl(pkt.orig_ts_secs);
+    origStamp.tStampFraction = TCPIP_Helper_ntohl(pkt.orig_ts_fraq);
+    if(origStamp.llStamp != ntpTxStamp)
+    {
+        TCPIP_SNTP_SetError(SNTP_RES_NTP_TSTAMP_ERR, TCPIP_SNTP_EVENT_TSTAMP_ERROR); 
+        return false;
+    }
+
     // success
-    // get the last timestamp
-    ntpData.tStamp.tStampSeconds = TCPIP_Helper_ntohl(pkt.tx_ts_secs);
-    ntpData.tStamp.tStampFraction = TCPIP_Helper_ntohl(pkt.tx_ts_fraq);
-    ntpData.tStampTick = SYS_TMR_TickCountGetLong();
-    ntpData.tUnixSeconds = ntpData.tStamp.tStampSeconds - TCPIP_NTP_EPOCH;
-    msStamp.llStamp = (uint64_t)ntpData.tStamp.tStampFraction * 1000;
-    ntpData.tMilliseconds = msStamp.tStampSeconds;
-    ntpData.nUpdates++;
+    // T1: ntpTxStamp, T2: rxStamp, T3: txStamp, T4: local time at ntpRxCount
+    rxStamp.tStampSeconds = TCPIP_Helper_ntohl(pkt.recv_ts_secs);
+    rxStamp.tStampFraction = TCPIP_Helper_ntohl(pkt.recv_ts_fraq);
+    txStamp.tStampSeconds = TCPIP_Helper_ntohl(pkt.tx_ts_secs);
+    txStamp.tStampFraction = TCPIP_Helper_ntohl(pkt.tx_ts_fraq);
+
+    uint64_t rxCount = ntpRxCount;
+    uint64_t localRx = _SNTP_ClockStamp(rxCount);
+    int64_t delay = (int64_t)((localRx - ntpTxStamp) - (txStamp.llStamp - rxStamp.llStamp));
+    if(delay < 0)
+    {   // server processing time exceeds our resolution
+        delay = 0;
+    }
 
-    TCPIP_SNTP_Event(TCPIP_SNTP_EVENT_TSTAMP_OK, (const void*)&ntpData);
+    // offset = ((T2 - T1) + (T3 - T4)) / 2, calculated as T3 + delay / 2 - T4
+    // to avoid the overflow when the local clock is not set
+    if(ntpGoodSamples == 0 || (uint64_t)delay < ntpBestSample.delay)
+    {   // best sample so far
+        ntpBestSample.offset = (int64_t)(txStamp.llStamp + delay / 2 - localRx);
+        ntpBestSample.delay = delay;
+        ntpBestSample.rxCount = rxCount;
+        ntpBestSample.serverIx = ntpSampleIx % ntpServersNo;
+    }
 
-    _SNTP_DbgNewTimeStamp(ntpData.tUnixSeconds);
     return true;
 }
 
 // tStamp should be valid here!
 // we calculate the tick difference time in NTP format
 // and add to original NTP timestamp to get the current one
-// returns the current second and millisecond
-static uint32_t TCPIP_SNTP_CurrTime(uint32_t* pMs)
+// returns the current second and microsecond
+static uint32_t TCPIP_SNTP_CurrTime(uint32_t* pUs)
 {
 
-    TCPIP_SNTP_TIME_STAMP deltaStamp, fractStamp;
-    
-    uint32_t ticksPerSec = SYS_TMR_TickCounterFrequencyGet();
-    uint64_t deltaTick = SYS_TMR_TickCountGetLong() - ntpData.tStampTick;
-    
-    // calculate seconds = deltaTick / ticksPerSec;
-    deltaStamp.tStampSeconds = (uint32_t)(deltaTick / ticksPerSec);
-
-    // calculate fract part: (deltaTick % ticksPerSec) / ticksPerSec) * 2^32 ; 
-    fractStamp.tStampSeconds = deltaTick - deltaStamp.tStampSeconds * ticksPerSec;
-    fractStamp.tStampFraction = 0;
-
-    deltaStamp.tStampFraction = (uint32_t)(fractStamp.llStamp / ticksPerSec);
-
-    // 64 bit addition gets us the new time stamp
-    deltaStamp.llStamp += ntpData.tStamp.llStamp;
+    TCPIP_SNTP_TIME_STAMP currStamp, fractStamp;
 
+    currStamp.llStamp = _SNTP_ClockStamp(SYS_TMR_SystemCountGet());
 
-    // calculate milliseconds: (fract / 2 ^ 32) * 1000;
-    if(pMs)
+    // calculate microseconds: (fract / 2 ^ 32) * 1000000;
+    if(pUs)
     {
-        fractStamp.llStamp = (uint64_t)deltaStamp.tStampFraction * 1000;
-        *pMs = fractStamp.tStampSeconds;
+        fractStamp.llStamp = (uint64_t)currStamp.tStampFraction * 1000000;
+        *pUs = fractStamp.tStampSeconds;
     }
 
-    return deltaStamp.tStampSeconds - TCPIP_NTP_EPOCH;
+    return currStamp.tStampSeconds - TCPIP_NTP_EPOCH;
 }
 
 uint32_t TCPIP_SNTP_UTCSecondsGet(void)
@@ -993,16 +1235,29 @@ TCPIP_SNTP_RESULT TCPIP_SNTP_TimeStampGet(TCPIP_SNTP_TIME_STAMP* pTStamp, uint32
 
 TCPIP_SNTP_RESULT TCPIP_SNTP_TimeGet(uint32_t* pUTCSeconds, uint32_t* pMs)
 {
-    uint32_t currSec, currMs;
+    uint32_t currUs;
+    TCPIP_SNTP_RESULT res = TCPIP_SNTP_TimeGetUs(pUTCSeconds, &currUs);
+
+    if(pMs)
+    {
+        *pMs = currUs / 1000;
+    }
+
+    return res;
+}
+
+TCPIP_SNTP_RESULT TCPIP_SNTP_TimeGetUs(uint32_t* pUTCSeconds, uint32_t* pUs)
+{
+    uint32_t currSec, currUs;
     TCPIP_SNTP_RESULT res = TCPIP_SNTP_TimeStampStatus();
 
     if(res == SNTP_RES_TSTAMP_ERROR)
     {
-        currSec = currMs = 0;
+        currSec = currUs = 0;
     }
     else
     {   // we could get the time
-        currSec = TCPIP_SNTP_CurrTime(&currMs);
+        currSec = TCPIP_SNTP_CurrTime(&currUs);
     }
 
     if(pUTCSeconds)
@@ -1010,14 +1265,24 @@ TCPIP_SNTP_RESULT TCPIP_SNTP_TimeGet(uint32_t* pUTCSeconds, uint32_t* pMs)
         *pUTCSeconds = currSec;
     }
 
-    if(pMs)
+    if(pUs)
     {
-        *pMs = currMs;
+        *pUs = currUs;
     }
 
     return res;
 }
 
+TCPIP_SNTP_RESULT TCPIP_SNTP_StatisticsGet(TCPIP_SNTP_STATISTICS* pStat)
+{
+    if(pStat)
+    {
+        *pStat = ntpStat;
+    }
+
+    return TCPIP_SNTP_TimeStampStatus();
+}
+
 TCPIP_SNTP_RESULT TCPIP_SNTP_LastErrorGet(void)
 {
     // keep compiler happy
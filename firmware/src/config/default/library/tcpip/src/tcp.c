@@ -1242,8 +1242,10 @@ static void TCPIP_TCP_Process(void)
     TCPIP_MAC_PACKET*   pRxPkt;
     TCPIP_MAC_PKT_ACK_RES ackRes;
 
-    // extract queued TCP packets
-    while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
+    // extract all queued TCP packets at once
+    SINGLE_LIST rxBatch;
+    _TCPIPStackModuleRxExtractAll(TCPIP_THIS_MODULE_ID, &rxBatch);
+    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxBatch)) != 0)
     {
         TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
 #if (TCPIP_TCP_EXTERN_PACKET_PROCESS != 0)
@@ -1395,6 +1397,10 @@ static TCP_V4_PACKET* _TcpAllocateTxPacket(TCB_STUB* pSkt, IP_ADDRESS_TYPE addTy
         pv4Pkt->tcpSeg[0].segFlags = pv4Pkt->tcpSeg[1].segFlags = TCPIP_MAC_SEG_FLAG_STATIC; // embedded in packet itself
 
     }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
 
 
     return pv4Pkt;
@@ -1557,7 +1563,13 @@ static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, u
     if(loadLen)
     {   // add the data segments
         pv4Pkt->macPkt.pDSeg->segFlags |= TCPIP_MAC_SEG_FLAG_USER_PAYLOAD;
-        checksum = ~TCPIP_Helper_PacketChecksum(&pv4Pkt->macPkt, ((TCP_V4_PACKET*)pv4Pkt)->tcpSeg[0].segLoad, loadLen, checksum);
+        if(pSkt->txChkLen != loadLen || pSkt->txChkSeq != pTCPHdr->SeqNumber)
+        {   // new payload; a retransmission of the same segment, with just new header fields, reuses the sum
+            pSkt->txChkSum = ~TCPIP_Helper_PacketChecksum(&pv4Pkt->macPkt, ((TCP_V4_PACKET*)pv4Pkt)->tcpSeg[0].segLoad, loadLen, 0);
+            pSkt->txChkSeq = pTCPHdr->SeqNumber;
+            pSkt->txChkLen = loadLen;
+        }
+        checksum = TCPIP_Helper_ChecksumFold((uint32_t)checksum + pSkt->txChkSum);
     }
     else
     {   // packet not carying user payload
@@ -1576,10 +1588,12 @@ static bool _TCPv4Flush(TCB_STUB * pSkt, IPV4_PACKET* pv4Pkt, uint16_t hdrLen, u
     TCPIP_PKT_FlightLogTxSkt(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID, ((uint32_t)pSkt->localPort << 16) | pSkt->remotePort, pSkt->sktIx);
     if(TCPIP_IPV4_PacketTransmit(pv4Pkt))
     {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
         return true; 
     }
     // failed
     TCPIP_PKT_FlightLogAcknowledge(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+    TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
 
     return false;
 }
@@ -3662,6 +3676,7 @@ static void TCPIP_TCP_Tick(void)
                     // Set the appropriate retry time
                     pSkt->retryCount++;
                     pSkt->retryInterval <<= 1;
+                    TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_RETRANSMITS);
 
                     // Calculate how many bytes we have to roll back and retransmit
                     w = pSkt->txUnackedTail - pSkt->txTail;
@@ -4092,6 +4107,7 @@ static _TCP_SEND_RES _TcpSend(TCB_STUB* pSkt, uint8_t vTCPFlags, uint8_t vSendFl
             // Generate a dummy byte
             pSkt->MySEQ -= 1;
             len = 1;
+            pSkt->txChkLen = 0;     // the byte is no longer in the TX buffer; don't use the cached checksum
         }
         else if(pSkt->Flags.bTimerEnabled) 
         {
@@ -4480,6 +4496,7 @@ static void _TcpSocketSetIdleState(TCB_STUB* pSkt)
 	pSkt->flags.bRXNoneACKed1 = 0;
 	pSkt->flags.bRXNoneACKed2 = 0;
     pSkt->MySEQ = 0;
+    pSkt->txChkLen = 0;
 	pSkt->sHoleSize = -1;
 	pSkt->remoteWindow = 1;
     pSkt->maxRemoteWindow = 1;
@@ -5171,6 +5188,7 @@ static void _TcpHandleSeg(TCB_STUB* pSkt, TCP_HEADER* h, uint16_t tcpLen, TCPIP_
                             }
                             pSkt->txUnackedTail = pSkt->txTail;
                             pSkt->Flags.bTXASAPWithoutTimerReset = 1;
+                            TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_RETRANSMITS);
                         }
                         pSkt->flags.bRXNoneACKed2 = 1;
                     }
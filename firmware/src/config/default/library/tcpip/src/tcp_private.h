@@ -191,6 +191,9 @@ typedef struct
     uint16_t            sigMask;                    // TCPIP_TCP_SIGNAL_TYPE: mask of active events
     TCPIP_TCP_SIGNAL_FUNCTION sigHandler;           // socket signal handler
     const void*         sigParam;                   // socket signal parameter
+    uint32_t            txChkSeq;                   // sequence number of the last transmitted payload
+    uint16_t            txChkLen;                   // its length; 0 if none
+    uint16_t            txChkSum;                   // its checksum; reused by the retransmissions
     uint8_t             keepAliveLim;               // current limit
     union
     {
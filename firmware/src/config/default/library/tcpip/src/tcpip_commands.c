@@ -60,6 +60,11 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 #define _TCPIP_COMMAND_PING4_DEBUG      0   // enable/disable extra ping debugging messages
 #endif
 
+// max number of ping echo requests in flight
+#if !defined(TCPIP_STACK_COMMANDS_ICMP_ECHO_WINDOW)
+#define TCPIP_STACK_COMMANDS_ICMP_ECHO_WINDOW   4
+#endif
+
 #if defined(TCPIP_STACK_USE_IPV6) && defined(TCPIP_STACK_USE_ICMPV6_CLIENT) && (TCPIP_ICMPV6_CLIENT_USER_NOTIFICATION != 0)
 #define _TCPIP_COMMAND_PING6
 #endif
@@ -245,6 +250,20 @@ static const char* _CommandPktLogModuleNames[] =
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+static int _Command_PktRing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
+
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+static int _Command_StackStat(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
+
+#if (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
+static int _Command_ChksumBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+static int _Command_OaHashBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+static int _Command_HashBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
+#endif  // (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
+
 #if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
 static int _Command_PktInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
 #endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
@@ -288,6 +307,16 @@ typedef enum
     TCPIP_PHY_READ,                 // read a PHY register command
     TCPIP_PHY_WRITE,                // write a PHY register command
     TCPIP_PHY_DUMP,                 // dump a range of PHY registers command
+
+    // packet trace ring export
+    TCPIP_CMD_STAT_RING_START,                              // starting ring export commands
+
+    TCPIP_RING_CMD_DUMP = TCPIP_CMD_STAT_RING_START,        // pcapng hex dump to the console
+    TCPIP_RING_CMD_CONNECT,                                 // wait for the export socket to connect
+    TCPIP_RING_CMD_SEND,                                    // pcapng export to the socket
+    TCPIP_RING_CMD_CLOSE,                                   // flush and close the export socket
+
+    TCPIP_CMD_STAT_RING_STOP = TCPIP_RING_CMD_CLOSE,        // stop ring export commands
 }TCPIP_COMMANDS_STAT;
 
 static SYS_CMD_DEVICE_NODE* pTcpipCmdDevice = 0;
@@ -324,7 +353,27 @@ static void                 _PingStop(SYS_CMD_DEVICE_NODE* pCmdIO, const void* c
 static IPV4_ADDR            icmpTargetAddr;         // current target address
 static uint8_t              icmpPingBuff[TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_BUFF_SIZE];
 static int                  icmpPingSize = TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_DATA_SIZE;
-static TCPIP_ICMP_REQUEST_HANDLE icmpReqHandle;     // current transaction handle
+
+// ping request in flight
+typedef struct
+{
+    TCPIP_ICMP_REQUEST_HANDLE   reqHandle;  // ICMP transaction handle; 0 if slot free
+    uint16_t                    seqNo;      // sequence number of the request
+}TCPIP_CMD_PING_SLOT;
+
+static TCPIP_CMD_PING_SLOT  icmpReqSlots[TCPIP_STACK_COMMANDS_ICMP_ECHO_WINDOW];
+static int                  icmpReqPending;         // requests in flight
+static int                  icmpReqWindow;          // max requests in flight for the current command
+static bool                 icmpFlood;              // send without delay, as many as the window allows
+static int                  icmpTmoCount;           // requests that timed out
+static int                  icmpTxErrors;           // requests that could not be sent in flood mode
+
+// round trip time statistics for the current target, microseconds
+static uint32_t             icmpRttMin;
+static uint32_t             icmpRttMax;
+static uint32_t             icmpRttPrev;            // last RTT, for jitter
+static uint64_t             icmpRttSum;
+static uint64_t             icmpJitterSum;          // sum of the |RTT[n] - RTT[n-1]| deltas
 #endif  // defined(_TCPIP_COMMAND_PING4)
 
 #if defined(_TCPIP_COMMAND_PING6)
@@ -380,6 +429,27 @@ static const void*          miimCmdIoParam = 0;
 
 #define         TCPIP_MIIM_COMMAND_TASK_RATE  100   // milliseconds
 #endif  // defined(_TCPIP_COMMANDS_MIIM)
+
+#if (TCPIP_PACKET_TRACE_RING_ENABLE) && defined(_TCPIP_STACK_COMMAND_TASK)
+static void     TCPIPCmdRingTask(void);
+static bool     _CommandRingWriteConsole(const void* buff, size_t len, const void* param);
+
+static const void*          ringCmdIoParam = 0;
+static int                  ringExportIx = 0;       // current TCPIP_PKT_RingExport() index
+static size_t               ringBudget = 0;         // bytes that can still be output in this task run
+static uint32_t             ringExportBytes = 0;    // total exported bytes
+
+#define         TCPIP_RING_COMMAND_TASK_RATE        20      // milliseconds
+#define         TCPIP_RING_COMMAND_CONSOLE_BUDGET   256     // pcapng bytes per task run, printed as hex on the console
+#define         TCPIP_RING_COMMAND_CONNECT_TMO      5       // seconds
+
+#if defined(TCPIP_STACK_USE_TCP)
+static bool     _CommandRingWriteSkt(const void* buff, size_t len, const void* param);
+
+static TCP_SOCKET           ringSkt = INVALID_SOCKET;
+static uint32_t             ringStartTick;
+#endif  // defined(TCPIP_STACK_USE_TCP)
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE) && defined(_TCPIP_STACK_COMMAND_TASK)
 #if defined(TCPIP_STACK_USE_FTP_CLIENT) && defined(TCPIP_FTPC_COMMANDS)
 static int _Command_FTPC_Service(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv);
 #endif
@@ -475,6 +545,17 @@ static const SYS_CMD_DESCRIPTOR    tcpipCmdTbl[]=
 #if (TCPIP_PACKET_LOG_ENABLE)
     {"plog",        (SYS_CMD_FNC)_Command_PktLog,               ": PKT flight log"},
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+    {"pring",       (SYS_CMD_FNC)_Command_PktRing,              ": PKT trace ring"},
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+    {"stackstat",   (SYS_CMD_FNC)_Command_StackStat,            ": Stack statistics"},
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
+#if (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
+    {"chkbench",    (SYS_CMD_FNC)_Command_ChksumBench,          ": Checksum benchmark"},
+    {"oabench",     (SYS_CMD_FNC)_Command_OaHashBench,          ": OA hash benchmark"},
+    {"hashbench",   (SYS_CMD_FNC)_Command_HashBench,            ": FNV/xxHash benchmark"},
+#endif  // (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
 #if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
     {"pktinfo",   (SYS_CMD_FNC)_Command_PktInfo,                ": Check PKT allocation"},
 #endif  // defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
@@ -1759,7 +1840,8 @@ static int _Command_ShowDNSResolvedInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, c
     }
 
     (*pCmdIO->pCmdApi->print)(cmdIoParam, "DNS Client IF - Strict: %s, Preferred: %s\r\n", strictName, prefName);
-    (*pCmdIO->pCmdApi->print)(cmdIoParam, "DNS Client - time: %d, pending: %d, current: %d, total: %d\r\n", clientInfo.dnsTime, clientInfo.pendingEntries, clientInfo.currentEntries, clientInfo.totalEntries);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "DNS Client - time: %d, pending: %d, current: %d, total: %d, negative: %d\r\n", clientInfo.dnsTime, clientInfo.pendingEntries, clientInfo.currentEntries, clientInfo.totalEntries, clientInfo.negativeEntries);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "DNS Client - queries: %lu, retries: %lu, coalesced: %lu, negative cached: %lu\r\n", clientInfo.nQueries, clientInfo.nRetries, clientInfo.nCoalesced, clientInfo.nNegCached);
 
     index = 0;
     while(1)
@@ -1769,6 +1851,10 @@ static int _Command_ShowDNSResolvedInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, c
         {
             entryPresent = true;
             (*pCmdIO->pCmdApi->print)(cmdIoParam, "Hostname = %s \r\nTimeout = %d \r\n", hostName, dnsQuery.ttlTime);
+            if(dnsQuery.status == TCPIP_DNS_RES_NAME_ERROR || dnsQuery.status == TCPIP_DNS_RES_SERVER_FAIL)
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "Negative = %s\r\n", dnsQuery.status == TCPIP_DNS_RES_NAME_ERROR ? "no such name" : "server failure");
+            }
             if(dnsQuery.nIPv4ValidEntries > 0)
             {
                 for(ix = 0; ix < dnsQuery.nIPv4ValidEntries; ix++)
@@ -2868,7 +2954,7 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 
     if (argc < 2)
     {
-        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping Usage: ping <stop>/<name/address> <i interface> <n nPings> <t msPeriod> <s size>\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping Usage: ping <stop>/<name/address> <i interface> <n nPings> <t msPeriod> <s size> <f nInFlight>\r\n");
         return true;
     }
 
@@ -2909,6 +2995,8 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
     //
     icmpReqNo = 0;
     icmpReqDelay = 0;
+    icmpReqWindow = TCPIP_STACK_COMMANDS_ICMP_ECHO_WINDOW;
+    icmpFlood = false;
 
     currIx = 2;
 
@@ -2946,6 +3034,15 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
             }
 
         }
+        else if(strcmp(param, "f") == 0)
+        {   // flood: ignore the period, keep nInFlight requests outstanding
+            int nInFlight = atoi(paramVal);
+            if(nInFlight > 0 && nInFlight < icmpReqWindow)
+            {
+                icmpReqWindow = nInFlight;
+            }
+            icmpFlood = true;
+        }
         else
         {
             (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping: Unknown parameter\r\n");
@@ -2968,9 +3065,9 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
     {
         icmpReqNo = TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUESTS;
     }
-    if(icmpReqDelay == 0)
+    if(icmpReqDelay == 0 || icmpFlood)
     {
-        icmpReqDelay = TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_DELAY;
+        icmpReqDelay = icmpFlood ? TCPIP_COMMAND_ICMP_ECHO_REQUEST_MIN_DELAY : TCPIP_STACK_COMMANDS_ICMP_ECHO_REQUEST_DELAY;
     }
 
     // convert to ticks
@@ -2983,6 +3080,15 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
     icmpCmdIoParam = cmdIoParam; 
     icmpAckRecv = 0;
     icmpReqCount = 0;
+    icmpReqPending = 0;
+    icmpTmoCount = 0;
+    icmpTxErrors = 0;
+    icmpRttMin = 0xffffffff;
+    icmpRttMax = 0;
+    icmpRttPrev = 0;
+    icmpRttSum = 0;
+    icmpJitterSum = 0;
+    memset(icmpReqSlots, 0, sizeof(icmpReqSlots));
 
     _TCPIPStackSignalHandlerSetParams(TCPIP_THIS_MODULE_ID, tcpipCmdSignalHandle, icmpReqDelay);
 
@@ -2993,6 +3099,20 @@ static int _CommandPing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 static void CommandPingHandler(const  TCPIP_ICMP_ECHO_REQUEST* pEchoReq, TCPIP_ICMP_REQUEST_HANDLE iHandle, TCPIP_ICMP_ECHO_REQUEST_RESULT result)
 {
     char addBuff[20];
+    TCPIP_CMD_PING_SLOT* pSlot;
+
+    for(pSlot = icmpReqSlots; pSlot != icmpReqSlots + sizeof(icmpReqSlots) / sizeof(*icmpReqSlots); pSlot++)
+    {
+        if(pSlot->reqHandle == iHandle)
+        {
+            break;
+        }
+    }
+
+    if(iHandle == 0 || pSlot == icmpReqSlots + sizeof(icmpReqSlots) / sizeof(*icmpReqSlots))
+    {   // not one of ours: stale request
+        return;
+    }
 
     if(result == TCPIP_ICMP_ECHO_REQUEST_RES_OK)
     {   // reply has been received
@@ -3008,7 +3128,7 @@ static void CommandPingHandler(const  TCPIP_ICMP_ECHO_REQUEST* pEchoReq, TCPIP_I
             errorMask |= 0x1;
         }
 
-        if(pEchoReq->sequenceNumber != icmpSequenceNo)
+        if(pEchoReq->sequenceNumber != pSlot->seqNo)
         {
             errorMask |= 0x2;
         }
@@ -3043,26 +3163,41 @@ static void CommandPingHandler(const  TCPIP_ICMP_ECHO_REQUEST* pEchoReq, TCPIP_I
         }
         else
         {   // good reply
-            uint32_t pingTicks = SYS_TMR_TickCountGet() - icmpStartTick;
-            int pingMs = (pingTicks * 1000) / SYS_TMR_TickCounterFrequencyGet();
-            if(pingMs == 0)
+            uint32_t rttUs = TCPIP_ICMP_EchoRequestRttGet(iHandle);
+
+            if(icmpAckRecv != 0)
             {
-                pingMs = 1;
+                icmpJitterSum += rttUs > icmpRttPrev ? rttUs - icmpRttPrev : icmpRttPrev - rttUs;
+            }
+            icmpRttPrev = rttUs;
+            icmpRttSum += rttUs;
+            if(rttUs < icmpRttMin)
+            {
+                icmpRttMin = rttUs;
+            }
+            if(rttUs > icmpRttMax)
+            {
+                icmpRttMax = rttUs;
             }
 
-            TCPIP_Helper_IPAddressToString(&pEchoReq->targetAddr, addBuff, sizeof(addBuff));
-
-            (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: reply[%d] from %s: time = %dms\r\n", ++icmpAckRecv, addBuff, pingMs);
+            ++icmpAckRecv;
+            if(!icmpFlood)
+            {
+                TCPIP_Helper_IPAddressToString(&pEchoReq->targetAddr, addBuff, sizeof(addBuff));
+                (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: reply[%d] from %s: seq = %d, time = %d.%03dms\r\n", icmpAckRecv, addBuff, pEchoReq->sequenceNumber, rttUs / 1000, rttUs % 1000);
+            }
         }
     }
     else
     {
+        icmpTmoCount++;
 #if (_TCPIP_COMMAND_PING4_DEBUG != 0)
-        (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: request aborted by ICMP with result %d\r\n", result);
+        (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: request %d aborted by ICMP with result %d\r\n", pSlot->seqNo, result);
 #endif  // (_TCPIP_COMMAND_PING4_DEBUG != 0)
     }
     // one way or the other, request is done
-    icmpReqHandle = 0;
+    pSlot->reqHandle = 0;
+    icmpReqPending--;
 }
 
 #endif  // defined(_TCPIP_COMMAND_PING4)
@@ -3222,23 +3357,28 @@ static void CommandPing6Handler(TCPIP_NET_HANDLE hNetIf,uint8_t type, const IPV6
 static void _PingStop(SYS_CMD_DEVICE_NODE* pCmdIO, const void* cmdIoParam)
 {
 #if defined(_TCPIP_COMMAND_PING4)
-    if(icmpReqHandle != 0)
+    TCPIP_CMD_PING_SLOT* pSlot;
+    for(pSlot = icmpReqSlots; pSlot != icmpReqSlots + sizeof(icmpReqSlots) / sizeof(*icmpReqSlots); pSlot++)
     {
+        if(pSlot->reqHandle != 0)
+        {
 #if (_TCPIP_COMMAND_PING4_DEBUG == 0)
-        TCPIP_ICMP_EchoRequestCancel(icmpReqHandle);
+            TCPIP_ICMP_EchoRequestCancel(pSlot->reqHandle);
 #else
-        if(TCPIP_ICMP_EchoRequestCancel(icmpReqHandle) != ICMP_ECHO_OK)
-        {   // this should NOT happen!
-            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping stop failed!\r\n");
-        }
-        else
-        { 
-            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping: request aborted by tcpip CMD: stop!\r\n");
-        }
+            if(TCPIP_ICMP_EchoRequestCancel(pSlot->reqHandle) != ICMP_ECHO_OK)
+            {   // this should NOT happen!
+                (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping stop failed!\r\n");
+            }
+            else
+            { 
+                (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Ping: request aborted by tcpip CMD: stop!\r\n");
+            }
 #endif  // (_TCPIP_COMMAND_PING4_DEBUG == 0)
 
-        icmpReqHandle = 0;
+            pSlot->reqHandle = 0;
+        }
     }
+    icmpReqPending = 0;
 #endif  // defined(_TCPIP_COMMAND_PING4)
 
     _TCPIPStackSignalHandlerSetParams(TCPIP_THIS_MODULE_ID, tcpipCmdSignalHandle, 0);
@@ -3246,6 +3386,21 @@ static void _PingStop(SYS_CMD_DEVICE_NODE* pCmdIO, const void* cmdIoParam)
     if(pCmdIO)
     {
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "Ping: done. Sent %d requests, received %d replies.\r\n", icmpReqCount, icmpAckRecv);
+#if defined(_TCPIP_COMMAND_PING4)
+        if(icmpRttSum != 0 || icmpTmoCount != 0 || icmpTxErrors != 0)
+        {   // ping4 statistics
+            if(icmpAckRecv != 0)
+            {
+                uint32_t rttAvg = (uint32_t)(icmpRttSum / icmpAckRecv);
+                uint32_t jitter = icmpAckRecv > 1 ? (uint32_t)(icmpJitterSum / (icmpAckRecv - 1)) : 0;
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "Ping: %s rtt min/avg/max/jitter = %d.%03d/%d.%03d/%d.%03d/%d.%03d ms\r\n", icmpTargetAddrStr,
+                        icmpRttMin / 1000, icmpRttMin % 1000, rttAvg / 1000, rttAvg % 1000, icmpRttMax / 1000, icmpRttMax % 1000, jitter / 1000, jitter % 1000);
+            }
+            (*pCmdIO->pCmdApi->print)(cmdIoParam, "Ping: timeouts: %d, send errors: %d\r\n", icmpTmoCount, icmpTxErrors);
+        }
+        icmpRttSum = 0;
+        icmpTmoCount = icmpTxErrors = 0;
+#endif  // defined(_TCPIP_COMMAND_PING4)
     }
     pTcpipCmdDevice = 0;
 }
@@ -3256,7 +3411,7 @@ static void TCPIPCmdPingTask(void)
 #if defined(_TCPIP_COMMAND_PING4)
     ICMP_ECHO_RESULT echoRes;
     TCPIP_ICMP_ECHO_REQUEST echoRequest;
-    bool cancelReq, newReq;
+    TCPIP_CMD_PING_SLOT* pSlot;
 #endif  // defined(_TCPIP_COMMAND_PING4)
 #if defined(_TCPIP_COMMAND_PING6)
     bool ipv6EchoRes=false;
@@ -3303,87 +3458,69 @@ static void TCPIPCmdPingTask(void)
             // no break needed here!
 
         case TCPIP_PING_CMD_DO_PING:
-            if(icmpReqCount == icmpReqNo)
-            {   // no more requests to send
-                killIcmp = true;
-                break;
-            }
-
-            // check if time for another request
-            cancelReq = newReq = false;
-            if(SYS_TMR_TickCountGet() - icmpStartTick > (SYS_TMR_TickCounterFrequencyGet() * icmpReqDelay) / 1000)
+            // the ICMP module times out the requests in flight (TCPIP_ICMP_ECHO_REQUEST_TIMEOUT)
+            // so the requests can overlap; only the window limits them
+            while(icmpReqCount != icmpReqNo && icmpReqPending < icmpReqWindow)
             {
-                cancelReq = icmpReqCount != icmpAckRecv && icmpReqHandle != 0;    // cancel if there is another one ongoing
-                newReq = true;
-            }
-            else if(icmpReqCount != icmpAckRecv)
-            {   // no reply received to the last ping 
-                if(SYS_TMR_TickCountGet() - icmpStartTick > (SYS_TMR_TickCounterFrequencyGet() * TCPIP_STACK_COMMANDS_ICMP_ECHO_TIMEOUT) / 1000)
-                {   // timeout
-#if (_TCPIP_COMMAND_PING4_DEBUG != 0)
-                    (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: request timeout.\r\n");
-#endif  // (_TCPIP_COMMAND_PING4_DEBUG != 0)
-                    cancelReq = icmpReqHandle != 0;    // cancel if there is another one ongoing
-                    newReq = true;
+                if(!icmpFlood && icmpReqCount != 0)
+                {   // check if time for another request
+                    if(SYS_TMR_TickCountGet() - icmpStartTick < (SYS_TMR_TickCounterFrequencyGet() * icmpReqDelay) / 1000)
+                    {
+                        break;
+                    }
                 }
-                // else wait some more
-            }
 
-            if(cancelReq)
-            {
-#if (_TCPIP_COMMAND_PING4_DEBUG != 0)
-                if(TCPIP_ICMP_EchoRequestCancel(icmpReqHandle) != ICMP_ECHO_OK)
-                {   // this should NOT happen!
-                    (*pTcpipCmdDevice->pCmdApi->msg)(icmpCmdIoParam, "Ping cancel failed!!!\r\n");
-                }
-                else
-                {
-                    (*pTcpipCmdDevice->pCmdApi->msg)(icmpCmdIoParam, "Ping: request aborted by tcpip CMD: tmo!\r\n");
+                for(pSlot = icmpReqSlots; pSlot->reqHandle != 0; pSlot++);  // pending < window: there's a free slot
+
+                // send another request
+                echoRequest.netH = icmpNetH;
+                echoRequest.targetAddr = icmpTargetAddr;
+                echoRequest.sequenceNumber = ++icmpSequenceNo;
+                echoRequest.identifier = icmpIdentifier;
+                echoRequest.pData = icmpPingBuff;
+                echoRequest.dataSize = icmpPingSize;
+                echoRequest.callback = CommandPingHandler;
+
+                if(!icmpFlood)
+                {   // the flood mode reuses the buffer contents
+                    int ix;
+                    uint8_t* pBuff = icmpPingBuff;
+                    for(ix = 0; ix < icmpPingSize; ix++)
+                    {
+                        *pBuff++ = SYS_RANDOM_PseudoGet();
+                    }
                 }
-#else
-                TCPIP_ICMP_EchoRequestCancel(icmpReqHandle);
-#endif  // (_TCPIP_COMMAND_PING4_DEBUG != 0)
-            }
 
-            if(!newReq)
-            {   // nothing else to do
-                break;
-            }
-
-            // send another request
-            echoRequest.netH = icmpNetH;
-            echoRequest.targetAddr = icmpTargetAddr;
-            echoRequest.sequenceNumber = ++icmpSequenceNo;
-            echoRequest.identifier = icmpIdentifier;
-            echoRequest.pData = icmpPingBuff;
-            echoRequest.dataSize = icmpPingSize;
-            echoRequest.callback = CommandPingHandler;
+                pSlot->seqNo = icmpSequenceNo;
+                echoRes = TCPIP_ICMP_EchoRequest (&echoRequest, &pSlot->reqHandle);
 
-            {
-                int ix;
-                uint8_t* pBuff = icmpPingBuff;
-                for(ix = 0; ix < icmpPingSize; ix++)
+                if(echoRes >= 0 )
                 {
-                    *pBuff++ = SYS_RANDOM_PseudoGet();
-                }
-            }
-
-            echoRes = TCPIP_ICMP_EchoRequest (&echoRequest, &icmpReqHandle);
-
-            if(echoRes >= 0 )
-            {
-                icmpStartTick = SYS_TMR_TickCountGet();
-                icmpReqCount++;
+                    icmpStartTick = SYS_TMR_TickCountGet();
+                    icmpReqCount++;
+                    icmpReqPending++;
 #if (_TCPIP_COMMAND_PING4_DEBUG != 0)
-                (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: sent request %d to: %s [%s]\r\n", icmpReqCount, icmpTargetHost, icmpTargetAddrStr);
+                    (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: sent request %d to: %s [%s]\r\n", icmpReqCount, icmpTargetHost, icmpTargetAddrStr);
 #endif  // (_TCPIP_COMMAND_PING4_DEBUG != 0)
-            }
-            else
-            {
+                    continue;
+                }
+
+                pSlot->reqHandle = 0;
+                if(icmpFlood && (echoRes == ICMP_ECHO_BUSY || echoRes == ICMP_ECHO_ALLOC_ERROR))
+                {   // out of ICMP slots or packets; retry on the next tick
+                    icmpTxErrors++;
+                    break;
+                }
 #if (_TCPIP_COMMAND_PING4_DEBUG != 0)
                 (*pTcpipCmdDevice->pCmdApi->print)(icmpCmdIoParam, "Ping: failed to send request %d to: %s, error %d\r\n", icmpReqCount, icmpTargetAddrStr, echoRes);
 #endif  // (_TCPIP_COMMAND_PING4_DEBUG != 0)
                 killIcmp = true;
+                break;
+            }
+
+            if(icmpReqCount == icmpReqNo && icmpReqPending == 0)
+            {   // all requests done
+                killIcmp = true;
             }
 
             break;
@@ -3499,6 +3636,12 @@ void TCPIP_COMMAND_Task(void)
             TCPIPCmdMiimTask();
         }
 #endif  // defined(_TCPIP_COMMANDS_MIIM)
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+        if(TCPIP_CMD_STAT_RING_START <= tcpipCmdStat && tcpipCmdStat <= TCPIP_CMD_STAT_RING_STOP)
+        {
+            TCPIPCmdRingTask();
+        }
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
     }
 }
 
@@ -4935,6 +5078,804 @@ static void _CommandPktLogDefHandler(TCPIP_STACK_MODULE moduleId, const TCPIP_PK
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+static int _Command_PktRing(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // pring info/show/freeze/reset/dump/send/stop
+    int ix, nShow;
+    TCPIP_PKT_RING_INFO ringInfo;
+    TCPIP_PKT_RING_RECORD ringRec;
+    uint32_t tStampUs;
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    if(argc < 2)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring info - Displays the trace ring counters\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring show <n> - Displays the last n records (default 10)\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring freeze on/off - Suspends/resumes the capture\r\n");
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring reset - Discards all records\r\n");
+#if defined(_TCPIP_STACK_COMMAND_TASK)
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring dump - Exports the ring as pcapng hex; decode with: xxd -r -p\r\n");
+#if defined(TCPIP_STACK_USE_TCP)
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring send <addr> <port> - Exports the ring as pcapng to a TCP server\r\n");
+#endif  // defined(TCPIP_STACK_USE_TCP)
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: pring stop - Aborts an export in progress\r\n");
+#endif  // defined(_TCPIP_STACK_COMMAND_TASK)
+        return false;
+    }
+
+    TCPIP_PKT_RingGetInfo(&ringInfo);
+
+    if(strcmp(argv[1], "info") == 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "pring records: %d, valid: %d, snap: %d, frozen: %d\r\n", ringInfo.nRecords, ringInfo.nValid, ringInfo.snapLen, ringInfo.frozen);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "pring captured: %lu, overwritten: %lu, skipped: %lu, ts freq: %lu\r\n", ringInfo.nCaptured, ringInfo.nOverwritten, ringInfo.nSkipped, ringInfo.tStampFreq);
+    }
+    else if(strcmp(argv[1], "show") == 0)
+    {
+        nShow = argc > 2 ? atoi(argv[2]) : 10;
+        if(nShow <= 0 || nShow > ringInfo.nValid)
+        {
+            nShow = ringInfo.nValid;
+        }
+
+        for(ix = ringInfo.nValid - nShow; ix < ringInfo.nValid; ix++)
+        {
+            if(TCPIP_PKT_RingGetRecord(ix, &ringRec))
+            {
+                // 64 bit scaling; the frequency can be below 1 MHz
+                tStampUs = (uint32_t)((ringRec.tStamp / ringInfo.tStampFreq) * 1000000ull + ((ringRec.tStamp % ringInfo.tStampFreq) * 1000000ull) / ringInfo.tStampFreq);
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "%5d %10lu us if %d %s len %4d type 0x%02x%02x\r\n", ringRec.seqNo, tStampUs, ringRec.netIx,
+                        (ringRec.logFlags & TCPIP_PKT_LOG_FLAG_RX) != 0 ? "RX" : "TX", ringRec.origLen, ringRec.frameData[12], ringRec.frameData[13]);
+            }
+        }
+    }
+    else if(strcmp(argv[1], "freeze") == 0 && argc > 2)
+    {
+        TCPIP_PKT_RingFreeze(strcmp(argv[2], "on") == 0);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "pring: capture %s\r\n", strcmp(argv[2], "on") == 0 ? "frozen" : "resumed");
+    }
+    else if(strcmp(argv[1], "reset") == 0)
+    {
+        TCPIP_PKT_RingReset();
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring: reset\r\n");
+    }
+#if defined(_TCPIP_STACK_COMMAND_TASK)
+    else if(strcmp(argv[1], "stop") == 0)
+    {
+        if(TCPIP_CMD_STAT_RING_START <= tcpipCmdStat && tcpipCmdStat <= TCPIP_CMD_STAT_RING_STOP)
+        {
+            TCPIP_PKT_RingExportAbort();
+#if defined(TCPIP_STACK_USE_TCP)
+            if(ringSkt != INVALID_SOCKET)
+            {
+                TCPIP_TCP_Close(ringSkt);
+                ringSkt = INVALID_SOCKET;
+            }
+#endif  // defined(TCPIP_STACK_USE_TCP)
+            tcpipCmdStat = TCPIP_CMD_STAT_IDLE;
+            _TCPIPStackSignalHandlerSetParams(TCPIP_THIS_MODULE_ID, tcpipCmdSignalHandle, 0);
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring: export aborted\r\n");
+        }
+    }
+    else if(strcmp(argv[1], "dump") == 0 || strcmp(argv[1], "send") == 0)
+    {
+        if(tcpipCmdStat != TCPIP_CMD_STAT_IDLE)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring: command in progress. Retry later.\r\n");
+            return false;
+        }
+
+        if(strcmp(argv[1], "dump") == 0)
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "---pcapng begin---\r\n");
+            tcpipCmdStat = TCPIP_RING_CMD_DUMP;
+        }
+#if defined(TCPIP_STACK_USE_TCP)
+        else
+        {
+            IP_MULTI_ADDRESS srvAddr;
+            if(argc < 4 || !TCPIP_Helper_StringToIPAddress(argv[2], &srvAddr.v4Add))
+            {
+                (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring send: Invalid address\r\n");
+                return false;
+            }
+
+            ringSkt = TCPIP_TCP_ClientOpen(IP_ADDRESS_TYPE_IPV4, (TCP_PORT)atoi(argv[3]), &srvAddr);
+            if(ringSkt == INVALID_SOCKET)
+            {
+                (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring send: Failed to open a socket\r\n");
+                return false;
+            }
+            ringStartTick = SYS_TMR_TickCountGet();
+            tcpipCmdStat = TCPIP_RING_CMD_CONNECT;
+        }
+#else
+        else
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring send: TCP not enabled\r\n");
+            return false;
+        }
+#endif  // defined(TCPIP_STACK_USE_TCP)
+
+        pTcpipCmdDevice = pCmdIO;
+        ringCmdIoParam = cmdIoParam;
+        ringExportIx = 0;
+        ringExportBytes = 0;
+        _TCPIPStackSignalHandlerSetParams(TCPIP_THIS_MODULE_ID, tcpipCmdSignalHandle, TCPIP_RING_COMMAND_TASK_RATE);
+    }
+#endif  // defined(_TCPIP_STACK_COMMAND_TASK)
+    else
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "pring: Unknown parameter\r\n");
+    }
+
+    return false;
+}
+
+#if defined(_TCPIP_STACK_COMMAND_TASK)
+// prints a pcapng block as plain hex, 32 bytes per line
+static bool _CommandRingWriteConsole(const void* buff, size_t len, const void* param)
+{
+    size_t ix;
+    char lineBuff[2 * 32 + 3];
+    char* pLine;
+    const uint8_t* pData = (const uint8_t*)buff;
+    static const char hexDigits[] = "0123456789abcdef";
+
+    if(len > ringBudget && ringExportBytes != 0)
+    {   // over the budget for this run; always let the 1st block go
+        return false;
+    }
+
+    pLine = lineBuff;
+    for(ix = 0; ix < len; ix++)
+    {
+        *pLine++ = hexDigits[pData[ix] >> 4];
+        *pLine++ = hexDigits[pData[ix] & 0x0f];
+        if((ix & 0x1f) == 0x1f || ix == len - 1)
+        {
+            *pLine++ = '\r';
+            *pLine++ = '\n';
+            *pLine = 0;
+            (*pTcpipCmdDevice->pCmdApi->msg)(ringCmdIoParam, lineBuff);
+            pLine = lineBuff;
+        }
+    }
+
+    ringBudget = len > ringBudget ? 0 : ringBudget - len;
+    ringExportBytes += len;
+    return true;
+}
+
+#if defined(TCPIP_STACK_USE_TCP)
+static bool _CommandRingWriteSkt(const void* buff, size_t len, const void* param)
+{
+    if(TCPIP_TCP_PutIsReady(ringSkt) < len)
+    {
+        return false;
+    }
+
+    TCPIP_TCP_ArrayPut(ringSkt, (const uint8_t*)buff, len);
+    ringExportBytes += len;
+    return true;
+}
+#endif  // defined(TCPIP_STACK_USE_TCP)
+
+static void TCPIPCmdRingTask(void)
+{
+    bool exportDone = false;
+
+    switch(tcpipCmdStat)
+    {
+        case TCPIP_RING_CMD_DUMP:
+            ringBudget = TCPIP_RING_COMMAND_CONSOLE_BUDGET;
+            ringExportIx = TCPIP_PKT_RingExport(ringExportIx, _CommandRingWriteConsole, 0);
+            if(ringExportIx <= 0)
+            {
+                (*pTcpipCmdDevice->pCmdApi->print)(ringCmdIoParam, "---pcapng end---\r\npring: exported %lu bytes\r\n", ringExportBytes);
+                exportDone = true;
+            }
+            break;
+
+#if defined(TCPIP_STACK_USE_TCP)
+        case TCPIP_RING_CMD_CONNECT:
+            if(TCPIP_TCP_IsConnected(ringSkt))
+            {
+                tcpipCmdStat = TCPIP_RING_CMD_SEND;
+            }
+            else if((SYS_TMR_TickCountGet() - ringStartTick) / SYS_TMR_TickCounterFrequencyGet() >= TCPIP_RING_COMMAND_CONNECT_TMO)
+            {
+                (*pTcpipCmdDevice->pCmdApi->msg)(ringCmdIoParam, "pring send: connect timeout\r\n");
+                TCPIP_TCP_Close(ringSkt);
+                ringSkt = INVALID_SOCKET;
+                exportDone = true;
+            }
+            break;
+
+        case TCPIP_RING_CMD_SEND:
+            if(!TCPIP_TCP_IsConnected(ringSkt))
+            {
+                (*pTcpipCmdDevice->pCmdApi->msg)(ringCmdIoParam, "pring send: connection lost\r\n");
+                TCPIP_PKT_RingExportAbort();
+                TCPIP_TCP_Close(ringSkt);
+                ringSkt = INVALID_SOCKET;
+                exportDone = true;
+                break;
+            }
+
+            ringExportIx = TCPIP_PKT_RingExport(ringExportIx, _CommandRingWriteSkt, 0);
+            TCPIP_TCP_Flush(ringSkt);
+            if(ringExportIx <= 0)
+            {
+                tcpipCmdStat = TCPIP_RING_CMD_CLOSE;
+            }
+            break;
+
+        case TCPIP_RING_CMD_CLOSE:
+            if(TCPIP_TCP_IsConnected(ringSkt) && TCPIP_TCP_FifoTxFullGet(ringSkt) != 0)
+            {   // wait for the data to go out
+                TCPIP_TCP_Flush(ringSkt);
+                break;
+            }
+            TCPIP_TCP_Close(ringSkt);
+            ringSkt = INVALID_SOCKET;
+            (*pTcpipCmdDevice->pCmdApi->print)(ringCmdIoParam, "pring send: exported %lu bytes\r\n", ringExportBytes);
+            exportDone = true;
+            break;
+#endif  // defined(TCPIP_STACK_USE_TCP)
+
+        default:
+            exportDone = true;
+            break;
+    }
+
+    if(exportDone)
+    {
+        tcpipCmdStat = TCPIP_CMD_STAT_IDLE;
+        _TCPIPStackSignalHandlerSetParams(TCPIP_THIS_MODULE_ID, tcpipCmdSignalHandle, 0);
+    }
+}
+#endif  // defined(_TCPIP_STACK_COMMAND_TASK)
+
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
+
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+// module names for the stack statistics
+// modules past the table are displayed by number
+static const char* _CommandStatModuleNames[] = 
+{
+    "none",         // TCPIP_MODULE_NONE
+    "mgr",          // TCPIP_MODULE_MANAGER
+    "arp",          // TCPIP_MODULE_ARP
+    "ip4",          // TCPIP_MODULE_IPV4
+    "ip6",          // TCPIP_MODULE_IPV6
+    "lldp",         // TCPIP_MODULE_LLDP
+    "icmp",         // TCPIP_MODULE_ICMP
+    "icmp6",        // TCPIP_MODULE_ICMPV6
+    "ndp",          // TCPIP_MODULE_NDP
+    "udp",          // TCPIP_MODULE_UDP
+    "tcp",          // TCPIP_MODULE_TCP
+    "igmp",         // TCPIP_MODULE_IGMP
+};
+
+// counter names, TCPIP_STACK_STAT_TYPE order
+static const char* _CommandStatTypeNames[TCPIP_STACK_STAT_TYPES] = 
+{
+    "rx", "tx", "txf", "drop", "rtx", "allocf",
+};
+
+// drop reason names, indexed by -TCPIP_MAC_PKT_ACK_RES
+// "extern" and "brdone" are hand-offs, reported separately
+static const char* _CommandStatDropNames[TCPIP_STACK_STAT_DROP_REASONS] = 
+{
+    "other", "linkdn", "netdn", "buff", "arptmo", "arpnet", "macrej", 0, 0, 0,
+    "chksum", "src", "dst", "type", "struct", "proto", "frag", "close", "alloc", "iprej",
+    "extern", "brdone", "brdisc",
+};
+
+// values reported by the previous stackstat command
+static TCPIP_STACK_STAT_SNAPSHOT    _cmdStatPrev;
+
+static int _Command_StackStat(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // stackstat <diff/clr>
+    // one line per module with non zero counters: "name k=v k=v ..."
+    int modIx, statIx;
+    uint32_t currVal, statVal[TCPIP_STACK_STAT_TYPES];
+    bool isDiff = false;
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    if(argc > 1)
+    {
+        if(strcmp(argv[1], "diff") == 0)
+        {
+            isDiff = true;
+        }
+        else if(strcmp(argv[1], "clr") == 0)
+        {
+            TCPIP_STACK_StatClear();
+            memset(&_cmdStatPrev, 0, sizeof(_cmdStatPrev));
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "stackstat: cleared\r\n");
+            return false;
+        }
+        else
+        {
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: stackstat - Displays the stack counters\r\n");
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: stackstat diff - Displays the counter changes since the previous stackstat\r\n");
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: stackstat clr - Clears all counters\r\n");
+            return false;
+        }
+    }
+
+    uint32_t currTick = SYS_TMR_TickCountGet();
+    uint32_t deltaTick = currTick - _cmdStatPrev.tStamp;
+    uint32_t tickFreq = SYS_TMR_TickCounterFrequencyGet();
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "stat t=%lu dt=%lu\r\n", (currTick / tickFreq) * 1000 + ((currTick % tickFreq) * 1000) / tickFreq,
+            (deltaTick / tickFreq) * 1000 + ((deltaTick % tickFreq) * 1000) / tickFreq);
+    _cmdStatPrev.tStamp = currTick;
+
+    for(modIx = 0; modIx < TCPIP_MODULES_NUMBER; modIx++)
+    {
+        bool nonZero = false;
+        for(statIx = 0; statIx < TCPIP_STACK_STAT_TYPES; statIx++)
+        {
+            currVal = TCPIP_STACK_StatGet((TCPIP_STACK_MODULE)modIx, (TCPIP_STACK_STAT_TYPE)statIx);
+            statVal[statIx] = isDiff ? currVal - _cmdStatPrev.modStat[modIx][statIx] : currVal;
+            _cmdStatPrev.modStat[modIx][statIx] = currVal;
+            nonZero |= statVal[statIx] != 0;
+        }
+
+        if(nonZero)
+        {
+            if(modIx < sizeof(_CommandStatModuleNames) / sizeof(*_CommandStatModuleNames))
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "%s", _CommandStatModuleNames[modIx]);
+            }
+            else
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, "m%d", modIx);
+            }
+            for(statIx = 0; statIx < TCPIP_STACK_STAT_TYPES; statIx++)
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, " %s=%lu", _CommandStatTypeNames[statIx], statVal[statIx]);
+            }
+            (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+        }
+    }
+
+    uint32_t handoffVal[2];
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "drop");
+    for(statIx = 0; statIx < TCPIP_STACK_STAT_DROP_REASONS; statIx++)
+    {
+        currVal = TCPIP_STACK_StatDropGet((TCPIP_MAC_PKT_ACK_RES)(-statIx));
+        uint32_t dropVal = isDiff ? currVal - _cmdStatPrev.dropReason[statIx] : currVal;
+        _cmdStatPrev.dropReason[statIx] = currVal;
+        if(statIx == -TCPIP_MAC_PKT_ACK_EXTERN || statIx == -TCPIP_MAC_PKT_ACK_BRIDGE_DONE)
+        {   // not a drop
+            handoffVal[statIx == -TCPIP_MAC_PKT_ACK_EXTERN ? 0 : 1] = dropVal;
+        }
+        else if(dropVal != 0)
+        {
+            if(_CommandStatDropNames[statIx] != 0)
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, " %s=%lu", _CommandStatDropNames[statIx], dropVal);
+            }
+            else
+            {
+                (*pCmdIO->pCmdApi->print)(cmdIoParam, " r%d=%lu", statIx, dropVal);
+            }
+        }
+    }
+    (*pCmdIO->pCmdApi->msg)(cmdIoParam, "\r\n");
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "handoff %s=%lu %s=%lu\r\n", _CommandStatDropNames[-TCPIP_MAC_PKT_ACK_EXTERN], handoffVal[0],
+            _CommandStatDropNames[-TCPIP_MAC_PKT_ACK_BRIDGE_DONE], handoffVal[1]);
+
+    return true;
+}
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
+
+#if (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
+#define _TCPIP_COMMAND_CHKSUM_BENCH_MAX_SIZE    2000
+
+// the classic 16 bits at a time checksum; the benchmark reference
+static uint16_t _CommandChksumRef16(const uint8_t* buffer, uint16_t count)
+{
+    uint32_t sum = 0;
+    const uint16_t* pW = (const uint16_t*)buffer;
+
+    while(count > 1)
+    {
+        sum += *pW++;
+        count -= 2;
+    }
+    if(count != 0)
+    {
+        sum += *(const uint8_t*)pW;
+    }
+
+    return ~TCPIP_Helper_ChecksumFold(sum);
+}
+
+// returns the ns per operation for the elapsed system count
+static uint32_t _CommandBenchNs(uint64_t sysCount, uint32_t nOps)
+{
+    uint64_t ns = (sysCount * 1000000000ull) / SYS_TMR_SystemCountFrequencyGet();
+    return (uint32_t)(ns / nOps);
+}
+
+static int _Command_ChksumBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // chkbench <size> <iterations>
+    int ix, nIters, bSize;
+    uint8_t *pSrc, *pDst;
+    uint64_t tStart;
+    uint32_t nsRef, nsCalc, nsCopyCalc, nsCopyChk, nsHdr, nsAdj;
+    uint16_t chkRef, chkCalc, chkCopy, chkHdr, chkAdj;
+    volatile uint16_t chkSink = 0;  // keep the calls from being optimized out
+    uint16_t hdr[10];
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    bSize = argc > 1 ? atoi(argv[1]) : 1460;
+    nIters = argc > 2 ? atoi(argv[2]) : 1000;
+    if(bSize <= 0 || bSize > _TCPIP_COMMAND_CHKSUM_BENCH_MAX_SIZE || nIters <= 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "Usage: chkbench <size> <iterations> - size: 1 - %d, default 1460 bytes, 1000 iterations\r\n", _TCPIP_COMMAND_CHKSUM_BENCH_MAX_SIZE);
+        return false;
+    }
+
+    pSrc = (uint8_t*)TCPIP_STACK_MALLOC_FUNC(2 * bSize);
+    if(pSrc == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "chkbench: Failed to allocate memory\r\n");
+        return false;
+    }
+    pDst = pSrc + bSize;
+
+    for(ix = 0; ix < bSize; ix++)
+    {
+        pSrc[ix] = (uint8_t)(ix * 7 + 1);
+    }
+    for(ix = 0; ix < sizeof(hdr) / sizeof(*hdr); ix++)
+    {
+        hdr[ix] = (uint16_t)(ix * 0x1111 + 0x4500);
+    }
+    hdr[5] = 0;
+    hdr[5] = TCPIP_Helper_CalcIPChecksum((uint8_t*)hdr, sizeof(hdr), 0);
+
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        chkSink += _CommandChksumRef16(pSrc, bSize);
+    }
+    nsRef = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        chkSink += TCPIP_Helper_CalcIPChecksum(pSrc, bSize, 0);
+    }
+    nsCalc = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        memcpy(pDst, pSrc, bSize);
+        chkSink += TCPIP_Helper_CalcIPChecksum(pDst, bSize, 0);
+    }
+    nsCopyCalc = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        chkSink += TCPIP_Helper_CalcIPChecksumCopy(pDst, pSrc, bSize, 0);
+    }
+    nsCopyChk = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+
+    // header update: full recalculation vs RFC 1624 adjust of the TTL word
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        hdr[4] -= 0x100;
+        hdr[5] = 0;
+        hdr[5] = TCPIP_Helper_CalcIPChecksum((uint8_t*)hdr, sizeof(hdr), 0);
+    }
+    nsHdr = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+    chkHdr = TCPIP_Helper_CalcIPChecksum((uint8_t*)hdr, sizeof(hdr), 0);
+
+    tStart = SYS_TMR_SystemCountGet();
+    for(ix = 0; ix < nIters; ix++)
+    {
+        uint16_t oldWord = hdr[4];
+        hdr[4] -= 0x100;
+        hdr[5] = TCPIP_Helper_ChecksumAdjust(hdr[5], oldWord, hdr[4]);
+    }
+    nsAdj = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+    chkAdj = TCPIP_Helper_CalcIPChecksum((uint8_t*)hdr, sizeof(hdr), 0);
+
+    // results check
+    chkRef = _CommandChksumRef16(pSrc, bSize);
+    chkCalc = TCPIP_Helper_CalcIPChecksum(pSrc, bSize, 0);
+    chkCopy = TCPIP_Helper_CalcIPChecksumCopy(pDst, pSrc, bSize, 0);
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "chkbench: %d bytes, %d iterations, ns per call:\r\n", bSize, nIters);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tref16: %lu, calc: %lu, memcpy+calc: %lu, copychk: %lu\r\n", nsRef, nsCalc, nsCopyCalc, nsCopyChk);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\thdr recalc: %lu, hdr adjust: %lu\r\n", nsHdr, nsAdj);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tcheck: ref16: 0x%04x, calc: 0x%04x, copychk: 0x%04x, hdr: 0x%04x, adjust: 0x%04x - %s\r\n", chkRef, chkCalc, chkCopy, chkHdr, chkAdj,
+            (chkRef == chkCalc && chkRef == chkCopy && chkHdr == 0 && chkAdj == 0) ? "OK" : "FAIL");
+
+    TCPIP_STACK_FREE_FUNC(pSrc);
+    return true;
+}
+
+// OA hash benchmark entry: 32-bit key, like the ARP cache
+typedef struct
+{
+    OA_HASH_ENTRY   hEntry;
+    uint32_t        key;
+    uint32_t        data;
+}_CMD_OA_BENCH_ENTRY;
+
+static size_t _CommandOaBenchHash(OA_HASH_DCPT* pOH, const void* key)
+{
+    uint32_t v = *(const uint32_t*)key * 0x9e3779b1U;
+    return (v ^ (v >> 16)) % pOH->hEntries;
+}
+
+static int _CommandOaBenchCompare(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* hEntry, const void* key)
+{
+    return ((_CMD_OA_BENCH_ENTRY*)hEntry)->key != *(const uint32_t*)key;
+}
+
+static void _CommandOaBenchCopy(OA_HASH_DCPT* pOH, OA_HASH_ENTRY* dstEntry, const void* key)
+{
+    ((_CMD_OA_BENCH_ENTRY*)dstEntry)->key = *(const uint32_t*)key;
+}
+
+static int _Command_OaHashBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // oabench <entries> <iterations>
+    static const int loadTbl[] = {25, 50, 75, 90, 100};     // load factors, %
+    int ix, lx, iter, nEntries, nIters, nKeys, nFail;
+    uint32_t key, probeSum;
+    uint64_t tStart;
+    uint32_t nsHit, nsHit32, nsMiss, nsMiss32;
+    OA_HASH_DCPT* pOH;
+    OA_HASH_ENTRY* hE;
+    volatile uintptr_t sink = 0;    // keep the calls from being optimized out
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    nEntries = argc > 1 ? atoi(argv[1]) : 127;
+    nIters = argc > 2 ? atoi(argv[2]) : 100;
+    if(nEntries < 4 || nIters <= 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "Usage: oabench <entries> <iterations> - default 127 entries, 100 iterations\r\n");
+        return false;
+    }
+
+    pOH = (OA_HASH_DCPT*)TCPIP_STACK_MALLOC_FUNC(sizeof(OA_HASH_DCPT) + nEntries * sizeof(_CMD_OA_BENCH_ENTRY));
+    if(pOH == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "oabench: Failed to allocate memory\r\n");
+        return false;
+    }
+
+    pOH->memBlk = pOH + 1;
+    pOH->hParam = 0;
+    pOH->hEntrySize = sizeof(_CMD_OA_BENCH_ENTRY);
+    pOH->hEntries = nEntries;
+    pOH->probeStep = 1;
+#if defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+    pOH->hashF = _CommandOaBenchHash;
+#if defined(OA_DOUBLE_HASH_PROBING)
+    pOH->probeHash = _CommandOaBenchHash;
+#endif  // defined(OA_DOUBLE_HASH_PROBING)
+    pOH->delF = 0;
+    pOH->cmpF = _CommandOaBenchCompare;
+    pOH->cpyF = _CommandOaBenchCopy; 
+#endif  // defined ( OA_HASH_DYNAMIC_KEY_MANIPULATION )
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "oabench: %d entries, %d iterations, ns per look up:\r\n", nEntries, nIters);
+    for(lx = 0; lx < sizeof(loadTbl) / sizeof(*loadTbl); lx++)
+    {
+        TCPIP_OAHASH_Initialize(pOH);
+        nKeys = (nEntries * loadTbl[lx]) / 100;
+        nFail = 0;
+        probeSum = 0;
+        for(ix = 0; ix < nKeys; ix++)
+        {   // even key indexes are present, odd ones are misses
+            key = ((uint32_t)ix << 1) * 2654435761U + 0x0a000001;
+            if((hE = TCPIP_OAHASH_EntryLookupOrInsert(pOH, &key)) == 0)
+            {
+                nFail++;
+            }
+            else
+            {
+                probeSum += hE->probeCount;
+            }
+        }
+
+        tStart = SYS_TMR_SystemCountGet();
+        for(iter = 0; iter < nIters; iter++)
+        {
+            for(ix = 0; ix < nKeys; ix++)
+            {
+                key = ((uint32_t)ix << 1) * 2654435761U + 0x0a000001;
+                sink += (uintptr_t)TCPIP_OAHASH_EntryLookup(pOH, &key);
+            }
+        }
+        nsHit = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters * nKeys);
+
+        tStart = SYS_TMR_SystemCountGet();
+        for(iter = 0; iter < nIters; iter++)
+        {
+            for(ix = 0; ix < nKeys; ix++)
+            {
+                key = ((uint32_t)ix << 1) * 2654435761U + 0x0a000001;
+                sink += (uintptr_t)TCPIP_OAHASH_EntryLookupKey32(pOH, key, offsetof(_CMD_OA_BENCH_ENTRY, key));
+            }
+        }
+        nsHit32 = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters * nKeys);
+
+        tStart = SYS_TMR_SystemCountGet();
+        for(iter = 0; iter < nIters; iter++)
+        {
+            for(ix = 0; ix < nKeys; ix++)
+            {
+                key = (((uint32_t)ix << 1) + 1) * 2654435761U + 0x0a000001;
+                sink += (uintptr_t)TCPIP_OAHASH_EntryLookup(pOH, &key);
+            }
+        }
+        nsMiss = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters * nKeys);
+
+        tStart = SYS_TMR_SystemCountGet();
+        for(iter = 0; iter < nIters; iter++)
+        {
+            for(ix = 0; ix < nKeys; ix++)
+            {
+                key = (((uint32_t)ix << 1) + 1) * 2654435761U + 0x0a000001;
+                sink += (uintptr_t)TCPIP_OAHASH_EntryLookupKey32(pOH, key, offsetof(_CMD_OA_BENCH_ENTRY, key));
+            }
+        }
+        nsMiss32 = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters * nKeys);
+
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tload %d%%: hit: %lu, hit32: %lu, miss: %lu, miss32: %lu, avg probe: %d.%02d, max probe: %d, fail: %d\r\n",
+                loadTbl[lx], nsHit, nsHit32, nsMiss, nsMiss32, nKeys ? probeSum / nKeys : 0, nKeys ? ((probeSum * 100) / nKeys) % 100 : 0, pOH->maxProbe, nFail);
+    }
+
+    TCPIP_STACK_FREE_FUNC(pOH);
+    return true;
+}
+
+#define _TCPIP_COMMAND_HASH_BENCH_MAX_SIZE  256     // max key size
+#define _TCPIP_COMMAND_HASH_BENCH_KEYS      4096    // keys for the distribution test
+#define _TCPIP_COMMAND_HASH_BENCH_BUCKETS   256     // buckets for the distribution test
+
+typedef enum
+{
+    _CMD_HASH_FNV_32,
+    _CMD_HASH_FNV_32A,
+    _CMD_HASH_XXH_32,
+
+    _CMD_HASH_TYPES
+}_CMD_HASH_TYPE;
+
+static const char* const _CommandHashNames[_CMD_HASH_TYPES] = { "fnv32", "fnv32a", "xxh32" };
+
+static uint32_t _CommandHashCalc(_CMD_HASH_TYPE hType, const void* key, size_t keyLen)
+{
+    switch(hType)
+    {
+        case _CMD_HASH_FNV_32:
+            return fnv_32_hash(key, keyLen);
+
+        case _CMD_HASH_FNV_32A:
+            return fnv_32a_hash(key, keyLen);
+
+        default:
+            return xxh_32_hash(key, keyLen, 0);
+    }
+}
+
+static int _Command_HashBench(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
+{
+    // hashbench <size> <iterations>
+    int ix, bx, nIters, kSize, kLen, maxLoad, diff;
+    _CMD_HASH_TYPE hType;
+    XXH_32_STATE xState;
+    uint8_t* pKey;
+    uint16_t* pCount;
+    uint64_t tStart;
+    uint32_t nsCall, chiMask, chiMod, hash;
+    char keyBuff[32];
+    volatile uint32_t sink = 0;     // keep the calls from being optimized out
+    const int expLoad = _TCPIP_COMMAND_HASH_BENCH_KEYS / _TCPIP_COMMAND_HASH_BENCH_BUCKETS;
+    const void* cmdIoParam = pCmdIO->cmdIoParam;
+
+    kSize = argc > 1 ? atoi(argv[1]) : 32;
+    nIters = argc > 2 ? atoi(argv[2]) : 1000;
+    if(kSize <= 0 || kSize > _TCPIP_COMMAND_HASH_BENCH_MAX_SIZE || nIters <= 0)
+    {
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "Usage: hashbench <size> <iterations> - size: 1 - %d, default 32 bytes, 1000 iterations\r\n", _TCPIP_COMMAND_HASH_BENCH_MAX_SIZE);
+        return false;
+    }
+
+    pKey = (uint8_t*)TCPIP_STACK_MALLOC_FUNC(kSize + 2 * _TCPIP_COMMAND_HASH_BENCH_BUCKETS * sizeof(*pCount));
+    if(pKey == 0)
+    {
+        (*pCmdIO->pCmdApi->msg)(cmdIoParam, "hashbench: Failed to allocate memory\r\n");
+        return false;
+    }
+    pCount = (uint16_t*)(((uintptr_t)pKey + kSize + 1) & ~(uintptr_t)1);
+    for(ix = 0; ix < kSize; ix++)
+    {
+        pKey[ix] = (uint8_t)('a' + ix % 26);
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "hashbench: %d bytes, %d iterations\r\n", kSize, nIters);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\t%d similar keys in %d buckets, chi2 expected ~%d:\r\n", _TCPIP_COMMAND_HASH_BENCH_KEYS, _TCPIP_COMMAND_HASH_BENCH_BUCKETS, _TCPIP_COMMAND_HASH_BENCH_BUCKETS - 1);
+    for(hType = 0; hType < _CMD_HASH_TYPES; hType++)
+    {
+        tStart = SYS_TMR_SystemCountGet();
+        for(ix = 0; ix < nIters; ix++)
+        {
+            sink += _CommandHashCalc(hType, pKey, kSize);
+        }
+        nsCall = _CommandBenchNs(SYS_TMR_SystemCountGet() - tStart, nIters);
+
+        // distribution of host name like keys: low bits mask and modulo a prime
+        memset(pCount, 0, 2 * _TCPIP_COMMAND_HASH_BENCH_BUCKETS * sizeof(*pCount));
+        for(ix = 0; ix < _TCPIP_COMMAND_HASH_BENCH_KEYS; ix++)
+        {
+            kLen = sprintf(keyBuff, "host%d.lan", ix);
+            hash = _CommandHashCalc(hType, keyBuff, kLen);
+            pCount[hash & (_TCPIP_COMMAND_HASH_BENCH_BUCKETS - 1)]++;
+            pCount[_TCPIP_COMMAND_HASH_BENCH_BUCKETS + hash % (_TCPIP_COMMAND_HASH_BENCH_BUCKETS - 5)]++;
+        }
+
+        chiMask = chiMod = 0;
+        maxLoad = 0;
+        for(bx = 0; bx < _TCPIP_COMMAND_HASH_BENCH_BUCKETS; bx++)
+        {
+            diff = (int)pCount[bx] - expLoad;
+            chiMask += diff * diff;
+            if(pCount[bx] > maxLoad)
+            {
+                maxLoad = pCount[bx];
+            }
+        }
+        for(bx = 0; bx < _TCPIP_COMMAND_HASH_BENCH_BUCKETS - 5; bx++)
+        {   // 251 buckets; keep the same expected load approximation
+            diff = (int)pCount[_TCPIP_COMMAND_HASH_BENCH_BUCKETS + bx] - expLoad;
+            chiMod += diff * diff;
+        }
+
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "\t%s: %lu ns, chi2 mask: %lu, chi2 mod: %lu, max bucket: %d\r\n", _CommandHashNames[hType], nsCall, chiMask / expLoad, chiMod / expLoad, maxLoad);
+    }
+
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tcheck: literal: 0x%08lx, fnv32a: 0x%08lx - %s\r\n", FNV_32A_LITERAL("https"), fnv_32a_hash("https", 5),
+            FNV_32A_LITERAL("https") == fnv_32a_hash("https", 5) ? "OK" : "FAIL");
+
+    // streaming update in uneven chunks should match the one shot result
+    xxh_32_init(&xState, 0);
+    for(ix = 0; ix < kSize; ix += bx)
+    {
+        bx = (ix & 7) + 1;
+        if(ix + bx > kSize)
+        {
+            bx = kSize - ix;
+        }
+        xxh_32_update(&xState, pKey + ix, bx);
+    }
+    hash = xxh_32_final(&xState);
+    (*pCmdIO->pCmdApi->print)(cmdIoParam, "\tcheck: xxh32 stream: 0x%08lx, one shot: 0x%08lx - %s\r\n", hash, xxh_32_hash(pKey, kSize, 0),
+            hash == xxh_32_hash(pKey, kSize, 0) ? "OK" : "FAIL");
+
+    TCPIP_STACK_FREE_FUNC(pKey);
+    return true;
+}
+#endif  // (TCPIP_STACK_COMMANDS_BENCH_ENABLE != 0)
+
 
 #if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
 static int _Command_PktInfo(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
@@ -5830,6 +6771,8 @@ static void _CommandIpv4Arp(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
     {
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "pool: %d, pend: %d, txSubmit: %d, fwdSubmit: %d\r\n", arpStat.nPool, arpStat.nPend, arpStat.txSubmit, arpStat.fwdSubmit);
         (*pCmdIO->pCmdApi->print)(cmdIoParam, "txSolved: %d, fwdSolved: %d, totSolved: %d, totFailed: %d\r\n", arpStat.txSolved, arpStat.fwdSolved, arpStat.totSolved, arpStat.totFailed);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "slots: %d, targets: %d, poolFail: %d\r\n", arpStat.nSlots, arpStat.nTargets, arpStat.poolFail);
+        (*pCmdIO->pCmdApi->print)(cmdIoParam, "wait - pkts: %d, avg: %d ms, max: %d ms\r\n", arpStat.waitCount, arpStat.waitCount ? arpStat.waitTotMs / arpStat.waitCount : 0, arpStat.waitMaxMs);
     }
 }
 
@@ -6400,5 +7343,3 @@ static void _CommandBridge(SYS_CMD_DEVICE_NODE* pCmdIO, int argc, char** argv)
 
 
 #endif // defined(TCPIP_STACK_COMMAND_ENABLE)
-
-
@@ -917,58 +917,76 @@ uint16_t TCPIP_Helper_Base64Encode(const uint8_t* cSourceData, uint16_t wSourceL
 	
   Note:
 	The checksum is implemented as a fast assembly function on PIC32M platforms.
+	The C version follows the same scheme: 32 bit words are summed
+	into a 64 bit accumulator, 4 words per iteration,
+	and the carries are folded only once, at the end.
   ***************************************************************************/
 #if !defined(__mips__)
 uint16_t TCPIP_Helper_CalcIPChecksum(const uint8_t* buffer, uint16_t count, uint16_t seed)
 {
-	uint16_t i;
-	uint16_t *val;
-	union
-	{
-		uint8_t  b[4];
-		uint16_t w[2];
-		uint32_t dw;
-	} sum;
+    uint64_t sum;
+    uint32_t sum32;
+    const uint32_t* pW;
+    int nChunks;
+    bool swap;
 
     if(buffer == 0)
     {
         return 0;
     }
 
-	val = (uint16_t*)buffer;
-
-	// Calculate the sum of all words
-	sum.dw = (uint32_t)seed;
-    if ((unsigned int)buffer % 2)
-    {
-        sum.w[0] += (*(uint8_t *)buffer) << 8;
-        val = (uint16_t *)(buffer + 1);
+    sum = seed;
+    swap = ((uintptr_t)buffer & 0x1) != 0;
+    if(swap && count != 0)
+    {   // odd address: sum in the swapped byte order from here on
+        sum += (uint32_t)*buffer++ << 8;
         count--;
     }
 
-	i = count >> 1;
+    if(((uintptr_t)buffer & 0x2) != 0 && count >= 2)
+    {   // get to a word boundary
+        sum += *(const uint16_t*)buffer;
+        buffer += 2;
+        count -= 2;
+    }
 
-	while(i--)
-		sum.dw += (uint32_t)*val++;
+    pW = (const uint32_t*)buffer;
+    // 16 bytes chunks
+    for(nChunks = count >> 4; nChunks != 0; nChunks--, pW += 4)
+    {
+        sum += (uint64_t)pW[0] + pW[1] + pW[2] + pW[3];
+    }
 
-	// Add in the sum of the remaining byte, if present
-	if(count & 0x1)
-		sum.dw += (uint32_t)*(uint8_t*)val;
+    // remaining words
+    for(nChunks = (count & 0xf) >> 2; nChunks != 0; nChunks--)
+    {
+        sum += *pW++;
+    }
 
-	// Do an end-around carry (one's complement arrithmatic)
-	sum.dw = (uint32_t)sum.w[0] + (uint32_t)sum.w[1];
+    // remaining bytes
+    buffer = (const uint8_t*)pW;
+    if((count & 0x2) != 0)
+    {
+        sum += *(const uint16_t*)buffer;
+        buffer += 2;
+    }
+    if((count & 0x1) != 0)
+    {
+        sum += *buffer;
+    }
 
-	// Do another end-around carry in case if the prior add 
-	// caused a carry out
-	sum.w[0] += sum.w[1];
+    // end-around carries: 64 -> 32 -> 16 bits
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum32 = (uint32_t)sum + (uint32_t)(sum >> 32);
+    sum32 = (sum32 & 0xffff) + (sum32 >> 16);
+    sum32 = (sum32 & 0xffff) + (sum32 >> 16);
 
-    if ((unsigned int)buffer % 2)
+    if(swap)
     {
-        sum.w[0] = ((uint16_t)sum.b[0] << 8 ) | (uint16_t)sum.b[1];
+        sum32 = ((sum32 & 0xff) << 8) | (sum32 >> 8);
     }
 
-	// Return the resulting checksum
-	return ~sum.w[0];
+    return ~sum32;
 }
 #endif  // !defined(__mips__)
 
@@ -1045,6 +1063,52 @@ uint16_t TCPIP_Helper_ChecksumFold(uint32_t rawChksum)
     
 }
 
+// incremental checksum update, RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m')
+// chksum is the checksum as stored in the header
+// oldVal, newVal: the 16 bit header field before and after the change,
+// read from the header the same way as the checksum
+uint16_t TCPIP_Helper_ChecksumAdjust(uint16_t chksum, uint16_t oldVal, uint16_t newVal)
+{
+    uint32_t sum = (uint32_t)(uint16_t)~chksum + (uint16_t)~oldVal + newVal;
+
+    return ~TCPIP_Helper_ChecksumFold(sum);
+}
+
+// same as TCPIP_Helper_ChecksumAdjust for a 32 bit, 16 bit aligned, header field
+uint16_t TCPIP_Helper_ChecksumAdjust32(uint16_t chksum, uint32_t oldVal, uint32_t newVal)
+{
+    uint32_t sum = (uint32_t)(uint16_t)~chksum;
+    
+    sum += (uint16_t)~oldVal + (uint16_t)~(oldVal >> 16);
+    sum += (newVal & 0xffff) + (newVal >> 16);
+
+    return ~TCPIP_Helper_ChecksumFold(sum);
+}
+
+// copies len bytes from pSrc to pDest and calculates the checksum of the copied data
+// the result is the same as TCPIP_Helper_CalcIPChecksum(pDest, len, seed)
+// for an even aligned pDest
+// The copy is done in small blocks that are summed right after being copied,
+// while still in the data cache, so the data is brought in only once.
+#define _TCPIP_HELPER_COPY_CHKSUM_BLOCK     64      // even and cache line multiple
+uint16_t TCPIP_Helper_CalcIPChecksumCopy(uint8_t* pDest, const uint8_t* pSrc, uint16_t len, uint16_t seed)
+{
+    uint16_t blockLen;
+    uint32_t sum = seed;
+
+    while(len != 0)
+    {
+        blockLen = len > _TCPIP_HELPER_COPY_CHKSUM_BLOCK ? _TCPIP_HELPER_COPY_CHKSUM_BLOCK : len;
+        memcpy(pDest, pSrc, blockLen);
+        sum += (uint16_t)~TCPIP_Helper_CalcIPChecksum(pDest, blockLen, 0);
+        pDest += blockLen;
+        pSrc += blockLen;
+        len -= blockLen;
+    }
+
+    return ~TCPIP_Helper_ChecksumFold(sum);
+}
+
 // copies packet segment data to a linear destination buffer
 // updates the pointer to the current location in the packet segment for further copy
 // returns the number of total bytes copied
@@ -1311,11 +1375,24 @@ bool TCPIP_Helper_SingleListFind(SINGLE_LIST* pL, SGL_LIST_NODE* pN)
 
 void  TCPIP_Helper_SingleListAppend(SINGLE_LIST* pDstL, SINGLE_LIST* pAList)
 {
-	SGL_LIST_NODE* pN;
-	while((pN = TCPIP_Helper_SingleListHeadRemove(pAList)))
-	{
-		TCPIP_Helper_SingleListTailAdd(pDstL, pN);
-	}
+    // splice the whole pAList at the pDstL tail
+    if(pAList->head == 0)
+    {
+        return;
+    }
+
+    if(pDstL->tail == 0)
+    {
+        pDstL->head = pAList->head;
+    }
+    else
+    {
+        pDstL->tail->next = pAList->head;
+    }
+    pDstL->tail = pAList->tail;
+    pDstL->nNodes += pAList->nNodes;
+
+    TCPIP_Helper_SingleListInitialize(pAList);
 }
 
 
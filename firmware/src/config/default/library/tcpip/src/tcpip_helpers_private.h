@@ -63,6 +63,14 @@ uint16_t        TCPIP_Helper_PacketChecksum(TCPIP_MAC_PACKET* pPkt, uint8_t* sta
 
 uint16_t        TCPIP_Helper_ChecksumFold(uint32_t checksum);
 
+// RFC 1624 incremental update of a stored checksum when a 16/32 bit field changes
+uint16_t        TCPIP_Helper_ChecksumAdjust(uint16_t chksum, uint16_t oldVal, uint16_t newVal);
+
+uint16_t        TCPIP_Helper_ChecksumAdjust32(uint16_t chksum, uint32_t oldVal, uint32_t newVal);
+
+// copy and checksum in one pass
+uint16_t        TCPIP_Helper_CalcIPChecksumCopy(uint8_t* pDest, const uint8_t* pSrc, uint16_t len, uint16_t seed);
+
 uint16_t        TCPIP_Helper_PacketCopy(TCPIP_MAC_PACKET* pSrcPkt, uint8_t* pDest, uint8_t** pStartAdd, uint16_t len, bool srchTransport);
 
 
@@ -57,6 +57,11 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 
 #define TCPIP_STACK_HDR_MESSAGE   "TCP/IP Stack: "
 
+// max number of packets extracted from a MAC before being queued to the manager
+#if !defined(TCPIP_STACK_RX_BATCH_SIZE)
+#define TCPIP_STACK_RX_BATCH_SIZE   8
+#endif
+
 // MAC events enabled by the stack manager
 #define TCPIP_STACK_MAC_ALL_EVENTS          (TCPIP_MAC_EV_RX_DONE | TCPIP_MAC_EV_TX_DONE | TCPIP_MAC_EV_RXTX_ERRORS)
 
@@ -135,6 +140,12 @@ static uint32_t             stackTaskRate;   // actual task running rate
 
 static uint32_t             stackAsyncSignalCount;   // global counter of the number of times the modules requested a TCPIP_MODULE_SIGNAL_ASYNC
                                                     // whenever !=0, it means that async signal requests are active!
+
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+// stack statistics counters; see _TCPIPStackStatInc
+uint32_t    _tcpipStackStatTbl[TCPIP_MODULES_NUMBER][TCPIP_STACK_STAT_TYPES];
+uint32_t    _tcpipStackDropTbl[TCPIP_STACK_STAT_DROP_REASONS];
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
 // a quick, constant time dispatch, approach taken here
 // at the expense of some extra RAM used!
 // Note: TCPIP_MODULE_NONE is used as a manager entry for TMO signals!
@@ -1770,6 +1781,11 @@ static void _TCPIPStackExecuteModules(void)
     uint16_t                    signalVal;
     OSAL_CRITSECT_DATA_TYPE     critSect;
 
+#if defined(TCPIP_STACK_USE_IPV4)
+    // the packets transmitted by the module tasks go to the MAC in batches
+    TCPIP_IPV4_TxBatchBegin();
+#endif  // defined(TCPIP_STACK_USE_IPV4)
+
     pSigEntry = TCPIP_STACK_MODULE_SIGNAL_TBL + TCPIP_MODULE_LAYER1;
     for(modIx = TCPIP_MODULE_LAYER1; modIx < sizeof(TCPIP_STACK_MODULE_SIGNAL_TBL)/sizeof(*TCPIP_STACK_MODULE_SIGNAL_TBL); modIx++, pSigEntry++)
     {
@@ -1787,6 +1803,10 @@ static void _TCPIPStackExecuteModules(void)
         // Note: this can set signals for sibling modules!
         (*signalHandler)();
     }
+
+#if defined(TCPIP_STACK_USE_IPV4)
+    TCPIP_IPV4_TxBatchEnd();
+#endif  // defined(TCPIP_STACK_USE_IPV4)
 }
 #endif  // !defined(TCPIP_STACK_APP_EXECUTE_MODULE_TASKS)
 
@@ -1819,15 +1839,27 @@ static void _TCPIP_ProcessTickEvent(void)
 static int _TCPIPExtractMacRxPackets(TCPIP_NET_IF* pNetIf)
 {
     TCPIP_MAC_PACKET*       pRxPkt;
+    SINGLE_LIST             rxBatch;
+    int     nBatch;
     int     nPackets = 0;
 
     // get all the new MAC packets
-    while((pRxPkt = (*pNetIf->pMacObj->TCPIP_MAC_PacketRx)(pNetIf->hIfMac, 0, 0)) != 0)
+    // they are chained locally and each batch is queued to the manager in one go
+    do
     {
-        TCPIP_PKT_FlightLogRx(pRxPkt, pNetIf->macId);
-        _TCPIPInsertMacRxPacket(pNetIf, pRxPkt);
-        nPackets++;
-    }
+        TCPIP_Helper_SingleListInitialize(&rxBatch);
+        while(rxBatch.nNodes < TCPIP_STACK_RX_BATCH_SIZE && (pRxPkt = (*pNetIf->pMacObj->TCPIP_MAC_PacketRx)(pNetIf->hIfMac, 0, 0)) != 0)
+        {
+            TCPIP_PKT_FlightLogRx(pRxPkt, pNetIf->macId);
+            pRxPkt->pktIf = pNetIf;
+            TCPIP_PKT_RingRx(pRxPkt);   // needs pktIf
+            TCPIP_Helper_SingleListTailAdd(&rxBatch, (SGL_LIST_NODE*)pRxPkt);
+        }
+
+        nBatch = rxBatch.nNodes;
+        _TCPIPStackModuleRxAppend(TCPIP_MODULE_MANAGER, &rxBatch, false);
+        nPackets += nBatch;
+    }while(nBatch == TCPIP_STACK_RX_BATCH_SIZE);
 
     return nPackets;
 }
@@ -1844,11 +1876,14 @@ static uint32_t _TCPIPProcessMacPackets(bool signal)
     TCPIP_MAC_ETHERNET_HEADER*  pMacHdr;
     const TCPIP_FRAME_PROCESS_ENTRY*  pFrameEntry;
     uint32_t                    procFrameMask = 0;
+    SINGLE_LIST                 rxQueue;
+    // packets sorted per frame type, delivered to each module as one batch
+    SINGLE_LIST                 frameBatch[sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL)] = { { 0 } };
 
-    SINGLE_LIST*                pPktQueue = (TCPIP_MODULES_QUEUE_TBL + TCPIP_MODULE_MANAGER);
-
+    // take the whole manager queue at once
+    _TCPIPStackModuleRxExtractAll(TCPIP_MODULE_MANAGER, &rxQueue);
 
-    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(pPktQueue)))
+    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxQueue)))
     {
         TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
         pMacHdr = (TCPIP_MAC_ETHERNET_HEADER*)pRxPkt->pMacLayer;
@@ -1889,15 +1924,7 @@ static uint32_t _TCPIPProcessMacPackets(bool signal)
                 pRxPkt->pktFlags &= ~TCPIP_MAC_PKT_FLAG_TYPE_MASK;
                 pRxPkt->pktFlags |= pFrameEntry->pktTypeFlags;
 
-                _TCPIPStackModuleRxInsert(pFrameEntry->moduleId, pRxPkt, 0);
-                if(signal)
-                {   // signal to the module that RX is pending; if not already done so
-                    if((procFrameMask & (1 << frameIx)) == 0)
-                    {   // set the frame mask so we don't signal again
-                        procFrameMask |= 1 << frameIx;
-                        _TCPIPModuleSignalSetNotify(pFrameEntry->moduleId, TCPIP_MODULE_SIGNAL_RX_PENDING);
-                    }
-                }
+                TCPIP_Helper_SingleListTailAdd(frameBatch + frameIx, (SGL_LIST_NODE*)pRxPkt);
                 frameFound = true;
                 break;
             }
@@ -1908,6 +1935,17 @@ static uint32_t _TCPIPProcessMacPackets(bool signal)
         }
     }
 
+    // dispatch the batches: one queue operation and one signal per module
+    pFrameEntry = TCPIP_FRAME_PROCESS_TBL;
+    for(frameIx = 0; frameIx < sizeof(TCPIP_FRAME_PROCESS_TBL) / sizeof(*TCPIP_FRAME_PROCESS_TBL); frameIx++, pFrameEntry++)
+    {
+        if(frameBatch[frameIx].nNodes != 0)
+        {
+            _TCPIPStackModuleRxAppend(pFrameEntry->moduleId, frameBatch + frameIx, signal);
+            procFrameMask |= 1 << frameIx;
+        }
+    }
+
     return procFrameMask;
 }
 
@@ -4217,6 +4255,29 @@ void _TCPIPStackModuleRxInsert(TCPIP_STACK_MODULE modId, TCPIP_MAC_PACKET* pRxPk
     OSAL_CRITSECT_DATA_TYPE critSect =  OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
     TCPIP_Helper_SingleListTailAdd(pQueue, (SGL_LIST_NODE*)pRxPkt);
     OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+    _TCPIPStackStatInc(modId, TCPIP_STACK_STAT_RX_PKTS);
+
+    if(signal)
+    {
+        _TCPIPModuleSignalSetNotify(modId, TCPIP_MODULE_SIGNAL_RX_PENDING);
+    }
+}
+
+// appends a batch of packets to a module RX queue
+// the pBatch list is emptied
+void _TCPIPStackModuleRxAppend(TCPIP_STACK_MODULE modId, SINGLE_LIST* pBatch, bool signal)
+{
+    int nPkts = pBatch->nNodes;
+    if(nPkts == 0)
+    {
+        return;
+    }
+
+    SINGLE_LIST* pQueue = TCPIP_MODULES_QUEUE_TBL + modId;
+    OSAL_CRITSECT_DATA_TYPE critSect =  OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    TCPIP_Helper_SingleListAppend(pQueue, pBatch);
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+    _TCPIPStackStatAdd(modId, TCPIP_STACK_STAT_RX_PKTS, nPkts);
 
     if(signal)
     {
@@ -4236,6 +4297,17 @@ TCPIP_MAC_PACKET* _TCPIPStackModuleRxExtract(TCPIP_STACK_MODULE modId)
     return pRxPkt;
 }
 
+// extracts all the packets from a module RX queue into pBatch
+// the module RX queue is left empty
+void _TCPIPStackModuleRxExtractAll(TCPIP_STACK_MODULE modId, SINGLE_LIST* pBatch)
+{
+    SINGLE_LIST* pQueue = TCPIP_MODULES_QUEUE_TBL + modId;
+    OSAL_CRITSECT_DATA_TYPE critSect =  OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    *pBatch = *pQueue;
+    TCPIP_Helper_SingleListInitialize(pQueue);
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+}
+
 // purges the packets from a module RX queue
 // belonging to the pNetIf
 void _TCPIPStackModuleRxPurge(TCPIP_STACK_MODULE modId, TCPIP_NET_IF* pNetIf)
@@ -4299,11 +4371,43 @@ void _TCPIPStackInsertRxPacket(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET* pRxPkt, b
     }
 }
 
+// ptrPacket could be a chain of packets linked through the next member
 TCPIP_MAC_RES _TCPIPStackPacketTx(TCPIP_NET_IF* pNetIf, TCPIP_MAC_PACKET * ptrPacket)
 {
-    TCPIP_PKT_FlightLogTx(ptrPacket, TCPIP_THIS_MODULE_ID);
-    TCPIP_PKT_FlightLogTx(ptrPacket, pNetIf->macId);    // MAC doesn't call the log function
-    return pNetIf->hIfMac != 0 ? (*pNetIf->pMacObj->TCPIP_MAC_PacketTx)(pNetIf->hIfMac, ptrPacket) : TCPIP_MAC_RES_NOT_READY_ERR;
+    TCPIP_MAC_PACKET* pPkt;
+    TCPIP_MAC_RES macRes;
+    uint32_t nPkts = 0;
+
+    for(pPkt = ptrPacket; pPkt != 0; pPkt = pPkt->next)
+    {
+        TCPIP_PKT_FlightLogTx(pPkt, TCPIP_THIS_MODULE_ID);
+        TCPIP_PKT_FlightLogTx(pPkt, pNetIf->macId);    // MAC doesn't call the log function
+        TCPIP_PKT_RingTx(pPkt);
+        nPkts++;
+    }
+
+    if(pNetIf->hIfMac != 0)
+    {
+        macRes = (*pNetIf->pMacObj->TCPIP_MAC_PacketTx)(pNetIf->hIfMac, ptrPacket);
+    }
+    else
+    {   // none of the packets was scheduled
+        for(pPkt = ptrPacket; pPkt != 0; pPkt = pPkt->next)
+        {
+            pPkt->pktFlags &= ~TCPIP_MAC_PKT_FLAG_QUEUED;
+        }
+        macRes = TCPIP_MAC_RES_NOT_READY_ERR;
+    }
+
+    if(macRes >= 0)
+    {
+        _TCPIPStackStatAdd(TCPIP_THIS_MODULE_ID, TCPIP_STACK_STAT_TX_PKTS, nPkts);
+    }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
+    }
+    return macRes;
 }
 
 static bool _TCPIP_StackSyncFunction(void* synchHandle, TCPIP_MAC_SYNCH_REQUEST req)
@@ -4540,6 +4644,75 @@ bool TCPIP_STACK_PacketHandlerDeregister(TCPIP_NET_HANDLE hNet, TCPIP_STACK_PROC
 
 #endif  // (TCPIP_STACK_EXTERN_PACKET_PROCESS != 0)
 
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+bool TCPIP_STACK_StatSnapshot(TCPIP_STACK_STAT_SNAPSHOT* pSnap)
+{
+    int modIx, statIx;
+
+    if(pSnap == 0)
+    {
+        return false;
+    }
+
+    pSnap->tStamp = SYS_TMR_TickCountGet();
+    // counters are word aligned and read one at a time; no lock needed
+    for(modIx = 0; modIx < TCPIP_MODULES_NUMBER; modIx++)
+    {
+        for(statIx = 0; statIx < TCPIP_STACK_STAT_TYPES; statIx++)
+        {
+            pSnap->modStat[modIx][statIx] = __atomic_load_n(&_tcpipStackStatTbl[modIx][statIx], __ATOMIC_RELAXED);
+        }
+    }
+
+    for(statIx = 0; statIx < TCPIP_STACK_STAT_DROP_REASONS; statIx++)
+    {
+        pSnap->dropReason[statIx] = __atomic_load_n(&_tcpipStackDropTbl[statIx], __ATOMIC_RELAXED);
+    }
+
+    return true;
+}
+
+void TCPIP_STACK_StatDiff(const TCPIP_STACK_STAT_SNAPSHOT* pOld, const TCPIP_STACK_STAT_SNAPSHOT* pNew, TCPIP_STACK_STAT_SNAPSHOT* pDiff)
+{
+    int ix;
+    // the snapshot is all uint32_t; unsigned subtraction handles the wrap around
+    const uint32_t* pO = (const uint32_t*)pOld;
+    const uint32_t* pN = (const uint32_t*)pNew;
+    uint32_t* pD = (uint32_t*)pDiff;
+
+    for(ix = 0; ix < sizeof(*pDiff) / sizeof(uint32_t); ix++)
+    {
+        *pD++ = *pN++ - *pO++;
+    }
+}
+
+uint32_t TCPIP_STACK_StatGet(TCPIP_STACK_MODULE modId, TCPIP_STACK_STAT_TYPE statType)
+{
+    if((unsigned int)modId < TCPIP_MODULES_NUMBER && (unsigned int)statType < TCPIP_STACK_STAT_TYPES)
+    {
+        return __atomic_load_n(&_tcpipStackStatTbl[modId][statType], __ATOMIC_RELAXED);
+    }
+
+    return 0;
+}
+
+uint32_t TCPIP_STACK_StatDropGet(TCPIP_MAC_PKT_ACK_RES ackRes)
+{
+    if(ackRes <= 0 && -ackRes < TCPIP_STACK_STAT_DROP_REASONS)
+    {
+        return __atomic_load_n(&_tcpipStackDropTbl[-ackRes], __ATOMIC_RELAXED);
+    }
+
+    return 0;
+}
+
+void TCPIP_STACK_StatClear(void)
+{
+    memset(_tcpipStackStatTbl, 0, sizeof(_tcpipStackStatTbl));
+    memset(_tcpipStackDropTbl, 0, sizeof(_tcpipStackDropTbl));
+}
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
+
 // debugging features
 //
 #if defined(TCPIP_STACK_TIME_MEASUREMENT)
@@ -594,6 +594,14 @@ TCPIP_MAC_PACKET*   _TCPIPStackModuleRxExtract(TCPIP_STACK_MODULE modId);
 // and signals if necessary
 void _TCPIPStackModuleRxInsert(TCPIP_STACK_MODULE modId, TCPIP_MAC_PACKET* pRxPkt, bool signal);
 
+// appends a list of packets to a module queue, with one lock
+// and signals if necessary
+void _TCPIPStackModuleRxAppend(TCPIP_STACK_MODULE modId, SINGLE_LIST* pBatch, bool signal);
+
+// extracts all packets from a module RX queue, with one lock
+// pBatch is overwritten; the module queue is left empty
+void _TCPIPStackModuleRxExtractAll(TCPIP_STACK_MODULE modId, SINGLE_LIST* pBatch);
+
 
 // purges the packets from a module RX queue
 // belonging to the pNetIf
@@ -683,6 +691,53 @@ static __inline__ uint8_t __attribute__((always_inline))  _TCPIPStack_BridgeGetI
 
 // debugging, tracing, etc.
 
+// stack statistics counters
+// updated with atomic increments, no lock:
+// safe to be called from both task and ISR context
+#if (TCPIP_STACK_STATISTICS_ENABLE != 0)
+extern uint32_t     _tcpipStackStatTbl[TCPIP_MODULES_NUMBER][TCPIP_STACK_STAT_TYPES];
+extern uint32_t     _tcpipStackDropTbl[TCPIP_STACK_STAT_DROP_REASONS];
+
+static __inline__ void  __attribute__((always_inline)) _TCPIPStackStatInc(int modId, TCPIP_STACK_STAT_TYPE statType)
+{
+    if((unsigned int)modId < TCPIP_MODULES_NUMBER)
+    {   // MAC modules are not counted
+        __atomic_fetch_add(&_tcpipStackStatTbl[modId][statType], 1, __ATOMIC_RELAXED);
+    }
+}
+
+// counts a packet acknowledged by a module with an error code
+// the external/bridge hand-offs are counted per code but are not module drops
+static __inline__ void  __attribute__((always_inline)) _TCPIPStackStatDrop(int modId, TCPIP_MAC_PKT_ACK_RES ackRes)
+{
+    if(ackRes < 0)
+    {
+        unsigned int reason = (unsigned int)(-ackRes);
+        __atomic_fetch_add(&_tcpipStackDropTbl[reason < TCPIP_STACK_STAT_DROP_REASONS ? reason : 0], 1, __ATOMIC_RELAXED);
+        if(ackRes != TCPIP_MAC_PKT_ACK_EXTERN && ackRes != TCPIP_MAC_PKT_ACK_BRIDGE_DONE)
+        {
+            _TCPIPStackStatInc(modId, TCPIP_STACK_STAT_DROPS);
+        }
+    }
+}
+
+static __inline__ void  __attribute__((always_inline)) _TCPIPStackStatAdd(int modId, TCPIP_STACK_STAT_TYPE statType, uint32_t val)
+{
+    if((unsigned int)modId < TCPIP_MODULES_NUMBER)
+    {
+        __atomic_fetch_add(&_tcpipStackStatTbl[modId][statType], val, __ATOMIC_RELAXED);
+    }
+}
+
+#define TCPIP_STACK_STAT_INC(statType)      _TCPIPStackStatInc(TCPIP_THIS_MODULE_ID, statType)
+#else
+#define _TCPIPStackStatInc(modId, statType)
+#define _TCPIPStackStatAdd(modId, statType, val)
+#define _TCPIPStackStatDrop(modId, ackRes)
+#define TCPIP_STACK_STAT_INC(statType)
+#endif  // (TCPIP_STACK_STATISTICS_ENABLE != 0)
+
+
 // enables the measurement of the CPU time taken by the TCPIP_STACK_Task() processing
 // Uses the CP0 count register, SYS_FREQ/2 resolution
 //#define TCPIP_STACK_TIME_MEASUREMENT
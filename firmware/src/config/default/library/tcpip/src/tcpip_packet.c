@@ -109,6 +109,41 @@ static void                 _TCPIP_PKT_LogInit(bool resetAll);
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+
+// trace ring frozen flags
+#define TCPIP_PKT_RING_FROZEN_USER      0x01    // frozen by TCPIP_PKT_RingFreeze
+#define TCPIP_PKT_RING_FROZEN_EXPORT    0x02    // frozen by an export in progress
+
+// pcapng constants
+#define TCPIP_PKT_PCAPNG_SHB_TYPE       0x0a0d0d0a  // Section Header Block
+#define TCPIP_PKT_PCAPNG_IDB_TYPE       0x00000001  // Interface Description Block
+#define TCPIP_PKT_PCAPNG_EPB_TYPE       0x00000006  // Enhanced Packet Block
+#define TCPIP_PKT_PCAPNG_BOM            0x1a2b3c4d  // byte order magic
+#define TCPIP_PKT_PCAPNG_LINKTYPE_ETH   1           // LINKTYPE_ETHERNET
+#define TCPIP_PKT_PCAPNG_OPT_TSRESOL    9           // if_tsresol option code
+#define TCPIP_PKT_PCAPNG_OPT_EPB_FLAGS  2           // epb_flags option code
+#define TCPIP_PKT_PCAPNG_EPB_INBOUND    1           // epb_flags direction: inbound
+#define TCPIP_PKT_PCAPNG_EPB_OUTBOUND   2           // epb_flags direction: outbound
+
+// size of the EPB, without the packet data: header(28) + epb_flags(8) + opt_endofopt(4) + trailer(4)
+#define TCPIP_PKT_PCAPNG_EPB_OVERHEAD   44
+
+static TCPIP_PKT_RING_RECORD    _pktRingTbl[TCPIP_PACKET_TRACE_RING_ENTRIES];
+
+static TCPIP_PKT_RING_INFO      _pktRingInfo;       // global ring counters
+
+static uint32_t                 _pktRingExportOldest;   // sequence number of the oldest record when the export started
+static uint16_t                 _pktRingExportCount;    // number of records to be exported
+static uint16_t                 _pktRingExportIfs;      // number of interfaces in the export
+
+// one pcapng block is built here before being handed to the write function
+static uint32_t                 _pktRingBlock[(TCPIP_PKT_PCAPNG_EPB_OVERHEAD + TCPIP_PKT_RING_SNAP_LEN) / sizeof(uint32_t)];
+
+static void                 _TCPIP_PKT_RingInit(void);
+
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
+
 
 
 // API
@@ -152,6 +187,10 @@ bool TCPIP_PKT_Initialize(TCPIP_STACK_HEAP_HANDLE heapH, const TCPIP_NETWORK_CON
 
 #endif  // (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+        _TCPIP_PKT_RingInit();
+#endif  // (TCPIP_PACKET_TRACE_RING_ENABLE)
+
         break;
     }
 
@@ -172,6 +211,7 @@ void _TCPIP_PKT_PacketAcknowledge(TCPIP_MAC_PACKET* pPkt, TCPIP_MAC_PKT_ACK_RES
     if(ackRes != TCPIP_MAC_PKT_ACK_NONE)
     {
         pPkt->ackRes = ackRes;
+        _TCPIPStackStatDrop(moduleId, ackRes);
     }
 
     if(pPkt->ackFunc)
@@ -353,6 +393,10 @@ static __inline__ TCPIP_MAC_PACKET* __attribute__((always_inline)) _TCPIP_PKT_Pa
         }
 
     }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
 
     return pPkt;
 }
@@ -707,6 +751,10 @@ TCPIP_MAC_PACKET* _TCPIP_PKT_PacketAlloc(uint16_t pktLen, uint16_t segLoadLen, T
         pPkt->pktPriority = 0; // set the default priority
 
     }
+    else
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
 
     return pPkt;
 }
@@ -1369,5 +1417,266 @@ void TCPIP_PKT_FlightLogReset(bool resetMasks)
 
 #endif  //  (TCPIP_PACKET_LOG_ENABLE)
 
+#if (TCPIP_PACKET_TRACE_RING_ENABLE)
+
+static void _TCPIP_PKT_RingInit(void)
+{
+    memset(_pktRingTbl, 0, sizeof(_pktRingTbl));
+    memset(&_pktRingInfo, 0, sizeof(_pktRingInfo));
+    _pktRingInfo.nRecords = sizeof(_pktRingTbl) / sizeof(*_pktRingTbl);
+    _pktRingInfo.snapLen = TCPIP_PKT_RING_SNAP_LEN;
+    _pktRingInfo.tStampFreq = SYS_TMR_SystemCountFrequencyGet();
+}
+
+// captures a packet into the next ring record
+// isRx: the 1st segment length doesn't include the MAC header
+static void _TCPIP_PKT_RingCapture(TCPIP_MAC_PACKET* pPkt, bool isRx)
+{
+    uint32_t seqNo;
+    uint16_t segLen, cpyLen, capLen, origLen;
+    const uint8_t* pSrc;
+    TCPIP_MAC_DATA_SEGMENT* pSeg;
+    TCPIP_PKT_RING_RECORD* pRec;
+
+    if(_pktRingInfo.frozen != 0)
+    {
+        _pktRingInfo.nSkipped++;
+        return;
+    }
+
+    // only the slot reservation needs protection
+    OSAL_CRITSECT_DATA_TYPE critSect = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    seqNo = _pktRingInfo.nCaptured++;
+    if(seqNo >= sizeof(_pktRingTbl) / sizeof(*_pktRingTbl))
+    {
+        _pktRingInfo.nOverwritten++;
+    }
+    else
+    {
+        _pktRingInfo.nValid++;
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critSect);
+
+    pRec = _pktRingTbl + (seqNo % (sizeof(_pktRingTbl) / sizeof(*_pktRingTbl)));
+    pRec->tStamp = SYS_TMR_SystemCountGet();
+    pRec->netIx = (uint8_t)TCPIP_STACK_NetIxGet((TCPIP_NET_IF*)pPkt->pktIf);
+    pRec->logFlags = isRx ? TCPIP_PKT_LOG_FLAG_RX : TCPIP_PKT_LOG_FLAG_TX;
+    pRec->seqNo = (uint16_t)seqNo;
+
+    capLen = origLen = 0;
+    pSeg = pPkt->pDSeg;
+    pSrc = pPkt->pMacLayer;
+    segLen = isRx ? pSeg->segLen + sizeof(TCPIP_MAC_ETHERNET_HEADER) : pSeg->segLen;
+    while(true)
+    {
+        origLen += segLen;
+        cpyLen = TCPIP_PKT_RING_SNAP_LEN - capLen;
+        if(cpyLen > segLen)
+        {
+            cpyLen = segLen;
+        }
+        if(cpyLen != 0)
+        {
+            memcpy(pRec->frameData + capLen, pSrc, cpyLen);
+            capLen += cpyLen;
+        }
+
+        if((pSeg = pSeg->next) == 0)
+        {
+            break;
+        }
+        pSrc = pSeg->segLoad;
+        segLen = pSeg->segLen;
+    }
+
+    pRec->capLen = capLen;
+    pRec->origLen = origLen;
+}
+
+void TCPIP_PKT_RingTx(TCPIP_MAC_PACKET* pPkt)
+{
+    _TCPIP_PKT_RingCapture(pPkt, false);
+}
+
+void TCPIP_PKT_RingRx(TCPIP_MAC_PACKET* pPkt)
+{
+    _TCPIP_PKT_RingCapture(pPkt, true);
+}
+
+bool TCPIP_PKT_RingGetInfo(TCPIP_PKT_RING_INFO* pRingInfo)
+{
+    if(pRingInfo)
+    {
+        *pRingInfo = _pktRingInfo;
+    }
+
+    return true;
+}
+
+bool TCPIP_PKT_RingGetRecord(int recIx, TCPIP_PKT_RING_RECORD* pRecord)
+{
+    uint32_t oldest;
+
+    if(recIx < 0 || recIx >= _pktRingInfo.nValid)
+    {
+        return false;
+    }
+
+    oldest = _pktRingInfo.nCaptured - _pktRingInfo.nValid;
+    if(pRecord)
+    {
+        *pRecord = _pktRingTbl[(oldest + recIx) % (sizeof(_pktRingTbl) / sizeof(*_pktRingTbl))];
+    }
+
+    return true;
+}
+
+void TCPIP_PKT_RingFreeze(bool freeze)
+{
+    if(freeze)
+    {
+        _pktRingInfo.frozen |= TCPIP_PKT_RING_FROZEN_USER;
+    }
+    else
+    {
+        _pktRingInfo.frozen &= ~TCPIP_PKT_RING_FROZEN_USER;
+    }
+}
+
+void TCPIP_PKT_RingReset(void)
+{
+    uint16_t frozen = _pktRingInfo.frozen;
+    _TCPIP_PKT_RingInit();
+    _pktRingInfo.frozen = frozen;
+}
+
+// builds the Section Header Block
+// returns the block length
+static size_t _TCPIP_PKT_PcapngShb(uint32_t* pBlk)
+{
+    pBlk[0] = TCPIP_PKT_PCAPNG_SHB_TYPE;
+    pBlk[1] = 28;
+    pBlk[2] = TCPIP_PKT_PCAPNG_BOM;
+    pBlk[3] = 0x00000001;   // major 1, minor 0
+    pBlk[4] = 0xffffffff;   // section length: unspecified
+    pBlk[5] = 0xffffffff;
+    pBlk[6] = 28;
+
+    return 28;
+}
+
+// builds an Interface Description Block
+// returns the block length
+static size_t _TCPIP_PKT_PcapngIdb(uint32_t* pBlk)
+{
+    pBlk[0] = TCPIP_PKT_PCAPNG_IDB_TYPE;
+    pBlk[1] = 32;
+    pBlk[2] = TCPIP_PKT_PCAPNG_LINKTYPE_ETH;    // link type + reserved
+    pBlk[3] = TCPIP_PKT_RING_SNAP_LEN;          // snap length
+    pBlk[4] = TCPIP_PKT_PCAPNG_OPT_TSRESOL | (1 << 16);
+    pBlk[5] = 9;                                // 10^-9: nanoseconds + padding
+    pBlk[6] = 0;                                // opt_endofopt
+    pBlk[7] = 32;
+
+    return 32;
+}
+
+// builds an Enhanced Packet Block from a ring record
+// returns the block length
+static size_t _TCPIP_PKT_PcapngEpb(uint32_t* pBlk, const TCPIP_PKT_RING_RECORD* pRec)
+{
+    uint64_t tStampNs;
+    uint32_t tFreq = _pktRingInfo.tStampFreq;
+    size_t padLen = (pRec->capLen + 3) & ~3;
+    size_t blkLen = TCPIP_PKT_PCAPNG_EPB_OVERHEAD + padLen;
+    uint32_t* pOpt = pBlk + 7 + padLen / sizeof(uint32_t);
+
+    // avoid the 64 bit overflow of tStamp * 10^9
+    tStampNs = (pRec->tStamp / tFreq) * 1000000000ull + ((pRec->tStamp % tFreq) * 1000000000ull) / tFreq;
+
+    pBlk[0] = TCPIP_PKT_PCAPNG_EPB_TYPE;
+    pBlk[1] = blkLen;
+    pBlk[2] = pRec->netIx;
+    pBlk[3] = (uint32_t)(tStampNs >> 32);
+    pBlk[4] = (uint32_t)tStampNs;
+    pBlk[5] = pRec->capLen;
+    pBlk[6] = pRec->origLen;
+    if(padLen != 0)
+    {
+        pBlk[7 + padLen / sizeof(uint32_t) - 1] = 0;   // clear the padding
+        memcpy(pBlk + 7, pRec->frameData, pRec->capLen);
+    }
+
+    pOpt[0] = TCPIP_PKT_PCAPNG_OPT_EPB_FLAGS | (4 << 16);
+    pOpt[1] = (pRec->logFlags & TCPIP_PKT_LOG_FLAG_RX) != 0 ? TCPIP_PKT_PCAPNG_EPB_INBOUND : TCPIP_PKT_PCAPNG_EPB_OUTBOUND;
+    pOpt[2] = 0;    // opt_endofopt
+    pOpt[3] = blkLen;
+
+    return blkLen;
+}
+
+int TCPIP_PKT_RingExport(int exportIx, TCPIP_PKT_RING_WRITE_FNC writeF, const void* param)
+{
+    int blkIx;
+    size_t blkLen;
+    const TCPIP_PKT_RING_RECORD* pRec;
+
+    if(writeF == 0 || exportIx < 0)
+    {
+        TCPIP_PKT_RingExportAbort();
+        return -1;
+    }
+
+    if(exportIx == 0)
+    {   // new export; take a snapshot of the ring
+        _pktRingInfo.frozen |= TCPIP_PKT_RING_FROZEN_EXPORT;
+        _pktRingExportOldest = _pktRingInfo.nCaptured - _pktRingInfo.nValid;
+        _pktRingExportCount = _pktRingInfo.nValid;
+        _pktRingExportIfs = TCPIP_STACK_NumberOfNetworksGet();
+        blkIx = 0;
+    }
+    else if((_pktRingInfo.frozen & TCPIP_PKT_RING_FROZEN_EXPORT) == 0)
+    {   // aborted meanwhile
+        return -1;
+    }
+    else
+    {
+        blkIx = exportIx - 1;
+    }
+
+    // block 0: SHB; blocks 1 - nIfs: IDB; then EPBs
+    while(blkIx < 1 + _pktRingExportIfs + _pktRingExportCount)
+    {
+        if(blkIx == 0)
+        {
+            blkLen = _TCPIP_PKT_PcapngShb(_pktRingBlock);
+        }
+        else if(blkIx <= _pktRingExportIfs)
+        {
+            blkLen = _TCPIP_PKT_PcapngIdb(_pktRingBlock);
+        }
+        else
+        {
+            pRec = _pktRingTbl + ((_pktRingExportOldest + blkIx - 1 - _pktRingExportIfs) % (sizeof(_pktRingTbl) / sizeof(*_pktRingTbl)));
+            blkLen = _TCPIP_PKT_PcapngEpb(_pktRingBlock, pRec);
+        }
+
+        if(!(*writeF)(_pktRingBlock, blkLen, param))
+        {   // retry later
+            return blkIx + 1;
+        }
+        blkIx++;
+    }
+
+    // done
+    _pktRingInfo.frozen &= ~TCPIP_PKT_RING_FROZEN_EXPORT;
+    return 0;
+}
+
+void TCPIP_PKT_RingExportAbort(void)
+{
+    _pktRingInfo.frozen &= ~TCPIP_PKT_RING_FROZEN_EXPORT;
+}
 
+#endif  //  (TCPIP_PACKET_TRACE_RING_ENABLE)
 
@@ -176,6 +176,61 @@ typedef struct
 
 }TCPIP_PKT_LOG_INFO;
 
+// packet trace ring
+// only if TCPIP_PACKET_TRACE_RING_ENABLE is enabled
+//
+// Binary ring of truncated frames, captured at the MAC boundary.
+// Unlike the flight log, a ring record is a snapshot of the frame data
+// and doesn't reference the packet, so there's no search on the hot path:
+// a capture is just an index increment and a copy.
+// The oldest records are overwritten when the ring wraps.
+
+#if !defined(TCPIP_PACKET_TRACE_RING_ENTRIES)
+#define TCPIP_PACKET_TRACE_RING_ENTRIES     32      // number of records; has to be a power of 2
+#endif
+
+#if (TCPIP_PACKET_TRACE_RING_ENABLE) && ((TCPIP_PACKET_TRACE_RING_ENTRIES) & ((TCPIP_PACKET_TRACE_RING_ENTRIES) - 1)) != 0
+// the record index is the 32 bit sequence number modulo the ring size
+#error "TCPIP_PACKET_TRACE_RING_ENTRIES has to be a power of 2"
+#endif
+
+#if !defined(TCPIP_PACKET_TRACE_RING_SNAP_LEN)
+#define TCPIP_PKT_RING_SNAP_LEN             128     // bytes captured from each frame, starting with the MAC header
+#else
+#define TCPIP_PKT_RING_SNAP_LEN             ((TCPIP_PACKET_TRACE_RING_SNAP_LEN + 3) & ~3)   // keep the records 32 bit aligned
+#endif
+
+// structure describing a trace ring record
+typedef struct
+{
+    uint64_t            tStamp;             // SYS_TMR_SystemCountGet() value when the frame crossed the MAC boundary
+    uint16_t            origLen;            // original frame length, including the MAC header
+    uint16_t            capLen;             // number of bytes captured: <= TCPIP_PKT_RING_SNAP_LEN
+    uint8_t             netIx;              // index of the interface the frame belongs to
+    uint8_t             logFlags;           // TCPIP_PKT_LOG_FLAG_RX or TCPIP_PKT_LOG_FLAG_TX
+    uint16_t            seqNo;              // record sequence number, low 16 bits
+    uint8_t             frameData[TCPIP_PKT_RING_SNAP_LEN]; // captured frame data
+}TCPIP_PKT_RING_RECORD;
+
+// global trace ring info
+typedef struct
+{
+    uint16_t            nRecords;           // ring capacity
+    uint16_t            nValid;             // records currently holding data
+    uint16_t            snapLen;            // max bytes captured per frame
+    uint16_t            frozen;             // capture is suspended: freeze or export in progress
+    uint32_t            nCaptured;          // total frames captured since the last reset
+    uint32_t            nOverwritten;       // records lost because the ring wrapped
+    uint32_t            nSkipped;           // frames not captured while the ring was frozen
+    uint32_t            tStampFreq;         // frequency of the record time stamps, Hz
+}TCPIP_PKT_RING_INFO;
+
+// function called by the pcapng export to output data
+// buff and len describe one complete pcapng block
+// the function should either take the whole block and return true
+// or take nothing and return false; the export will be retried with the same block
+typedef bool    (*TCPIP_PKT_RING_WRITE_FNC)(const void* buff, size_t len, const void* param);
+
 // Extra TX/RX packet flags
 // NOTE: // 16 bits only packet flags!
 
@@ -457,6 +512,48 @@ void    TCPIP_PKT_FlightLogClear(bool clrPersist);
 // at the time the reset is called
 void    TCPIP_PKT_FlightLogReset(bool resetMasks);
 
+// captures a frame transmitted to the MAC into the trace ring
+// the packet needs to be fully formatted, MAC header included
+void    TCPIP_PKT_RingTx(TCPIP_MAC_PACKET* pPkt);
+
+// captures a frame received from the MAC into the trace ring
+// the packet is in the state the MAC delivers it: the 1st segment length excludes the MAC header
+void    TCPIP_PKT_RingRx(TCPIP_MAC_PACKET* pPkt);
+
+// gets the trace ring info
+// returns true if the ring is available, false otherwise
+bool    TCPIP_PKT_RingGetInfo(TCPIP_PKT_RING_INFO* pRingInfo);
+
+// copies a ring record
+// recIx == 0 is the oldest record stored in the ring
+// returns true if the record is valid, false otherwise
+bool    TCPIP_PKT_RingGetRecord(int recIx, TCPIP_PKT_RING_RECORD* pRecord);
+
+// suspends/resumes the capture
+// frames crossing the MAC while frozen are only counted
+void    TCPIP_PKT_RingFreeze(bool freeze);
+
+// discards all the records and clears the counters
+void    TCPIP_PKT_RingReset(void);
+
+// exports the ring contents in the pcapng format
+// The export is resumable: call first with exportIx == 0,
+// then call again with the returned value until it returns 0.
+// Each call outputs as many blocks as writeF accepts;
+// a block refused by writeF will be output again on the next call.
+// 1st call outputs the Section Header and an Interface Description Block per interface
+// then an Enhanced Packet Block per record, oldest first
+// The capture is frozen from the 1st call until the export is done or aborted.
+// Returns:
+//      > 0 - the export is not done, call again with this value
+//        0 - export completed
+//      < 0 - error; the export was aborted
+// Note: time stamps are exported with nanosecond resolution (if_tsresol == 9)
+int     TCPIP_PKT_RingExport(int exportIx, TCPIP_PKT_RING_WRITE_FNC writeF, const void* param);
+
+// aborts an export that is in progress and resumes the capture
+void    TCPIP_PKT_RingExportAbort(void);
+
 #if defined(TCPIP_PACKET_ALLOCATION_TRACE_ENABLE)
 
 // proto
@@ -543,6 +640,14 @@ static __inline__ bool __attribute__((always_inline)) TCPIP_PKT_TraceGetEntrySta
 
 #endif
 
+#if !(TCPIP_PACKET_TRACE_RING_ENABLE)
+
+#define TCPIP_PKT_RingTx(pPkt)
+
+#define TCPIP_PKT_RingRx(pPkt)
+
+#endif
+
 
 #endif // __TCPIP_PACKET_H_
 
@@ -1064,7 +1064,12 @@ static void* _UDPAllocateTxPacket(uint16_t pktSize, uint16_t txBuffSize, TCPIP_M
 {
     allocFlags |= TCPIP_MAC_PKT_FLAG_TX | TCPIP_MAC_PKT_FLAG_UDP;
     
-    return TCPIP_PKT_SocketAlloc(pktSize, sizeof(UDP_HEADER), txBuffSize, allocFlags);
+    void* pPkt = TCPIP_PKT_SocketAlloc(pktSize, sizeof(UDP_HEADER), txBuffSize, allocFlags);
+    if(pPkt == 0)
+    {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_ALLOC_FAIL);
+    }
+    return pPkt;
 }
 #endif // defined (TCPIP_STACK_USE_IPV4) || (TCPIP_UDP_USE_POOL_BUFFERS != 0)
 
@@ -1097,8 +1102,10 @@ static void TCPIP_UDP_Process(void)
     TCPIP_MAC_PACKET*   pRxPkt;
     TCPIP_MAC_PKT_ACK_RES ackRes;
 
-    // extract queued UDP packets
-    while((pRxPkt = _TCPIPStackModuleRxExtract(TCPIP_THIS_MODULE_ID)) != 0)
+    // extract all queued UDP packets at once
+    SINGLE_LIST rxBatch;
+    _TCPIPStackModuleRxExtractAll(TCPIP_THIS_MODULE_ID, &rxBatch);
+    while((pRxPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&rxBatch)) != 0)
     {
         TCPIP_PKT_FlightLogRx(pRxPkt, TCPIP_THIS_MODULE_ID);
 #if (TCPIP_UDP_EXTERN_PACKET_PROCESS != 0)
@@ -1644,6 +1651,11 @@ static uint16_t _UDPv4Flush(UDP_SOCKET_DCPT* pSkt)
         checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, sizeof(UDP_HEADER), checksum);
         checksum = ~TCPIP_Helper_CalcIPChecksum(pZSeg->segLoad, udpLoadLen, checksum);
     }
+    else if(pSkt->txChkEnd == pSkt->txWrite)
+    {   // payload already summed by TCPIP_UDP_ArrayPut
+        checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, sizeof(UDP_HEADER), checksum);
+        checksum = TCPIP_Helper_ChecksumFold((uint32_t)checksum + pSkt->txChkSum);
+    }
     else
     {   // one contiguous buffer
         checksum = ~TCPIP_Helper_CalcIPChecksum((uint8_t*)pUDPHdr, udpTotLen, checksum);
@@ -1680,11 +1692,13 @@ static uint16_t _UDPv4Flush(UDP_SOCKET_DCPT* pSkt)
     TCPIP_PKT_FlightLogTxSkt(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID,  ((uint32_t)pSkt->localPort << 16) | pSkt->remotePort, pSkt->sktIx);
     if(TCPIP_IPV4_PacketTransmit(pv4Pkt))
     {
+        TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_PKTS);
         return udpLoadLen; 
     }
 
     // packet reuse
     TCPIP_PKT_FlightLogAcknowledge(&pv4Pkt->macPkt, TCPIP_THIS_MODULE_ID, TCPIP_MAC_PKT_ACK_IP_REJECT_ERR);
+    TCPIP_STACK_STAT_INC(TCPIP_STACK_STAT_TX_FAIL);
     _UDPv4TxPktReset(pSkt, pv4Pkt);
     
     return 0;
@@ -2362,6 +2376,8 @@ bool TCPIP_UDP_SocketInfoGet(UDP_SOCKET s, UDP_SOCKET_INFO* pInfo)
     pInfo->hNet = pSkt->pSktNet;
     pInfo->rxQueueSize = TCPIP_Helper_SingleListCount(&pSkt->rxQueue);
     pInfo->txSize = pSkt->txEnd - pSkt->txStart;
+    pInfo->rxDrops = pSkt->rxDrops;
+    pInfo->txBatchFails = pSkt->txBatchFails;
 
 	return true;
 
@@ -2379,6 +2395,7 @@ bool TCPIP_UDP_TxOffsetSet(UDP_SOCKET s, uint16_t wOffset, bool relative)
         if(pSkt->txStart <= pNewWrite && pNewWrite <= pSkt->txEnd)
         {
             pSkt->txWrite = pNewWrite;
+            pSkt->txChkEnd = 0;     // data could be changed outside TCPIP_UDP_ArrayPut
             return true;
         }        
     }
@@ -2392,6 +2409,7 @@ uint8_t* TCPIP_UDP_TxPointerGet(UDP_SOCKET s)
 
     if(pSkt && _UDPTxPktValid(pSkt))
     {
+        pSkt->txChkEnd = 0;     // the payload will be written directly
         return pSkt->txWrite;
     }
 
@@ -2468,7 +2486,26 @@ uint16_t TCPIP_UDP_ArrayPut(UDP_SOCKET s, const uint8_t *cData, uint16_t wDataLe
 
             if(wDataLen)
             {
-                memcpy(pSkt->txWrite, cData, wDataLen);
+                if(pSkt->txWrite == pSkt->txStart)
+                {   // new payload; restart the running checksum
+                    pSkt->txChkEnd = pSkt->txStart;
+                    pSkt->txChkSum = 0;
+                }
+
+                if(pSkt->txChkEnd == pSkt->txWrite)
+                {   // appending; copy and update the payload checksum in one pass
+                    uint16_t chkSum = ~TCPIP_Helper_CalcIPChecksumCopy(pSkt->txWrite, cData, wDataLen, 0);
+                    if(((pSkt->txWrite - pSkt->txStart) & 0x1) != 0)
+                    {
+                        chkSum = TCPIP_Helper_htons(chkSum);
+                    }
+                    pSkt->txChkSum = TCPIP_Helper_ChecksumFold((uint32_t)pSkt->txChkSum + chkSum);
+                    pSkt->txChkEnd += wDataLen;
+                }
+                else
+                {
+                    memcpy(pSkt->txWrite, cData, wDataLen);
+                }
                 pSkt->txWrite += wDataLen;
             }
 
@@ -2535,6 +2572,66 @@ uint16_t TCPIP_UDP_Flush(UDP_SOCKET s)
 }
 
 
+int TCPIP_UDP_TxBatchPut(UDP_SOCKET s, const UDP_TX_DGRAM* pDgram, int nDgrams)
+{
+    int nSent;
+    UDP_SOCKET_DCPT* pSkt = _UDPSocketDcpt(s);
+
+    if(pSkt == 0 || pDgram == 0 || pSkt->flags.txSplitAlloc != 0)
+    {
+        return 0;
+    }
+
+#if defined (TCPIP_STACK_USE_IPV4)
+    // the IPv4 datagrams go to the MAC as one chain when the loop is done
+    TCPIP_IPV4_TxBatchBegin();
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+    for(nSent = 0; nSent < nDgrams; nSent++, pDgram++)
+    {
+        if(pDgram->pData == 0 || pDgram->dataLen == 0)
+        {   // nothing to send
+            break;
+        }
+
+        if(pDgram->remoteAddress != 0 && !TCPIP_UDP_DestinationIPAddressSet(s, (IP_ADDRESS_TYPE)pSkt->addType, pDgram->remoteAddress))
+        {
+            break;
+        }
+        if(pDgram->remotePort != 0)
+        {
+            TCPIP_UDP_DestinationPortSet(s, pDgram->remotePort);
+        }
+
+        // grabs a new TX buffer, from the pool if enabled, when the previous one is in flight
+        if(TCPIP_UDP_PutIsReady(s) < pDgram->dataLen)
+        {   // no buffer available or datagram too large
+            break;
+        }
+
+        TCPIP_UDP_ArrayPut(s, pDgram->pData, pDgram->dataLen);
+        if(TCPIP_UDP_Flush(s) == 0)
+        {   // failed; don't leave this payload in the socket buffer
+            if(_UDPTxPktValid(pSkt))
+            {
+                pSkt->txWrite = pSkt->txStart;
+            }
+            break;
+        }
+    }
+
+#if defined (TCPIP_STACK_USE_IPV4)
+    TCPIP_IPV4_TxBatchEnd();
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+    if(nSent != nDgrams)
+    {
+        pSkt->txBatchFails++;
+    }
+
+    return nSent;
+}
+
 uint16_t TCPIP_UDP_TxCountGet(UDP_SOCKET s)
 {
     UDP_SOCKET_DCPT* pSkt = _UDPSocketDcpt(s);
@@ -2655,6 +2752,104 @@ uint16_t TCPIP_UDP_ArrayGet(UDP_SOCKET s, uint8_t *cData, uint16_t reqBytes)
     return avlblBytes;
 }
 
+// fills a batch descriptor for a RX packet
+static void _UDPRxDgramSet(UDP_RX_DGRAM* pDgram, TCPIP_MAC_PACKET* pRxPkt, const uint8_t* pData, uint16_t segLen, uint16_t totLen)
+{
+    pDgram->pPkt = pRxPkt;
+    pDgram->pData = pData;
+    pDgram->dataLen = segLen < totLen ? segLen : totLen;
+    pDgram->totLen = totLen;
+    pDgram->remotePort = _UDPRxPktSourcePort(pRxPkt);
+    pDgram->hNet = pRxPkt->pktIf;
+    memset(&pDgram->remoteAddress, 0, sizeof(pDgram->remoteAddress));
+    pDgram->addressType = IP_ADDRESS_TYPE_ANY;
+
+#if defined (TCPIP_STACK_USE_IPV4)
+    if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV4)
+    {
+        pDgram->remoteAddress.v4Add.Val = TCPIP_IPV4_PacketGetSourceAddress(pRxPkt)->Val;
+        pDgram->addressType = IP_ADDRESS_TYPE_IPV4;
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV4)
+
+#if defined (TCPIP_STACK_USE_IPV6)
+    if((pRxPkt->pktFlags & TCPIP_MAC_PKT_FLAG_NET_TYPE) == TCPIP_MAC_PKT_FLAG_IPV6)
+    {
+        memcpy(pDgram->remoteAddress.v6Add.v, TCPIP_IPV6_PacketGetSourceAddress(pRxPkt), sizeof(IPV6_ADDR));
+        pDgram->addressType = IP_ADDRESS_TYPE_IPV6;
+    }
+#endif  // defined (TCPIP_STACK_USE_IPV6)
+}
+
+int TCPIP_UDP_RxBatchGet(UDP_SOCKET s, UDP_RX_DGRAM* pDgram, int nDgrams)
+{
+    int ix, nGot;
+    TCPIP_MAC_PACKET* pRxPkt;
+    UDP_HEADER* pUDPHdr;
+    OSAL_CRITSECT_DATA_TYPE critStatus;
+    UDP_SOCKET_DCPT* pSkt = _UDPSocketDcpt(s);
+
+    if(pSkt == 0 || pDgram == 0 || nDgrams <= 0)
+    {
+        return 0;
+    }
+
+    nGot = 0;
+    if((pRxPkt = pSkt->pCurrRxPkt) != 0)
+    {   // the current packet goes first
+        if(pSkt->pCurrRxSeg != 0 && pSkt->rxTotLen != 0)
+        {
+            _UDPRxDgramSet(pDgram, pRxPkt, pSkt->rxCurr, pSkt->rxSegLen, pSkt->rxTotLen);
+            nGot++;
+        }
+        else
+        {   // already consumed
+            _UDP_RxPktAcknowledge(pRxPkt, TCPIP_MAC_PKT_ACK_RX_OK);
+        }
+        _UDPResetRxPacket(pSkt, 0);
+    }
+
+    // detach the queued packets in one go
+    critStatus = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+    for(ix = nGot; ix < nDgrams; ix++)
+    {
+        if((pDgram[ix].pPkt = (TCPIP_MAC_PACKET*)TCPIP_Helper_SingleListHeadRemove(&pSkt->rxQueue)) == 0)
+        {
+            break;
+        }
+    }
+    OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critStatus);
+
+    for(; nGot < ix; nGot++)
+    {
+        pRxPkt = pDgram[nGot].pPkt;
+        pUDPHdr = (UDP_HEADER*)pRxPkt->pTransportLayer;
+        _UDPRxDgramSet(pDgram + nGot, pRxPkt, pRxPkt->pTransportLayer + sizeof(UDP_HEADER), pRxPkt->pDSeg->segLen - sizeof(UDP_HEADER), pUDPHdr->Length);
+    }
+
+    if(nGot != 0)
+    {   // replies go to the last sender
+        _UDPsetPacketInfo(pSkt, pDgram[nGot - 1].pPkt);
+    }
+
+    return nGot;
+}
+
+void TCPIP_UDP_RxBatchRelease(UDP_RX_DGRAM* pDgram, int nDgrams)
+{
+    if(pDgram != 0)
+    {
+        for(; nDgrams > 0; nDgrams--, pDgram++)
+        {
+            if(pDgram->pPkt != 0)
+            {
+                _UDP_RxPktAcknowledge(pDgram->pPkt, TCPIP_MAC_PKT_ACK_RX_OK);
+            }
+            memset(pDgram, 0, sizeof(*pDgram));
+        }
+    }
+}
+
 uint16_t TCPIP_UDP_Discard(UDP_SOCKET s)
 {
     uint16_t nBytes = 0;
@@ -2712,6 +2907,7 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
 #endif // defined (TCPIP_STACK_USE_IPV4)
     TCPIP_UDP_SKT_FLAGS _flags; 
     _flags.Val = 0;
+    int dropIx = -1;    // matching socket that had no RX room
 
 
     // This packet is said to be matching with current socket:
@@ -2730,6 +2926,7 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
     for(sktIx = 0; sktIx < nUdpSockets; sktIx++)
     {
         bool processSkt = false;
+        bool sktFull = false;
         critStatus = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
         while(true)
         {
@@ -2743,10 +2940,8 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
                 break;
             }
 
-            if(TCPIP_Helper_SingleListCount(&pSkt->rxQueue) >= pSkt->rxQueueLimit)
-            {   // RX limit exceeded
-                break;
-            }
+            // RX limit exceeded; still matched so the drop can be accounted for
+            sktFull = TCPIP_Helper_SingleListCount(&pSkt->rxQueue) >= pSkt->rxQueueLimit;
 
             // take a snapshot of socket settings
             _localPort = pSkt->localPort;
@@ -2855,6 +3050,15 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
         }
 #endif // defined(TCPIP_STACK_USE_IPV6)
 
+        if(sktFull)
+        {   // cannot take it; another socket may
+            if(dropIx < 0 && (looseMatch | exactMatch) == TCPIP_UDP_PKT_MACTH_MASK)
+            {
+                dropIx = sktIx;
+            }
+            continue;
+        }
+
         // finally check the match we got
         if(exactMatch == TCPIP_UDP_PKT_MACTH_MASK)
         {   // perfect match
@@ -2903,6 +3107,16 @@ static UDP_SOCKET_DCPT* _UDPFindMatchingSocket(TCPIP_MAC_PACKET* pRxPkt, UDP_HEA
         // no match, continue
     }
 
+    if(dropIx >= 0)
+    {   // not found because of a full RX queue
+        critStatus = OSAL_CRIT_Enter(OSAL_CRIT_TYPE_LOW);
+        if((pSkt = UDPSocketDcpt[dropIx]) != 0)
+        {
+            pSkt->rxDrops++;
+        }
+        OSAL_CRIT_Leave(OSAL_CRIT_TYPE_LOW, critStatus);
+    }
+
     // not found
     return 0;
 }
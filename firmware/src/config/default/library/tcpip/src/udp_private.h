@@ -121,6 +121,7 @@ typedef struct
     uint8_t*        txStart;        // internal TX Buffer; both IPv4 and IPv6
     uint8_t*        txEnd;          // end of TX Buffer
     uint8_t*        txWrite;        // current write pointer into the TX Buffer
+    uint8_t*        txChkEnd;       // end of the payload covered by txChkSum; not valid if != txWrite
     union
     {
         IPV4_PACKET*  pV4Pkt;        // IPv4 use; UDP_V4_PACKET type
@@ -131,6 +132,7 @@ typedef struct
             // or neither (ADDR_ANY, IPv4/IPv6 not decided yet!)
     };
     uint16_t        txSize;         // size of the txBuffer
+    uint16_t        txChkSum;       // running payload checksum, updated by TCPIP_UDP_ArrayPut
     // socket info
     UDP_SOCKET      sktIx;
     IPV4_ADDR       destAddress;    // requested destination address
@@ -224,6 +226,8 @@ typedef struct
     uint16_t        sigMask;        // TCPIP_UDP_SIGNAL_TYPE: active events
     uint8_t         rxQueueLimit;   // max number of RX packets that can be queued at a certain time
     uint8_t         ttl;            // socket TTL value 
+    uint32_t        rxDrops;        // packets dropped because the RX queue was full
+    uint32_t        txBatchFails;   // datagrams rejected by TCPIP_UDP_TxBatchPut
     uint8_t         padding[];      // padding; not used
 
 } UDP_SOCKET_DCPT;
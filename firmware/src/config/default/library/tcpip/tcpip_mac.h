@@ -2191,6 +2191,8 @@ void       TCPIP_MAC_Close(DRV_HANDLE hMac);
 	  
      The MAC driver is required to support the transmission of multiple
       chained packets.                                                       
+      If only part of a chain can be scheduled, the packets that were not
+      taken must have the TCPIP_MAC_PKT_FLAG_QUEUED flag cleared.
 
 */
 TCPIP_MAC_RES       TCPIP_MAC_PacketTx(DRV_HANDLE hMac, TCPIP_MAC_PACKET * ptrPacket);
@@ -2445,6 +2445,211 @@ TCPIP_STACK_PROCESS_HANDLE     TCPIP_STACK_PacketHandlerRegister(TCPIP_NET_HANDL
 bool    TCPIP_STACK_PacketHandlerDeregister(TCPIP_NET_HANDLE hNet, TCPIP_STACK_PROCESS_HANDLE pktHandle);
 
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Stack Statistics
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* TCP/IP stack statistics counter type
+
+  Summary:
+    Types of the per module statistics counters.
+
+  Description:
+    The stack maintains one counter of each type for every module
+    in the TCPIP_STACK_MODULE enumeration.
+
+  Remarks:
+    The counters are 32 bit wide and wrap around.
+    TCPIP_STACK_StatDiff takes care of the wrap around.
+*/
+typedef enum
+{
+    TCPIP_STACK_STAT_RX_PKTS,       // packets delivered to the module RX queue
+    TCPIP_STACK_STAT_TX_PKTS,       // packets handed by the module to the layer below
+    TCPIP_STACK_STAT_TX_FAIL,       // packets the layer below refused to transmit
+    TCPIP_STACK_STAT_DROPS,         // packets discarded by the module: acknowledged with an error code
+    TCPIP_STACK_STAT_RETRANSMITS,   // retransmitted segments
+    TCPIP_STACK_STAT_ALLOC_FAIL,    // failed packet allocations
+
+    TCPIP_STACK_STAT_TYPES          // number of counters per module
+}TCPIP_STACK_STAT_TYPE;
+
+// number of drop reasons that are counted
+// a drop reason is the negated TCPIP_MAC_PKT_ACK_RES error code
+#define TCPIP_STACK_STAT_DROP_REASONS   (1 - TCPIP_MAC_PKT_ACK_BRIDGE_DISCARD)
+
+// *****************************************************************************
+/* TCP/IP stack statistics snapshot
+
+  Summary:
+    Copy of all the stack statistics counters.
+
+  Description:
+    Filled in by TCPIP_STACK_StatSnapshot.
+
+  Remarks:
+    The snapshot is not atomic as a whole:
+    the counters can still be updated while the snapshot is taken.
+*/
+typedef struct
+{
+    uint32_t    tStamp;                                                 // SYS_TMR tick count when the snapshot was taken
+    uint32_t    modStat[TCPIP_MODULES_NUMBER][TCPIP_STACK_STAT_TYPES];  // per module counters
+    uint32_t    dropReason[TCPIP_STACK_STAT_DROP_REASONS];              // drops per reason: dropReason[-ackRes]
+}TCPIP_STACK_STAT_SNAPSHOT;
+
+//*******************************************************************************
+/*
+  Function:
+    bool    TCPIP_STACK_StatSnapshot(TCPIP_STACK_STAT_SNAPSHOT* pSnap);
+
+  Summary:
+    Takes a snapshot of the stack statistics counters.
+
+  Description:
+    This function copies all the stack statistics counters into
+    the user supplied buffer.
+
+  Precondition:
+    None
+
+  Parameters:
+    pSnap   - address to store the snapshot
+
+  Returns:
+    - true  - if the operation succeeded
+    - false - if the statistics are not enabled or bad parameter
+
+  Remarks:
+    Exists only if TCPIP_STACK_STATISTICS_ENABLE is true
+
+  */
+bool    TCPIP_STACK_StatSnapshot(TCPIP_STACK_STAT_SNAPSHOT* pSnap);
+
+//*******************************************************************************
+/*
+  Function:
+    void    TCPIP_STACK_StatDiff(const TCPIP_STACK_STAT_SNAPSHOT* pOld, const TCPIP_STACK_STAT_SNAPSHOT* pNew, TCPIP_STACK_STAT_SNAPSHOT* pDiff);
+
+  Summary:
+    Calculates the difference between 2 statistics snapshots.
+
+  Description:
+    This function sets pDiff = pNew - pOld, counter by counter.
+
+  Precondition:
+    pOld, pNew obtained with TCPIP_STACK_StatSnapshot
+
+  Parameters:
+    pOld    - the older snapshot
+    pNew    - the newer snapshot
+    pDiff   - address to store the result; could be the same as pOld or pNew
+
+  Returns:
+    None
+
+  Remarks:
+    The counters wrap around, the difference is calculated modulo 2^32.
+
+    Exists only if TCPIP_STACK_STATISTICS_ENABLE is true
+
+  */
+void    TCPIP_STACK_StatDiff(const TCPIP_STACK_STAT_SNAPSHOT* pOld, const TCPIP_STACK_STAT_SNAPSHOT* pNew, TCPIP_STACK_STAT_SNAPSHOT* pDiff);
+
+//*******************************************************************************
+/*
+  Function:
+    uint32_t    TCPIP_STACK_StatGet(TCPIP_STACK_MODULE modId, TCPIP_STACK_STAT_TYPE statType);
+
+  Summary:
+    Returns the current value of a module statistics counter.
+
+  Description:
+    This function returns the value of a single counter
+    without the need of a full snapshot.
+
+  Precondition:
+    None
+
+  Parameters:
+    modId       - the module ID
+    statType    - the counter type
+
+  Returns:
+    the counter value
+    0 if bad parameter
+
+  Remarks:
+    Exists only if TCPIP_STACK_STATISTICS_ENABLE is true
+
+  */
+uint32_t    TCPIP_STACK_StatGet(TCPIP_STACK_MODULE modId, TCPIP_STACK_STAT_TYPE statType);
+
+//*******************************************************************************
+/*
+  Function:
+    uint32_t    TCPIP_STACK_StatDropGet(TCPIP_MAC_PKT_ACK_RES ackRes);
+
+  Summary:
+    Returns the number of packets dropped with a specific reason.
+
+  Description:
+    This function returns the number of packets that were acknowledged
+    with the ackRes error code, by all the stack modules.
+
+  Precondition:
+    None
+
+  Parameters:
+    ackRes      - a TCPIP_MAC_PKT_ACK_RES error code (< 0)
+                  TCPIP_MAC_PKT_ACK_NONE returns the drops with an unknown error code
+
+  Returns:
+    the drop counter value
+    0 if bad parameter
+
+  Remarks:
+    Exists only if TCPIP_STACK_STATISTICS_ENABLE is true
+    TCPIP_MAC_PKT_ACK_EXTERN and TCPIP_MAC_PKT_ACK_BRIDGE_DONE are hand-offs,
+    not drops: they are counted here but not in the module
+    TCPIP_STACK_STAT_DROPS counters.
+
+  */
+uint32_t    TCPIP_STACK_StatDropGet(TCPIP_MAC_PKT_ACK_RES ackRes);
+
+//*******************************************************************************
+/*
+  Function:
+    void    TCPIP_STACK_StatClear(void);
+
+  Summary:
+    Clears all the stack statistics counters.
+
+  Description:
+    This function sets all the statistics counters to 0.
+
+  Precondition:
+    None
+
+  Parameters:
+    None
+
+  Returns:
+    None
+
+  Remarks:
+    Increments that occur while the counters are cleared may be lost.
+    Prefer TCPIP_STACK_StatDiff for periodic monitoring.
+
+    Exists only if TCPIP_STACK_STATISTICS_ENABLE is true
+
+  */
+void    TCPIP_STACK_StatClear(void);
+
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Version Information
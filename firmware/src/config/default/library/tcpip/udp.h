@@ -134,6 +134,8 @@ typedef struct
     TCPIP_NET_HANDLE    hNet;               // associated interface
     uint16_t            rxQueueSize;        // packets waiting in the rx queue
     uint16_t            txSize;             // tx buffer size
+    uint32_t            rxDrops;            // packets dropped because the rx queue was full
+    uint32_t            txBatchFails;       // datagrams that TCPIP_UDP_TxBatchPut could not send
 } UDP_SOCKET_INFO;
 
 
@@ -496,6 +498,62 @@ typedef const void* TCPIP_UDP_PROCESS_HANDLE;
 typedef bool(*TCPIP_UDP_PACKET_HANDLER)(TCPIP_NET_HANDLE hNet, struct _tag_TCPIP_MAC_PACKET* rxPkt, const void* hParam);
 
 
+// *****************************************************************************
+/*
+  Structure:
+    UDP_RX_DGRAM
+
+  Summary:
+    Descriptor of a received datagram returned by reference.
+
+  Description:
+    This structure is filled by TCPIP_UDP_RxBatchGet for every
+    datagram that is handed over to the socket user.
+    The payload is not copied; pData points inside the received packet.
+
+  Remarks:
+    The packet stays owned by the socket user until
+    TCPIP_UDP_RxBatchRelease is called.
+
+    dataLen is the number of bytes available at pData.
+    When the datagram spans multiple segments (totLen > dataLen)
+    the rest of the payload can be reached through pPkt.
+*/
+typedef struct
+{
+    struct _tag_TCPIP_MAC_PACKET* pPkt;     // packet carrying the datagram
+    const uint8_t*      pData;              // pointer to the datagram payload
+    uint16_t            dataLen;            // payload bytes available at pData
+    uint16_t            totLen;             // total datagram payload length
+    UDP_PORT            remotePort;         // source port of the datagram
+    IP_ADDRESS_TYPE     addressType;        // address type of the datagram
+    IP_MULTI_ADDRESS    remoteAddress;      // source address of the datagram
+    TCPIP_NET_HANDLE    hNet;               // interface the datagram arrived on
+}UDP_RX_DGRAM;
+
+// *****************************************************************************
+/*
+  Structure:
+    UDP_TX_DGRAM
+
+  Summary:
+    Descriptor of a datagram to be sent with TCPIP_UDP_TxBatchPut.
+
+  Description:
+    Describes the payload and, optionally, the destination of
+    a datagram that is part of a batch transmission.
+
+  Remarks:
+    A 0 remoteAddress/remotePort keeps the current socket destination.
+*/
+typedef struct
+{
+    const uint8_t*      pData;              // datagram payload
+    uint16_t            dataLen;            // payload length; > 0
+    UDP_PORT            remotePort;         // destination port; 0 to use the socket one
+    IP_MULTI_ADDRESS*   remoteAddress;      // destination address; 0 to use the socket one
+}UDP_TX_DGRAM;
+
 // *****************************************************************************
 /*
   Structure:
@@ -1493,6 +1551,131 @@ uint16_t                TCPIP_UDP_Get(UDP_SOCKET hUDP, uint8_t *v);
   */
 uint16_t               TCPIP_UDP_Discard(UDP_SOCKET hUDP);
 
+// *****************************************************************************
+
+/*
+  Function:
+	int TCPIP_UDP_RxBatchGet(UDP_SOCKET hUDP, UDP_RX_DGRAM* pDgram, int nDgrams)
+
+  Summary:
+	Retrieves a batch of received datagrams by reference.
+	
+  Description:
+	This function removes up to nDgrams packets from the socket RX queue
+    and hands them over to the caller without copying the payload.
+
+  Precondition:
+	UDP socket should have been opened with TCPIP_UDP_ServerOpen/TCPIP_UDP_ClientOpen.
+    hUDP - valid socket
+
+  Parameters:
+    hUDP    - socket handle
+    pDgram  - array of descriptors to be filled
+    nDgrams - number of descriptors in the pDgram array
+	
+  Returns:
+  	Number of datagrams returned, 0 if none available.
+
+  Example:
+    <code>
+    UDP_RX_DGRAM dgrams[4];
+    int ix, nDgrams = TCPIP_UDP_RxBatchGet(mySkt, dgrams, sizeof(dgrams) / sizeof(*dgrams));
+    for(ix = 0; ix < nDgrams; ix++)
+    {
+        myProcess(dgrams[ix].pData, dgrams[ix].dataLen);
+    }
+    TCPIP_UDP_RxBatchRelease(dgrams, nDgrams);
+    </code>
+
+  Remarks:
+    If the socket has a current RX packet (TCPIP_UDP_GetIsReady was called)
+    with unread data, that packet is returned first, starting at the current read position.
+
+    The socket destination is updated with the source of the last returned datagram,
+    as if the datagrams were read with TCPIP_UDP_ArrayGet.
+
+    The returned packets are removed from the socket and the socket
+    can queue new packets. They have to be returned to the stack
+    with TCPIP_UDP_RxBatchRelease as soon as possible.
+
+  */
+int                 TCPIP_UDP_RxBatchGet(UDP_SOCKET hUDP, UDP_RX_DGRAM* pDgram, int nDgrams);
+
+// *****************************************************************************
+
+/*
+  Function:
+	void TCPIP_UDP_RxBatchRelease(UDP_RX_DGRAM* pDgram, int nDgrams)
+
+  Summary:
+	Releases datagrams obtained with TCPIP_UDP_RxBatchGet.
+	
+  Description:
+	This function returns the packets referenced by the pDgram descriptors
+    to the stack.
+
+  Precondition:
+    pDgram filled by a previous call to TCPIP_UDP_RxBatchGet.
+
+  Parameters:
+    pDgram  - array of descriptors
+    nDgrams - number of descriptors to release
+	
+  Returns:
+  	None.
+
+  Remarks:
+    The released descriptors are cleared and their pData
+    pointers are no longer valid.
+
+  */
+void                TCPIP_UDP_RxBatchRelease(UDP_RX_DGRAM* pDgram, int nDgrams);
+
+// *****************************************************************************
+
+/*
+  Function:
+	int TCPIP_UDP_TxBatchPut(UDP_SOCKET hUDP, const UDP_TX_DGRAM* pDgram, int nDgrams)
+
+  Summary:
+	Sends a batch of datagrams.
+	
+  Description:
+	This function writes and transmits every datagram in the pDgram array,
+    each one in its own packet, in a single call.
+
+  Precondition:
+	UDP socket should have been opened with TCPIP_UDP_ServerOpen/TCPIP_UDP_ClientOpen.
+    hUDP - valid socket
+
+  Parameters:
+    hUDP    - socket handle
+    pDgram  - array of datagrams to be sent
+    nDgrams - number of datagrams in the pDgram array
+	
+  Returns:
+  	Number of datagrams transmitted.
+    The transmission stops at the first datagram that could not be sent.
+
+  Remarks:
+    Any data already written to the socket TX buffer with TCPIP_UDP_ArrayPut
+    has to be flushed before calling this function.
+
+    Over IPv4 the packets are collected with TCPIP_IPV4_TxBatchBegin/End
+    and handed to the MAC as one chain when the call returns.
+
+    Each datagram needs a TX buffer. The number of packets in flight,
+    including the ones waiting in the batch, is limited by UDP_OPTION_TX_QUEUE_LIMIT.
+    For best results the socket should have UDP_OPTION_BUFFER_POOL enabled
+    so that the buffers are recycled from the UDP pool instead of the heap.
+
+    A datagram larger than the socket TX buffer is not sent.
+
+    Sockets using TCPIP_UDP_SetSplitPayload are not supported.
+
+  */
+int                 TCPIP_UDP_TxBatchPut(UDP_SOCKET hUDP, const UDP_TX_DGRAM* pDgram, int nDgrams);
+
 
 // *****************************************************************************
 
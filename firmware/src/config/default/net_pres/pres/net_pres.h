@@ -121,6 +121,57 @@ typedef struct {
 	                                       // presentation layer instance data.
 }NET_PRES_INIT_DATA;
 
+// *****************************************************************************
+/* Net Presentation Handshake Statistics
+
+  Summary:
+    Timing of the encrypted connection negotiations.
+
+  Description:
+    This data type reports how long NET_PRES_Tasks was kept busy
+    by the encryption provider while the sockets were negotiating.
+
+  Remarks:
+    All times are in microseconds.
+    Every NET_PRES_Tasks pass over a negotiating socket counts as one call.
+*/
+
+typedef struct {
+    uint32_t nHandshakes;       // negotiations completed successfully
+    uint32_t nFailed;           // negotiations that failed
+    uint32_t nCalls;            // provider connect calls, all sockets
+    uint32_t maxCallUs;         // worst case duration of a single connect call
+    uint32_t lastCalls;         // connect calls needed by the last completed negotiation
+    uint32_t lastMaxCallUs;     // worst case connect call of the last completed negotiation
+    uint32_t lastBusyUs;        // total time spent in connect calls by the last completed negotiation
+}NET_PRES_HANDSHAKE_STATS;
+
+// *****************************************************************************
+/* Net Presentation Early Data Statistics
+
+  Summary:
+    Outcome of the data queued with NET_PRES_SocketEarlyWrite.
+
+  Description:
+    This data type reports how many of the encrypted sends went out
+    with the first flight of the negotiation (TLS 1.3 0-RTT early data)
+    instead of waiting for the negotiation to complete.
+
+  Remarks:
+    nQueued + nWrites is the number of sends; nAccepted of them were
+    delivered as early data.
+    nQueued - nAccepted - nRejected negotiations had no session to resume
+    and wrote the queued data once the negotiation completed.
+*/
+
+typedef struct {
+    uint32_t nQueued;           // negotiations started with queued early data
+    uint32_t nAccepted;         // negotiations where the peer accepted the early data
+    uint32_t nRejected;         // negotiations where the peer rejected it; the data was written again
+    uint32_t acceptedBytes;     // bytes delivered as early data
+    uint32_t nWrites;           // NET_PRES_SocketWrite calls that wrote data on encrypted sockets
+}NET_PRES_EARLY_DATA_STATS;
+
 // *****************************************************************************
 /* Net Presentation Index Type
 
@@ -363,6 +414,65 @@ void NET_PRES_Tasks(SYS_MODULE_OBJ obj);
 
 SYS_STATUS NET_PRES_Status ( SYS_MODULE_OBJ object );
 
+//**************************************************************************
+/*
+
+  Summary:
+    Returns the handshake timing statistics.
+	<p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This function copies the negotiation timing collected by NET_PRES_Tasks
+    and optionally clears it.
+
+  Precondition:
+    The NET_PRES_Initialize function must have been called before calling
+    this function.
+
+  Parameters:
+    pStats - address to store the statistics; could be NULL
+    clear  - if true, the statistics are cleared after the copy
+
+  Returns:
+    - true  - Indicates success
+    - false - Indicates that the layer is not initialized
+
+  Remarks:
+    Useful to check the worst case latency that the negotiation adds
+    to the main loop.
+*/
+
+bool NET_PRES_HandshakeStatsGet(NET_PRES_HANDSHAKE_STATS* pStats, bool clear);
+
+//**************************************************************************
+/*
+
+  Summary:
+    Returns the early data statistics.
+	<p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This function copies the counters of the data queued with
+    NET_PRES_SocketEarlyWrite and optionally clears them.
+
+  Precondition:
+    The NET_PRES_Initialize function must have been called before calling
+    this function.
+
+  Parameters:
+    pStats - address to store the statistics; could be NULL
+    clear  - if true, the statistics are cleared after the copy
+
+  Returns:
+    - true  - Indicates success
+    - false - Indicates that the layer is not initialized
+
+  Remarks:
+    None.
+*/
+
+bool NET_PRES_EarlyDataStatsGet(NET_PRES_EARLY_DATA_STATS* pStats, bool clear);
+
 
 #ifdef __cplusplus
 }
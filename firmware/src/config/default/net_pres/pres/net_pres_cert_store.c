@@ -35,12 +35,171 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 *****************************************************************************/
 
 #include "net_pres/pres/net_pres_certstore.h"
+#include "config.h"
+#include "wolfssl/wolfcrypt/asn.h"
 #define USE_CERT_BUFFERS_2048
 #include "wolfssl/my-test-server-certificate.h"
 
+#if !defined(NET_PRES_CA_STORE_MAX_ROOTS)
+#define NET_PRES_CA_STORE_MAX_ROOTS         64
+#endif
+
+#if !defined(NET_PRES_CA_STORE_INDEX_BUCKETS)
+#define NET_PRES_CA_STORE_INDEX_BUCKETS     32  // power of 2
+#endif
+
+// built-in CA roots; add the DER buffers of the trusted roots here
+static const NET_PRES_CA_ROOT _net_pres_caRootsDefault[] =
+{
+    {testserver_cert_der_1024, sizeof_testserver_cert_der_1024},
+};
+
+static const NET_PRES_CA_ROOT* _net_pres_caRoots = _net_pres_caRootsDefault;
+static size_t _net_pres_caRootsCount = sizeof(_net_pres_caRootsDefault) / sizeof(*_net_pres_caRootsDefault);
+static uint32_t _net_pres_caGeneration = 0;
+static uint32_t _net_pres_caGenerationLast = 0;    // never reused, even after a restore
+
+// Hash index of the roots.
+// Each root is hashed into a name bucket and a key id bucket;
+// the entries of a bucket are chained through nextName/nextKeyId.
+#define _NET_PRES_CA_INDEX_NONE     0xffff
+
+typedef struct
+{
+    uint8_t     nameHash[KEYID_SIZE];
+    uint8_t     keyIdHash[KEYID_SIZE];
+    uint16_t    nextName;
+    uint16_t    nextKeyId;
+}_NET_PRES_CA_INDEX_ENTRY;
+
+static _NET_PRES_CA_INDEX_ENTRY _net_pres_caIndex[NET_PRES_CA_STORE_MAX_ROOTS];
+static uint16_t _net_pres_caNameBuckets[NET_PRES_CA_STORE_INDEX_BUCKETS];
+static uint16_t _net_pres_caKeyIdBuckets[NET_PRES_CA_STORE_INDEX_BUCKETS];
+static bool     _net_pres_caIndexValid = false;
+
+// the hashes are SHA digests, any bits will do
+static size_t _NET_PRES_CAIndexBucket(const uint8_t* hash)
+{
+    return (hash[0] | (hash[1] << 8)) & (NET_PRES_CA_STORE_INDEX_BUCKETS - 1);
+}
+
+// decodes each root once and records its hashes
+// a root that does not decode is left out of the index
+static bool _NET_PRES_CAIndexBuild(void)
+{
+    size_t ix, bucket;
+    _NET_PRES_CA_INDEX_ENTRY* pEntry;
+    DecodedCert* pCert = (DecodedCert*)XMALLOC(sizeof(DecodedCert), NULL, DYNAMIC_TYPE_DCERT);
+
+    if (pCert == 0)
+    {
+        return false;
+    }
+
+    memset(_net_pres_caNameBuckets, 0xff, sizeof(_net_pres_caNameBuckets));
+    memset(_net_pres_caKeyIdBuckets, 0xff, sizeof(_net_pres_caKeyIdBuckets));
+
+    for (ix = 0; ix < _net_pres_caRootsCount; ix++)
+    {
+        InitDecodedCert(pCert, (byte*)_net_pres_caRoots[ix].certPtr, _net_pres_caRoots[ix].certSize, NULL);
+        if (ParseCert(pCert, CA_TYPE, NO_VERIFY, NULL) == 0)
+        {
+            pEntry = _net_pres_caIndex + ix;
+            memcpy(pEntry->nameHash, pCert->subjectHash, KEYID_SIZE);
+            memcpy(pEntry->keyIdHash, pCert->extSubjKeyId, KEYID_SIZE);
+
+            bucket = _NET_PRES_CAIndexBucket(pEntry->nameHash);
+            pEntry->nextName = _net_pres_caNameBuckets[bucket];
+            _net_pres_caNameBuckets[bucket] = ix;
+
+            bucket = _NET_PRES_CAIndexBucket(pEntry->keyIdHash);
+            pEntry->nextKeyId = _net_pres_caKeyIdBuckets[bucket];
+            _net_pres_caKeyIdBuckets[bucket] = ix;
+        }
+        FreeDecodedCert(pCert);
+    }
+
+    XFREE(pCert, NULL, DYNAMIC_TYPE_DCERT);
+    _net_pres_caIndexValid = true;
+    return true;
+}
+
 bool NET_PRES_CertStoreGetCACerts(const uint8_t ** certPtr, int32_t * certSize, uint8_t certIndex)
 {
-    *certPtr = testserver_cert_der_1024;
-    *certSize = sizeof_testserver_cert_der_1024;
+    if (certIndex >= _net_pres_caRootsCount)
+    {
+        return false;
+    }
+    *certPtr = _net_pres_caRoots[certIndex].certPtr;
+    *certSize = _net_pres_caRoots[certIndex].certSize;
     return true;
 }
+
+size_t NET_PRES_CertStoreGetCACount(void)
+{
+    return _net_pres_caRootsCount;
+}
+
+bool NET_PRES_CertStoreSetCARoots(const NET_PRES_CA_ROOT* pRoots, size_t nRoots)
+{
+    if (pRoots == 0)
+    {
+        pRoots = _net_pres_caRootsDefault;
+        nRoots = sizeof(_net_pres_caRootsDefault) / sizeof(*_net_pres_caRootsDefault);
+    }
+    if (nRoots > NET_PRES_CA_STORE_MAX_ROOTS)
+    {
+        return false;
+    }
+    _net_pres_caRoots = pRoots;
+    _net_pres_caRootsCount = nRoots;
+    _net_pres_caIndexValid = false;
+    _net_pres_caGeneration = ++_net_pres_caGenerationLast;
+    return true;
+}
+
+void NET_PRES_CertStoreSaveCARoots(NET_PRES_CA_STORE_SAVE* pSave)
+{
+    pSave->pRoots = _net_pres_caRoots;
+    pSave->nRoots = _net_pres_caRootsCount;
+    pSave->generation = _net_pres_caGeneration;
+}
+
+void NET_PRES_CertStoreRestoreCARoots(const NET_PRES_CA_STORE_SAVE* pSave)
+{
+    _net_pres_caRoots = pSave->pRoots;
+    _net_pres_caRootsCount = pSave->nRoots;
+    _net_pres_caIndexValid = false;
+    _net_pres_caGeneration = pSave->generation;
+}
+
+uint32_t NET_PRES_CertStoreGetCAGeneration(void)
+{
+    return _net_pres_caGeneration;
+}
+
+bool NET_PRES_CertStoreFindCA(const uint8_t* hash, bool byName, const uint8_t ** certPtr, int32_t * certSize)
+{
+    uint16_t ix;
+    const _NET_PRES_CA_INDEX_ENTRY* pEntry;
+
+    if (!_net_pres_caIndexValid && !_NET_PRES_CAIndexBuild())
+    {
+        return false;
+    }
+
+    ix = byName ? _net_pres_caNameBuckets[_NET_PRES_CAIndexBucket(hash)] : _net_pres_caKeyIdBuckets[_NET_PRES_CAIndexBucket(hash)];
+    while (ix != _NET_PRES_CA_INDEX_NONE)
+    {
+        pEntry = _net_pres_caIndex + ix;
+        if (memcmp(byName ? pEntry->nameHash : pEntry->keyIdHash, hash, KEYID_SIZE) == 0)
+        {
+            *certPtr = _net_pres_caRoots[ix].certPtr;
+            *certSize = _net_pres_caRoots[ix].certSize;
+            return true;
+        }
+        ix = byName ? pEntry->nextName : pEntry->nextKeyId;
+    }
+
+    return false;
+}
@@ -51,6 +51,7 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "configuration.h"
 
 #include "net_pres.h"
@@ -97,6 +98,115 @@ extern "C" {
 bool NET_PRES_CertStoreGetCACerts(const uint8_t ** certPtr, int32_t * certSize, 
                                   uint8_t certIndex);
 
+// *****************************************************************************
+/* CA root certificate
+
+  Summary:
+    A DER encoded CA root certificate of the store.
+
+  Description:
+    The certificates are normally const data in flash.
+*/
+typedef struct
+{
+    const uint8_t*  certPtr;    // DER encoded certificate
+    int32_t         certSize;   // size of the certificate
+}NET_PRES_CA_ROOT;
+
+// *****************************************************************************
+/* Get CA Count function
+
+  Summary:
+    Returns the number of CA root certificates in the store.
+
+  Description:
+    NET_PRES_CertStoreGetCACerts accepts a certIndex from 0 to count - 1.
+*/
+size_t NET_PRES_CertStoreGetCACount(void);
+
+// *****************************************************************************
+/* Set CA Roots function
+
+  Summary:
+    Replaces the CA root certificates of the store.
+
+  Description:
+    The table is not copied and has to stay valid while in use.
+    A 0 table restores the built-in roots.
+    CA certificates already loaded by the encryption provider are not affected.
+
+  Returns:
+    - true  - Indicates success
+    - false - The table has more than NET_PRES_CA_STORE_MAX_ROOTS entries
+*/
+bool NET_PRES_CertStoreSetCARoots(const NET_PRES_CA_ROOT* pRoots, size_t nRoots);
+
+// *****************************************************************************
+/* Get CA Generation function
+
+  Summary:
+    Returns the generation of the CA root certificates.
+
+  Description:
+    The generation changes every time the roots are replaced with
+    NET_PRES_CertStoreSetCARoots.
+    Results derived from the roots, like verified certificate chains,
+    are valid only for the generation they were obtained with.
+*/
+uint32_t NET_PRES_CertStoreGetCAGeneration(void);
+
+// *****************************************************************************
+/* Saved CA roots
+
+  Summary:
+    The CA root table and generation saved by NET_PRES_CertStoreSaveCARoots.
+*/
+typedef struct
+{
+    const NET_PRES_CA_ROOT* pRoots;
+    size_t                  nRoots;
+    uint32_t                generation;
+}NET_PRES_CA_STORE_SAVE;
+
+// *****************************************************************************
+/* Save/Restore CA Roots functions
+
+  Summary:
+    Save the current CA roots and put them back after a temporary replacement.
+
+  Description:
+    The restore puts back both the table and its generation,
+    so the results obtained with the saved roots stay valid.
+    The generations used in between are not used again.
+*/
+void NET_PRES_CertStoreSaveCARoots(NET_PRES_CA_STORE_SAVE* pSave);
+void NET_PRES_CertStoreRestoreCARoots(const NET_PRES_CA_STORE_SAVE* pSave);
+
+// *****************************************************************************
+/* Find CA function
+
+  Summary:
+    Looks up a CA root certificate by its subject key id or subject name hash.
+
+  Description:
+    The hashes are the ones wolfSSL keeps for its signers (KEYID_SIZE bytes):
+    the subject key identifier, or a hash of the public key when the
+    certificate has none, and the hash of the DER encoded subject name.
+    The hash index is built on the first look up after the roots change;
+    the certificates themselves are not decoded again.
+
+  Parameters:
+    hash     - The hash to look for
+    byName   - true for a subject name hash, false for a key id
+    certPtr  - A pointer to the CA certificate
+    certSize - The size of the certificate
+
+  Returns:
+    - true  - The CA was found
+    - false - No CA with this hash in the store
+*/
+bool NET_PRES_CertStoreFindCA(const uint8_t* hash, bool byName, const uint8_t ** certPtr, int32_t * certSize);
+
 // *****************************************************************************
 /* Get Device X509 TLS Parameters function
 
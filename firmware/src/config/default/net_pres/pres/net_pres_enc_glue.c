@@ -43,9 +43,112 @@ THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
 #include "wolfssl/ssl.h"
 #include "wolfssl/wolfcrypt/logging.h"
 #include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/sha256.h"
+#include "system/sys_time_h2_adapter.h"
+#include "tcpip/tcpip.h"
 
 extern  int CheckAvailableSize(WOLFSSL *ssl, int size);
 
+#if !defined(NET_PRES_ENC_HANDSHAKE_SLICE_US)
+#define NET_PRES_ENC_HANDSHAKE_SLICE_US     0
+#endif
+
+#if !defined(NET_PRES_ENC_CIPHER_LIST)
+#define NET_PRES_ENC_CIPHER_LIST            0   // wolfSSL default suites
+#endif
+
+// Handshake time slicing.
+// wolfSSL reads the peer flight one record at a time, and the
+// certificate, key exchange and signature processing of a record
+// runs before the next record is requested.
+// Once a wolfSSL_connect call exceeds the slice the receive callback
+// reports WANT_READ, so the call returns and NET_PRES_Tasks resumes
+// the handshake with the next record on its next pass.
+static uint32_t _net_pres_hsSliceUs = NET_PRES_ENC_HANDSHAKE_SLICE_US;
+static uint64_t _net_pres_hsSliceEnd = 0;   // system count when the current slice ends; 0 if not slicing
+
+void NET_PRES_EncGlue_HandshakeSliceSet(uint32_t sliceUs)
+{
+    _net_pres_hsSliceUs = sliceUs;
+}
+
+uint32_t NET_PRES_EncGlue_HandshakeSliceGet(void)
+{
+    return _net_pres_hsSliceUs;
+}
+
+// Receive callback counters; the calls per KB received show
+// how many transport round trips wolfSSL needs for the input.
+static NET_PRES_RX_STATS _net_pres_rxStats;
+
+void NET_PRES_EncGlue_RxStatsGet(NET_PRES_RX_STATS* pStats, bool clear)
+{
+    if (pStats)
+    {
+        *pStats = _net_pres_rxStats;
+    }
+    if (clear)
+    {
+        memset(&_net_pres_rxStats, 0, sizeof(_net_pres_rxStats));
+    }
+}
+
+#if defined(WOLFSSL_READ_AHEAD)
+// Read-ahead.
+// wolfSSL reads all the data the transport has, up to its input buffer size,
+// instead of the record header and then the record body separately.
+// It is turned on per session once the handshake is done: the records
+// read ahead bypass the receive callback, and with it the handshake slice check.
+static bool _net_pres_readAhead = true;
+#endif  // defined(WOLFSSL_READ_AHEAD)
+
+// Cipher suite policy.
+// The client hello lists the suites in this order; names the build
+// does not support are skipped by wolfSSL.
+static const char* _net_pres_cipherList = NET_PRES_ENC_CIPHER_LIST;
+
+
+#if defined(WOLFSSL_SP) && defined(WOLFSSL_TLS13) && defined(HAVE_SUPPORTED_CURVES)
+// Key exchange groups in preference order.
+// The groups the single precision math covers come first;
+// the others are still offered and run on the generic math.
+static int _net_pres_encGroups[] =
+{
+#if defined(WOLFSSL_HAVE_SP_ECC) && !defined(WOLFSSL_SP_NO_256)
+    WOLFSSL_ECC_SECP256R1,
+#endif
+#if defined(WOLFSSL_HAVE_SP_DH) && defined(HAVE_FFDHE_2048) && !defined(WOLFSSL_SP_NO_2048)
+    WOLFSSL_FFDHE_2048,
+#endif
+#if defined(WOLFSSL_HAVE_SP_DH) && defined(HAVE_FFDHE_3072) && !defined(WOLFSSL_SP_NO_3072)
+    WOLFSSL_FFDHE_3072,
+#endif
+#if !defined(WOLFSSL_HAVE_SP_ECC) || defined(WOLFSSL_SP_NO_256)
+    WOLFSSL_ECC_SECP256R1,
+#endif
+#if !defined(NO_ECC384)
+    WOLFSSL_ECC_SECP384R1,
+#endif
+#if !defined(NO_ECC521)
+    WOLFSSL_ECC_SECP521R1,
+#endif
+#if defined(HAVE_FFDHE_2048) && (!defined(WOLFSSL_HAVE_SP_DH) || defined(WOLFSSL_SP_NO_2048))
+    WOLFSSL_FFDHE_2048,
+#endif
+#if defined(HAVE_FFDHE_3072) && (!defined(WOLFSSL_HAVE_SP_DH) || defined(WOLFSSL_SP_NO_3072))
+    WOLFSSL_FFDHE_3072,
+#endif
+#if defined(HAVE_FFDHE_4096)
+    WOLFSSL_FFDHE_4096,
+#endif
+#if defined(HAVE_FFDHE_6144)
+    WOLFSSL_FFDHE_6144,
+#endif
+#if defined(HAVE_FFDHE_8192)
+    WOLFSSL_FFDHE_8192,
+#endif
+};
+#endif  // defined(WOLFSSL_SP) && defined(WOLFSSL_TLS13) && defined(HAVE_SUPPORTED_CURVES)
 
 typedef struct 
 {
@@ -75,6 +178,10 @@ NET_PRES_EncProviderObject net_pres_EncProviderStreamClient0 =
     .fpIsInited = NET_PRES_EncProviderStreamClientIsInited0,
     .fpOutputSize = NET_PRES_EncProviderOutputSize0,
     .fpMaxOutputSize = NET_PRES_EncProviderMaxOutputSize0,
+#if defined(WOLFSSL_EARLY_DATA)
+    .fpEarlyWrite = NET_PRES_EncProviderEarlyWrite0,
+    .fpEarlyAccepted = NET_PRES_EncProviderEarlyAccepted0,
+#endif
 };
 	
 net_pres_wolfsslInfo net_pres_wolfSSLInfoStreamClient0;
@@ -83,12 +190,19 @@ int NET_PRES_EncGlue_StreamClientReceiveCb0(void *sslin, char *buf, int sz, void
 {
     int fd = *(int *)ctx;
     uint16_t bufferSize;
+    if (_net_pres_hsSliceEnd != 0 && SYS_TMR_SystemCountGet() >= _net_pres_hsSliceEnd)
+    {   // handshake slice used up; continue on the next pass
+        return WOLFSSL_CBIO_ERR_WANT_READ;
+    }
+    _net_pres_rxStats.nCalls++;
     bufferSize = (*net_pres_wolfSSLInfoStreamClient0.transObject->fpReadyToRead)((uintptr_t)fd);
     if (bufferSize == 0)
     {
         return WOLFSSL_CBIO_ERR_WANT_READ;
     }
     bufferSize = (*net_pres_wolfSSLInfoStreamClient0.transObject->fpRead)((uintptr_t)fd, (uint8_t*)buf, sz);
+    _net_pres_rxStats.nReads++;
+    _net_pres_rxStats.bytes += bufferSize;
     return bufferSize;
 }
 int NET_PRES_EncGlue_StreamClientSendCb0(void *sslin, char *buf, int sz, void *ctx)
@@ -108,11 +222,215 @@ int NET_PRES_EncGlue_StreamClientSendCb0(void *sslin, char *buf, int sz, void *c
 static uint8_t _net_pres_wolfsslUsers = 0;
 
 		
-bool NET_PRES_EncProviderStreamClientInit0(NET_PRES_TransportObject * transObject)
+#if defined(WOLFSSL_MISSING_CA_CB)
+// Lazy CA loading.
+// The context starts without CA certificates; when a certificate chain
+// needs a CA the context does not have, wolfSSL asks for it here
+// and the root found in the certificate store index is decoded and added.
+// It then stays in the context for the following connections.
+int NET_PRES_EncGlue_MissingCACb(const unsigned char* hash, int hashType, void* ctx)
+{
+    const uint8_t * caCertPtr;
+    int32_t caCertLen;
+
+    if (!NET_PRES_CertStoreFindCA(hash, hashType == WOLFSSL_CA_HASH_NAME, &caCertPtr, &caCertLen))
+    {
+        return 0;
+    }
+    if (wolfSSL_CTX_load_verify_buffer((WOLFSSL_CTX*)ctx, caCertPtr, caCertLen, SSL_FILETYPE_ASN1) != SSL_SUCCESS)
+    {
+        return 0;
+    }
+    return 1;
+}
+#else
+// loads all the store roots into the context
+static bool _NET_PRES_EncGlue_LoadCACerts(WOLFSSL_CTX* context)
 {
     const uint8_t * caCertsPtr;
     int32_t caCertsLen;
-    if (!NET_PRES_CertStoreGetCACerts(&caCertsPtr, &caCertsLen, 0))
+    uint8_t certIndex;
+
+    for (certIndex = 0; NET_PRES_CertStoreGetCACerts(&caCertsPtr, &caCertsLen, certIndex); certIndex++)
+    {
+        if (wolfSSL_CTX_load_verify_buffer(context, caCertsPtr, caCertsLen, SSL_FILETYPE_ASN1) != SSL_SUCCESS)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+#endif  // defined(WOLFSSL_MISSING_CA_CB)
+
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+#if !defined(NET_PRES_ENC_CHAIN_CACHE_ENTRIES)
+#define NET_PRES_ENC_CHAIN_CACHE_ENTRIES    8
+#endif
+#if !defined(NET_PRES_ENC_CHAIN_CACHE_LIFETIME_S)
+#define NET_PRES_ENC_CHAIN_CACHE_LIFETIME_S 3600
+#endif
+
+// Verified peer chain cache.
+// A chain that passed a full verification is remembered by its SHA-256,
+// with the CA store generation and the time it was verified.
+// On a hit wolfSSL still decodes the chain and checks the signers,
+// validity dates and revocation; only the signatures are not verified again.
+typedef struct
+{
+    uint8_t     hash[WC_SHA256_DIGEST_SIZE];
+    uint32_t    caGeneration;   // CA store generation the chain was verified with
+    uint32_t    verifiedSec;    // time of the full verification
+    uint32_t    lastUse;        // LRU stamp; 0 if the entry is free
+}_NET_PRES_CHAIN_CACHE_ENTRY;
+
+static _NET_PRES_CHAIN_CACHE_ENTRY _net_pres_chainCache[NET_PRES_ENC_CHAIN_CACHE_ENTRIES];
+static uint32_t _net_pres_chainCacheUse = 0;
+static NET_PRES_CHAIN_CACHE_STATS _net_pres_chainCacheStats;
+
+static uint32_t _NET_PRES_EncGlue_Seconds(void)
+{
+    return (uint32_t)(SYS_TMR_SystemCountGet() / SYS_TMR_SystemCountFrequencyGet());
+}
+
+int NET_PRES_EncGlue_VerifiedChainCb(const unsigned char* hash, int op, void* ctx)
+{
+    _NET_PRES_CHAIN_CACHE_ENTRY* pEntry;
+    _NET_PRES_CHAIN_CACHE_ENTRY* pFree = 0;
+    _NET_PRES_CHAIN_CACHE_ENTRY* pOldest = 0;
+    uint32_t caGeneration = NET_PRES_CertStoreGetCAGeneration();
+    uint32_t nowSec = _NET_PRES_EncGlue_Seconds();
+
+    (void)ctx;
+    if (op == WOLFSSL_CHAIN_LOOKUP)
+    {
+        _net_pres_chainCacheStats.lookups++;
+    }
+
+    for (pEntry = _net_pres_chainCache; pEntry != _net_pres_chainCache + NET_PRES_ENC_CHAIN_CACHE_ENTRIES; pEntry++)
+    {
+        if (pEntry->lastUse != 0 && (pEntry->caGeneration != caGeneration || nowSec - pEntry->verifiedSec >= NET_PRES_ENC_CHAIN_CACHE_LIFETIME_S))
+        {
+            pEntry->lastUse = 0;
+            _net_pres_chainCacheStats.stale++;
+        }
+        if (pEntry->lastUse == 0)
+        {
+            if (pFree == 0)
+            {
+                pFree = pEntry;
+            }
+            continue;
+        }
+        if (memcmp(pEntry->hash, hash, WC_SHA256_DIGEST_SIZE) == 0)
+        {
+            pEntry->lastUse = ++_net_pres_chainCacheUse;
+            if (op == WOLFSSL_CHAIN_LOOKUP)
+            {
+                _net_pres_chainCacheStats.hits++;
+                return 1;
+            }
+            return 0;   // already there
+        }
+        if (pOldest == 0 || pEntry->lastUse < pOldest->lastUse)
+        {
+            pOldest = pEntry;
+        }
+    }
+
+    if (op != WOLFSSL_CHAIN_VERIFIED)
+    {
+        return 0;
+    }
+
+    if (pFree == 0)
+    {
+        pFree = pOldest;
+        _net_pres_chainCacheStats.evictions++;
+    }
+    memcpy(pFree->hash, hash, WC_SHA256_DIGEST_SIZE);
+    pFree->caGeneration = caGeneration;
+    pFree->verifiedSec = nowSec;
+    pFree->lastUse = ++_net_pres_chainCacheUse;
+    _net_pres_chainCacheStats.inserts++;
+    return 0;
+}
+
+void NET_PRES_EncGlue_ChainCacheStatsGet(NET_PRES_CHAIN_CACHE_STATS* pStats, bool clear)
+{
+    if (pStats)
+    {
+        *pStats = _net_pres_chainCacheStats;
+    }
+    if (clear)
+    {
+        memset(&_net_pres_chainCacheStats, 0, sizeof(_net_pres_chainCacheStats));
+    }
+}
+
+void NET_PRES_EncGlue_ChainCacheFlush(void)
+{
+    memset(_net_pres_chainCache, 0, sizeof(_net_pres_chainCache));
+}
+#endif  // defined(WOLFSSL_VERIFIED_CHAIN_CB)
+
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+// OCSP stapling.
+// The client hello asks for the certificate status: status_request_v2
+// (TLS 1.2, a response for each certificate of the chain) and
+// status_request (TLS 1.2 and 1.3, the server certificate).
+// A stapled response is verified with the CA roots and a revoked
+// certificate fails the handshake. wolfSSL caches the verified statuses
+// by certificate ID until their nextUpdate, so a staple seen again is
+// not decoded and verified again; OCSP_CACHE_MAX_STATUS bounds the cache.
+// Servers that do not staple are not checked: there are no OCSP look ups.
+static bool _NET_PRES_EncGlue_UseStapling(WOLFSSL_CTX* context)
+{
+    if (wolfSSL_CTX_EnableOCSPStapling(context) != SSL_SUCCESS)
+    {
+        return false;
+    }
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+    if (wolfSSL_CTX_UseOCSPStaplingV2(context, WOLFSSL_CSR2_OCSP_MULTI, 0) != SSL_SUCCESS)
+    {
+        return false;
+    }
+#endif
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST)
+    // no nonce: servers staple the responses they fetched beforehand
+    if (wolfSSL_CTX_UseOCSPStapling(context, WOLFSSL_CSR_OCSP, 0) != SSL_SUCCESS)
+    {
+        return false;
+    }
+#endif
+    return true;
+}
+#endif  // defined(HAVE_CERTIFICATE_STATUS_REQUEST) || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+
+#if defined(HAVE_SESSION_TICKET) && !defined(NO_SESSION_CACHE) && !defined(NO_CLIENT_CACHE)
+// Session resumption.
+// Every connection is tagged with the server address and port.
+// wolfSSL keeps the last session of each server in its client cache,
+// updated with the tickets the server sends, and a new connection
+// to the same server resumes it: no certificate exchange.
+static void _NET_PRES_EncGlue_ServerIdSet(WOLFSSL* ssl, uintptr_t transHandle)
+{
+    NET_PRES_TransSocketInfoGet fpInfoGet = net_pres_wolfSSLInfoStreamClient0.transObject->fpSocketInfoGet;
+    TCP_SOCKET_INFO sktInfo;
+    uint8_t serverId[sizeof(sktInfo.remoteIPaddress) + sizeof(sktInfo.remotePort)];
+
+    if (fpInfoGet == 0 || !(*fpInfoGet)((NET_PRES_SKT_HANDLE_T)transHandle, &sktInfo))
+    {   // full handshake
+        return;
+    }
+    memcpy(serverId, &sktInfo.remoteIPaddress, sizeof(sktInfo.remoteIPaddress));
+    memcpy(serverId + sizeof(sktInfo.remoteIPaddress), &sktInfo.remotePort, sizeof(sktInfo.remotePort));
+    wolfSSL_SetServerID(ssl, serverId, sizeof(serverId), 0);
+}
+#endif  // defined(HAVE_SESSION_TICKET) && !defined(NO_SESSION_CACHE) && !defined(NO_CLIENT_CACHE)
+
+bool NET_PRES_EncProviderStreamClientInit0(NET_PRES_TransportObject * transObject)
+{
+    if (NET_PRES_CertStoreGetCACount() == 0)
     {
         return false;
     }
@@ -129,17 +447,86 @@ bool NET_PRES_EncProviderStreamClientInit0(NET_PRES_TransportObject * transObjec
     }
     wolfSSL_SetIORecv(net_pres_wolfSSLInfoStreamClient0.context, (CallbackIORecv)&NET_PRES_EncGlue_StreamClientReceiveCb0);
     wolfSSL_SetIOSend(net_pres_wolfSSLInfoStreamClient0.context, (CallbackIOSend)&NET_PRES_EncGlue_StreamClientSendCb0);
-    if (wolfSSL_CTX_load_verify_buffer(net_pres_wolfSSLInfoStreamClient0.context, caCertsPtr, caCertsLen, SSL_FILETYPE_ASN1) != SSL_SUCCESS)
+#if defined(WOLFSSL_SP) && defined(WOLFSSL_TLS13) && defined(HAVE_SUPPORTED_CURVES)
+    if (wolfSSL_CTX_set_groups(net_pres_wolfSSLInfoStreamClient0.context, _net_pres_encGroups, sizeof(_net_pres_encGroups) / sizeof(*_net_pres_encGroups)) != SSL_SUCCESS)
+    {
+        wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
+        return false;
+    }
+#endif
+    if (_net_pres_cipherList != 0 && wolfSSL_CTX_set_cipher_list(net_pres_wolfSSLInfoStreamClient0.context, _net_pres_cipherList) != SSL_SUCCESS)
+    {
+        wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
+        return false;
+    }
+#if defined(WOLFSSL_MISSING_CA_CB)
+    if (wolfSSL_CTX_SetMissingCA_Cb(net_pres_wolfSSLInfoStreamClient0.context, NET_PRES_EncGlue_MissingCACb) != SSL_SUCCESS)
+#else
+    if (!_NET_PRES_EncGlue_LoadCACerts(net_pres_wolfSSLInfoStreamClient0.context))
+#endif
     {
         // Couldn't load the CA certificates
         //SYS_CONSOLE_MESSAGE("Something went wrong loading the CA certificates\r\n");
         wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
         return false;
     }
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB)
+    if (wolfSSL_CTX_SetVerifiedChain_Cb(net_pres_wolfSSLInfoStreamClient0.context, NET_PRES_EncGlue_VerifiedChainCb) != SSL_SUCCESS)
+    {
+        wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
+        return false;
+    }
+#endif
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+    if (!_NET_PRES_EncGlue_UseStapling(net_pres_wolfSSLInfoStreamClient0.context))
+    {
+        wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
+        return false;
+    }
+#endif
+#if defined(HAVE_SESSION_TICKET)
+    if (wolfSSL_CTX_UseSessionTicket(net_pres_wolfSSLInfoStreamClient0.context) != SSL_SUCCESS)
+    {
+        wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
+        return false;
+    }
+#endif
 	wolfSSL_CTX_set_verify(net_pres_wolfSSLInfoStreamClient0.context, WOLFSSL_VERIFY_PEER, 0);
     net_pres_wolfSSLInfoStreamClient0.isInited = true;
     return true;
 }
+bool NET_PRES_EncGlue_CipherListSet(const char* cipherList)
+{
+    if (net_pres_wolfSSLInfoStreamClient0.isInited && cipherList != 0)
+    {   // new sessions use the new list
+        if (wolfSSL_CTX_set_cipher_list(net_pres_wolfSSLInfoStreamClient0.context, cipherList) != SSL_SUCCESS)
+        {
+            return false;
+        }
+    }
+    // 0 takes effect when the context is created again
+    _net_pres_cipherList = cipherList;
+    return true;
+}
+
+const char* NET_PRES_EncGlue_CipherListGet(void)
+{
+    return _net_pres_cipherList;
+}
+
+#if defined(WOLFSSL_READ_AHEAD)
+bool NET_PRES_EncGlue_ReadAheadSet(bool enable)
+{   // the sessions that complete the handshake from now on use the new setting
+    _net_pres_readAhead = enable;
+    return true;
+}
+
+bool NET_PRES_EncGlue_ReadAheadGet(void)
+{
+    return _net_pres_readAhead;
+}
+#endif  // defined(WOLFSSL_READ_AHEAD)
+
 bool NET_PRES_EncProviderStreamClientDeinit0(void)
 {
     wolfSSL_CTX_free(net_pres_wolfSSLInfoStreamClient0.context);
@@ -163,6 +550,9 @@ bool NET_PRES_EncProviderStreamClientOpen0(uintptr_t transHandle, void * provide
             wolfSSL_free(ssl);
             return false;
         }
+#if defined(HAVE_SESSION_TICKET) && !defined(NO_SESSION_CACHE) && !defined(NO_CLIENT_CACHE)
+        _NET_PRES_EncGlue_ServerIdSet(ssl, transHandle);
+#endif
         memcpy(providerData, &ssl, sizeof(WOLFSSL*));
         return true;
 }
@@ -174,10 +564,18 @@ NET_PRES_EncSessionStatus NET_PRES_EncProviderClientConnect0(void * providerData
 {
     WOLFSSL* ssl;
     memcpy(&ssl, providerData, sizeof(WOLFSSL*));
+    if (_net_pres_hsSliceUs != 0)
+    {
+        _net_pres_hsSliceEnd = SYS_TMR_SystemCountGet() + ((uint64_t)_net_pres_hsSliceUs * SYS_TMR_SystemCountFrequencyGet()) / 1000000;
+    }
     int result = wolfSSL_connect(ssl);
+    _net_pres_hsSliceEnd = 0;
     switch (result)
     {
         case SSL_SUCCESS:
+#if defined(WOLFSSL_READ_AHEAD)
+            wolfSSL_set_read_ahead(ssl, _net_pres_readAhead);
+#endif
             return NET_PRES_ENC_SS_OPEN;
         default:
         {
@@ -193,6 +591,32 @@ NET_PRES_EncSessionStatus NET_PRES_EncProviderClientConnect0(void * providerData
         }
     }
 }
+#if defined(WOLFSSL_EARLY_DATA)
+// TLS 1.3 early data.
+// When the connection resumes a session whose ticket allows early data,
+// the data goes right after the client hello (0-RTT), up to the size
+// the ticket allows. Otherwise nothing is sent here and net_pres
+// writes the data once the handshake is done.
+int32_t NET_PRES_EncProviderEarlyWrite0(void * providerData, const uint8_t * buffer, uint16_t size)
+{
+    WOLFSSL* ssl;
+    int earlySent = 0;
+    memcpy(&ssl, providerData, sizeof(WOLFSSL*));
+    if (!wolfSSL_session_reused(ssl))
+    {   // no ticket; the connect calls start the handshake
+        return 0;
+    }
+    // errors, WANT_WRITE included, are left to the connect calls
+    wolfSSL_write_early_data(ssl, buffer, size, &earlySent);
+    return earlySent;
+}
+bool NET_PRES_EncProviderEarlyAccepted0(void * providerData)
+{
+    WOLFSSL* ssl;
+    memcpy(&ssl, providerData, sizeof(WOLFSSL*));
+    return wolfSSL_get_early_data_status(ssl) == WOLFSSL_EARLY_DATA_ACCEPTED;
+}
+#endif  // defined(WOLFSSL_EARLY_DATA)
 NET_PRES_EncSessionStatus NET_PRES_EncProviderConnectionClose0(void * providerData)
 {
     WOLFSSL* ssl;
@@ -58,6 +58,56 @@ int32_t NET_PRES_EncProviderReadReady0(void * providerData);
 int32_t NET_PRES_EncProviderPeek0(void * providerData, uint8_t * buffer, uint16_t size);
 int32_t NET_PRES_EncProviderOutputSize0(void * providerData, int32_t inSize);
 int32_t NET_PRES_EncProviderMaxOutputSize0(void * providerData);
+int32_t NET_PRES_EncProviderEarlyWrite0(void * providerData, const uint8_t * buffer, uint16_t size);
+bool NET_PRES_EncProviderEarlyAccepted0(void * providerData);
+
+// handshake time slice, microseconds; 0 disables the slicing
+void NET_PRES_EncGlue_HandshakeSliceSet(uint32_t sliceUs);
+uint32_t NET_PRES_EncGlue_HandshakeSliceGet(void);
+
+// receive callback counters
+typedef struct
+{
+    uint32_t nCalls;        // receive callbacks from wolfSSL
+    uint32_t nReads;        // callbacks that read data from the transport
+    uint32_t bytes;         // bytes read from the transport
+}NET_PRES_RX_STATS;
+
+// gets the receive counters and optionally clears them
+void NET_PRES_EncGlue_RxStatsGet(NET_PRES_RX_STATS* pStats, bool clear);
+
+// TLS input read-ahead; applies to the sessions that complete the handshake afterwards
+bool NET_PRES_EncGlue_ReadAheadSet(bool enable);
+bool NET_PRES_EncGlue_ReadAheadGet(void);
+
+// client cipher suite list, most preferred first, in the wolfSSL
+// "name:name:..." format; 0 leaves the wolfSSL defaults.
+// The string is not copied and has to stay valid.
+// Returns false if the list is not accepted by the running context.
+bool NET_PRES_EncGlue_CipherListSet(const char* cipherList);
+const char* NET_PRES_EncGlue_CipherListGet(void);
+
+// wolfSSL missing CA callback, loads a CA root from the certificate store;
+// ctx is the WOLFSSL_CTX
+int NET_PRES_EncGlue_MissingCACb(const unsigned char* hash, int hashType, void* ctx);
+
+// verified peer chain cache counters
+typedef struct
+{
+    uint32_t lookups;       // chains looked up
+    uint32_t hits;          // chains found, signature checks skipped
+    uint32_t stale;         // entries dropped: too old or the CA roots changed
+    uint32_t inserts;       // newly verified chains added
+    uint32_t evictions;     // entries replaced to make room
+}NET_PRES_CHAIN_CACHE_STATS;
+
+// wolfSSL verified chain callback, keeps the hashes of the verified
+// peer chains; ctx is the WOLFSSL_CTX
+int NET_PRES_EncGlue_VerifiedChainCb(const unsigned char* hash, int op, void* ctx);
+// gets the cache counters and optionally clears them
+void NET_PRES_EncGlue_ChainCacheStatsGet(NET_PRES_CHAIN_CACHE_STATS* pStats, bool clear);
+// drops all the cached chains
+void NET_PRES_EncGlue_ChainCacheFlush(void);
 #ifdef __CPLUSPLUS
 }
 #endif
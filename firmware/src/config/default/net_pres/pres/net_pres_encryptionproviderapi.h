@@ -436,6 +436,62 @@ typedef int32_t (*NET_PRES_EncProviderOutputSize)(void * providerData, int32_t i
  */
 typedef int32_t (*NET_PRES_EncProviderMaxOutputSize)(void * providerData);
 
+// *****************************************************************************
+/* Presentation Encryption Provider Early Write Function Pointer Prototype
+
+  Summary:
+    Defines the early write function to the provider.
+	<p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This function pointer defines the early write function. It is called by 
+	the presentation layer right before the first connect call of a connection
+    with queued data. The provider starts the negotiation and sends
+    as much of the data as it can together with the first flight.
+
+  Preconditions:
+    A connection must have already been created; the negotiation has not
+    started.
+
+  Parameters:
+    providerData - A pointer to the buffer for the provider to keep connection
+                   specific data.
+    buffer	     - A pointer to the queued data.
+    size         - The number of bytes queued.
+
+  Returns:
+    The number of bytes sent with the first flight; 0 if none.
+
+  Remarks:
+    The negotiation then continues with the connect calls.
+ */
+typedef int32_t (*NET_PRES_EncProviderEarlyWrite)(void * providerData, const uint8_t * buffer, uint16_t size);
+
+// *****************************************************************************
+/* Presentation Encryption Provider Early Data Accepted Function Pointer Prototype
+
+  Summary:
+    Defines the early data accepted function to the provider.
+	<p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This function pointer defines the early data accepted function. It is 
+	called by the presentation layer once the negotiation completed to find
+    whether the peer processed the data sent by the early write function.
+
+  Preconditions:
+    A connection must have already been created, and be in the open state.
+
+  Parameters:
+    providerData - A pointer to the buffer for the provider to keep connection
+                   specific data.
+
+  Returns:
+    - true  - The peer accepted the early data
+    - false - The peer discarded it; it has to be written again
+ */
+typedef bool (*NET_PRES_EncProviderEarlyAccepted)(void * providerData);
+
 // *****************************************************************************
 /* Presentation Encryption Provider Information Structure
 
@@ -471,6 +527,10 @@ typedef struct _NET_PRES_EncProviderObject
 	                                               // the provider has been initialized
     NET_PRES_EncProviderOutputSize fpOutputSize;   // Function pointer to get the output size
     NET_PRES_EncProviderMaxOutputSize fpMaxOutputSize; // Function pointer to get the maximum output size
+    NET_PRES_EncProviderEarlyWrite fpEarlyWrite;   // Function pointer to send data with the first flight;
+                                                   // could be NULL
+    NET_PRES_EncProviderEarlyAccepted fpEarlyAccepted; // Function pointer to check if the early data
+                                                   // was accepted; could be NULL
 }NET_PRES_EncProviderObject;
 
 #ifdef __cplusplus
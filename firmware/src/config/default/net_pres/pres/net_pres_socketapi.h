@@ -580,6 +580,45 @@ uint16_t NET_PRES_SocketWriteIsReady(NET_PRES_SKT_HANDLE_T handle, uint16_t reqS
 
 uint16_t NET_PRES_SocketWrite(NET_PRES_SKT_HANDLE_T handle, const void * buffer, uint16_t size);
 
+//*****************************************************************************
+/*
+  Summary:
+    Queues data to be sent with the encryption negotiation.
+    
+  Description:
+    This function copies a buffer for an encrypted socket that has not
+    started its negotiation yet.
+    When the provider can resume a previous session with the server, the data
+    is sent as early data together with the first negotiation flight
+    (TLS 1.3 0-RTT); otherwise, or if the server rejects the early data,
+    it is written as soon as the negotiation completes.
+    Either way the data reaches the server before anything written
+    with NET_PRES_SocketWrite.
+
+  Precondition:
+    A socket needs to have been opened by NET_PRES_SocketOpen.
+    The negotiation has not started: the transport is not connected yet.
+
+  Parameters:
+    handle    - The presentation layer socket handle.
+    buffer    - The pointer to the array to be queued.
+    size      - The number of bytes to be queued.
+
+  Returns:
+    - size - The data was queued.
+    - 0    - The socket does not support early data, the negotiation
+             already started or there is no room for size bytes.
+
+  Remarks:
+    NET_PRES_EARLY_DATA_SIZE bounds the data queued per socket;
+    0 disables the function.
+    Early data can be replayed by an attacker; queue only data that is
+    safe to be processed by the server more than once.
+
+ */
+
+uint16_t NET_PRES_SocketEarlyWrite(NET_PRES_SKT_HANDLE_T handle, const void * buffer, uint16_t size);
+
 //*****************************************************************************
 /*
   Summary:
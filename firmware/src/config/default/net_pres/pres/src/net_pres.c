@@ -26,6 +26,7 @@
 #include "../net_pres_socketapi.h"
 #include "../net_pres_transportapi.h"
 #include "system/debug/sys_debug.h"
+#include "system/sys_time_h2_adapter.h"
 #include "net_pres_local.h"
 
 
@@ -182,6 +183,87 @@ void NET_PRES_Reinitialize(SYS_MODULE_OBJ obj, const SYS_MODULE_INIT * const ini
     NET_PRES_Initialize(0, init);
 }
 
+static NET_PRES_HANDSHAKE_STATS sNetPresHsStats;
+static NET_PRES_EARLY_DATA_STATS sNetPresEarlyStats;
+
+// accounts for a provider connect call that took callCount system ticks
+static void _NET_PRES_HandshakeCallUpdate(NET_PRES_SocketData* pSkt, uint64_t callCount)
+{
+    uint32_t callUs = (uint32_t)((callCount * 1000000ull) / SYS_TMR_SystemCountFrequencyGet());
+
+    sNetPresHsStats.nCalls++;
+    if(callUs > sNetPresHsStats.maxCallUs)
+    {
+        sNetPresHsStats.maxCallUs = callUs;
+    }
+
+    pSkt->hsCalls++;
+    pSkt->hsBusyUs += callUs;
+    if(callUs > pSkt->hsMaxCallUs)
+    {
+        pSkt->hsMaxCallUs = callUs;
+    }
+
+    if(pSkt->status == NET_PRES_ENC_SS_OPEN)
+    {
+        sNetPresHsStats.nHandshakes++;
+        sNetPresHsStats.lastCalls = pSkt->hsCalls;
+        sNetPresHsStats.lastMaxCallUs = pSkt->hsMaxCallUs;
+        sNetPresHsStats.lastBusyUs = pSkt->hsBusyUs;
+    }
+    else if(pSkt->status == NET_PRES_ENC_SS_FAILED)
+    {
+        sNetPresHsStats.nFailed++;
+    }
+}
+
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+// writes the queued early data that was not delivered with the first flight
+// returns true when nothing is left in the queue
+static bool _NET_PRES_EarlyDataFlush(NET_PRES_SocketData* pSkt)
+{
+    uint16_t pending = pSkt->earlyLen - pSkt->earlySent;
+
+    if(pending != 0)
+    {
+        if((*pSkt->provObject->fpWriteReady)(pSkt->providerData, pending, 0) == 0 ||
+           (*pSkt->transObject->fpReadyToWrite)(pSkt->transHandle) < (*pSkt->provObject->fpOutputSize)(pSkt->providerData, pending))
+        {   // no room yet; NET_PRES_Tasks retries
+            return false;
+        }
+        pSkt->earlySent += (*pSkt->provObject->fpWrite)(pSkt->providerData, pSkt->earlyData + pSkt->earlySent, pending);
+        if(pSkt->earlySent != pSkt->earlyLen)
+        {
+            return false;
+        }
+    }
+
+    pSkt->earlyLen = 0;
+    pSkt->earlySent = 0;
+    return true;
+}
+
+// the negotiation of a socket with queued early data completed
+static void _NET_PRES_EarlyDataComplete(NET_PRES_SocketData* pSkt)
+{
+    if(pSkt->earlySent != 0)
+    {
+        if((*pSkt->provObject->fpEarlyAccepted)(pSkt->providerData))
+        {
+            sNetPresEarlyStats.nAccepted++;
+            sNetPresEarlyStats.acceptedBytes += pSkt->earlySent;
+        }
+        else
+        {   // the server discarded all of it
+            sNetPresEarlyStats.nRejected++;
+            pSkt->earlySent = 0;
+        }
+    }
+
+    _NET_PRES_EarlyDataFlush(pSkt);
+}
+#endif  // (NET_PRES_EARLY_DATA_SIZE != 0)
+
 void NET_PRES_Tasks(SYS_MODULE_OBJ obj)
 {
     uint8_t x;
@@ -227,11 +309,42 @@ void NET_PRES_Tasks(SYS_MODULE_OBJ obj)
                     }
                     //Intentional fall through to the next state
                     sNetPresSockets[x].provOpen = true;
+                    sNetPresSockets[x].hsCalls = 0;
+                    sNetPresSockets[x].hsMaxCallUs = 0;
+                    sNetPresSockets[x].hsBusyUs = 0;
                 }
                 case NET_PRES_ENC_SS_CLIENT_NEGOTIATING:
                 case NET_PRES_ENC_SS_SERVER_NEGOTIATING:
+                {
+                    uint64_t callStart = SYS_TMR_SystemCountGet();
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+                    if (sNetPresSockets[x].status == NET_PRES_ENC_SS_WAITING_TO_START_NEGOTIATION && sNetPresSockets[x].earlyLen != 0)
+                    {   // the provider sends what it can with the first flight
+                        int32_t earlySent = (*sNetPresSockets[x].provObject->fpEarlyWrite)(sNetPresSockets[x].providerData, sNetPresSockets[x].earlyData, sNetPresSockets[x].earlyLen);
+                        sNetPresSockets[x].earlySent = earlySent > 0 ? (uint16_t)earlySent : 0;
+                        sNetPresEarlyStats.nQueued++;
+                    }
+#endif
                     sNetPresSockets[x].status = (*sNetPresSockets[x].provObject->fpConnect)(sNetPresSockets[x].providerData);
+                    _NET_PRES_HandshakeCallUpdate(sNetPresSockets + x, SYS_TMR_SystemCountGet() - callStart);
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+                    if (sNetPresSockets[x].status == NET_PRES_ENC_SS_OPEN && sNetPresSockets[x].earlyLen != 0)
+                    {
+                        _NET_PRES_EarlyDataComplete(sNetPresSockets + x);
+                    }
+#endif
+                    break;
+                }
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+                case NET_PRES_ENC_SS_OPEN:
+                {
+                    if (sNetPresSockets[x].earlyLen != 0)
+                    {   // still waiting for room to write the early data
+                        _NET_PRES_EarlyDataFlush(sNetPresSockets + x);
+                    }
                     break;
+                }
+#endif
                 default:
                     break;
             }
@@ -549,6 +662,10 @@ bool NET_PRES_SocketDisconnect(NET_PRES_SKT_HANDLE_T handle)
                 }
             }
             pSkt->status = NET_PRES_ENC_SS_WAITING_TO_START_NEGOTIATION;
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+            pSkt->earlyLen = 0;
+            pSkt->earlySent = 0;
+#endif
         }
     }
 
@@ -656,6 +773,12 @@ uint16_t NET_PRES_SocketWriteIsReady(NET_PRES_SKT_HANDLE_T handle, uint16_t reqS
             pSkt->lastError = NET_PRES_SKT_OP_NOT_SUPPORTED;
             return 0;
         }
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+        if(pSkt->earlyLen != 0 && !_NET_PRES_EarlyDataFlush(pSkt))
+        {   // the queued early data goes first
+            return 0;
+        }
+#endif
 
         transpSpace = (*fpTrans)(pSkt->transHandle);
         encAvlblSize = (*fpWriteReady)(pSkt->providerData, reqSize, 0);
@@ -745,7 +868,18 @@ uint16_t NET_PRES_SocketWrite(NET_PRES_SKT_HANDLE_T handle, const void * buffer,
             pSkt->lastError = NET_PRES_SKT_OP_NOT_SUPPORTED;
             return 0;
         }
-        return (*fp)(pSkt->providerData, buffer, size);    
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+        if (pSkt->earlyLen != 0 && (pSkt->status != NET_PRES_ENC_SS_OPEN || !_NET_PRES_EarlyDataFlush(pSkt)))
+        {   // the queued early data goes first
+            return 0;
+        }
+#endif
+        uint16_t res = (*fp)(pSkt->providerData, buffer, size);
+        if (res != 0)
+        {
+            sNetPresEarlyStats.nWrites++;
+        }
+        return res;
     }
     NET_PRES_TransWrite fpc = pSkt->transObject->fpWrite;
     if (fpc == NULL)
@@ -756,6 +890,36 @@ uint16_t NET_PRES_SocketWrite(NET_PRES_SKT_HANDLE_T handle, const void * buffer,
     return (*fpc)(pSkt->transHandle, buffer, size);  
 }
 
+uint16_t NET_PRES_SocketEarlyWrite(NET_PRES_SKT_HANDLE_T handle, const void * buffer, uint16_t size)
+{
+    NET_PRES_SocketData * pSkt;
+    if ((pSkt = _NET_PRES_SocketValidate(handle)) == NULL)
+    {
+        return 0;
+    }
+
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+    if ((pSkt->socketType & NET_PRES_SKT_ENCRYPTED) == NET_PRES_SKT_ENCRYPTED)
+    {
+        NET_PRES_EncProviderObject * provObject = pSkt->provObject;
+        if (provObject->fpEarlyWrite != NULL && provObject->fpEarlyAccepted != NULL && provObject->fpWrite != NULL &&
+            provObject->fpWriteReady != NULL && provObject->fpOutputSize != NULL)
+        {
+            if (pSkt->status != NET_PRES_ENC_SS_WAITING_TO_START_NEGOTIATION || size > NET_PRES_EARLY_DATA_SIZE - pSkt->earlyLen)
+            {   // too late or too much
+                return 0;
+            }
+            memcpy(pSkt->earlyData + pSkt->earlyLen, buffer, size);
+            pSkt->earlyLen += size;
+            return size;
+        }
+    }
+#endif  // (NET_PRES_EARLY_DATA_SIZE != 0)
+
+    pSkt->lastError = NET_PRES_SKT_OP_NOT_SUPPORTED;
+    return 0;
+}
+
 uint16_t NET_PRES_SocketFlush(NET_PRES_SKT_HANDLE_T handle)
 {
     NET_PRES_SocketData * pSkt;
@@ -1068,6 +1232,44 @@ SYS_STATUS NET_PRES_Status ( SYS_MODULE_OBJ object )
     }
 }
 
+bool NET_PRES_HandshakeStatsGet(NET_PRES_HANDSHAKE_STATS* pStats, bool clear)
+{
+    if(!sNetPresData.initialized)
+    {
+        return false;
+    }
+
+    if(pStats)
+    {
+        *pStats = sNetPresHsStats;
+    }
+    if(clear)
+    {
+        memset(&sNetPresHsStats, 0, sizeof(sNetPresHsStats));
+    }
+
+    return true;
+}
+
+bool NET_PRES_EarlyDataStatsGet(NET_PRES_EARLY_DATA_STATS* pStats, bool clear)
+{
+    if(!sNetPresData.initialized)
+    {
+        return false;
+    }
+
+    if(pStats)
+    {
+        *pStats = sNetPresEarlyStats;
+    }
+    if(clear)
+    {
+        memset(&sNetPresEarlyStats, 0, sizeof(sNetPresEarlyStats));
+    }
+
+    return true;
+}
+
 NET_PRES_SKT_ERROR_T NET_PRES_SocketLastError(NET_PRES_SKT_HANDLE_T handle)
 {
     NET_PRES_SocketData * pSkt;
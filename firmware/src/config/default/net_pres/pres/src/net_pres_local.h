@@ -40,6 +40,11 @@ extern "C" {
 // enableNET_PRES debugging levels
 #define NET_PRES_DEBUG_LEVEL  (0)
 
+// bytes of early data that can be queued per socket; 0 disables the early writes
+#if !defined(NET_PRES_EARLY_DATA_SIZE)
+#define NET_PRES_EARLY_DATA_SIZE    0
+#endif
+
 
     
     
@@ -71,6 +76,14 @@ extern "C" {
         NET_PRES_SIGNAL_HANDLE    sigHandle;    // registered signal handle
         NET_PRES_SIGNAL_FUNCTION  usrSigFnc;    // user signal function
         const void*               usrSigParam;  // user signal parameter
+        uint32_t    hsCalls;        // connect calls of the current negotiation
+        uint32_t    hsMaxCallUs;    // worst case connect call of the current negotiation
+        uint32_t    hsBusyUs;       // time spent in connect calls by the current negotiation
+#if (NET_PRES_EARLY_DATA_SIZE != 0)
+        uint16_t    earlyLen;       // bytes queued by NET_PRES_SocketEarlyWrite
+        uint16_t    earlySent;      // queued bytes already delivered
+        uint8_t     earlyData[NET_PRES_EARLY_DATA_SIZE];
+#endif
         uint8_t providerData[8];
     }NET_PRES_SocketData;
     
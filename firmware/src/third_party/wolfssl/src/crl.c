@@ -57,6 +57,9 @@ int InitCRL(WOLFSSL_CRL* crl, WOLFSSL_CERT_MANAGER* cm)
         crl->heap = NULL;
     crl->cm = cm;
     crl->crlList = NULL;
+#ifdef WOLFSSL_CRL_INDEX
+    XMEMSET(crl->crlTable, 0, sizeof(crl->crlTable));
+#endif
     crl->monitors[0].path = NULL;
     crl->monitors[1].path = NULL;
 #ifdef HAVE_CRL_MONITOR
@@ -77,6 +80,172 @@ int InitCRL(WOLFSSL_CRL* crl, WOLFSSL_CERT_MANAGER* cm)
 }
 
 
+#ifdef WOLFSSL_CRL_INDEX
+/* Issuer hash is a digest, any 4 bytes will do */
+static WC_INLINE word32 HashCRL_Issuer(const byte* issuerHash)
+{
+    return (((word32)issuerHash[0] << 24) | ((word32)issuerHash[1] << 16) |
+            ((word32)issuerHash[2] <<  8) |  (word32)issuerHash[3]) %
+                                                                CRL_TABLE_SIZE;
+}
+
+
+/* Rebuild the issuer table from crlList, buckets keep the list order.
+ * Call with crlLock held or before the CRL is shared. */
+static void BuildCRL_Table(WOLFSSL_CRL* crl)
+{
+    CRL_Entry** tail[CRL_TABLE_SIZE];
+    CRL_Entry*  crle;
+    int         i;
+
+    for (i = 0; i < CRL_TABLE_SIZE; i++) {
+        crl->crlTable[i] = NULL;
+        tail[i] = &crl->crlTable[i];
+    }
+    for (crle = crl->crlList; crle != NULL; crle = crle->next) {
+        word32 row = HashCRL_Issuer(crle->issuerHash);
+
+        crle->tableNext = NULL;
+        *tail[row] = crle;
+        tail[row] = &crle->tableNext;
+    }
+}
+
+
+/* Serial order: shorter first, then by bytes */
+static int CompareCRL_Serial(const byte* serial, int serialSz,
+                             const RevokedCert* rc)
+{
+    if (serialSz != rc->serialSz)
+        return serialSz < rc->serialSz ? -1 : 1;
+    return XMEMCMP(serial, rc->serialNumber, serialSz);
+}
+
+
+static void SiftDownCRL_Index(RevokedCert** index, int root, int end)
+{
+    RevokedCert* tmp;
+    int          child;
+
+    while ((child = 2 * root + 1) < end) {
+        if (child + 1 < end && CompareCRL_Serial(index[child]->serialNumber,
+                      index[child]->serialSz, index[child + 1]) < 0) {
+            child++;
+        }
+        if (CompareCRL_Serial(index[root]->serialNumber, index[root]->serialSz,
+                                                        index[child]) >= 0) {
+            break;
+        }
+        tmp = index[root];
+        index[root] = index[child];
+        index[child] = tmp;
+        root = child;
+    }
+}
+
+
+/* Sort the revoked certs by serial for a binary search; done once, when the
+ * CRL is verified. Heap sort: in place and no recursion. If there is no
+ * memory for the index the list is searched in order. */
+static void BuildCRL_Index(CRL_Entry* crle, void* heap)
+{
+    RevokedCert** index;
+    RevokedCert*  rc;
+    RevokedCert*  tmp;
+    int           n;
+    int           i;
+
+    if (crle->certsIndex != NULL || crle->totalCerts < 2)
+        return;
+
+    index = (RevokedCert**)XMALLOC(sizeof(RevokedCert*) * crle->totalCerts,
+                                   heap, DYNAMIC_TYPE_REVOKED);
+    if (index == NULL) {
+        WOLFSSL_MSG("CRL index alloc failed, using the list");
+        return;
+    }
+
+    for (n = 0, rc = crle->certs; rc != NULL && n < crle->totalCerts;
+                                                              rc = rc->next) {
+        index[n++] = rc;
+    }
+    for (i = n / 2 - 1; i >= 0; i--)
+        SiftDownCRL_Index(index, i, n);
+    for (i = n - 1; i > 0; i--) {
+        tmp = index[0];
+        index[0] = index[i];
+        index[i] = tmp;
+        SiftDownCRL_Index(index, 0, i);
+    }
+
+    crle->certsIndex = index;
+    crle->indexSz = n;
+
+    (void)heap;
+}
+#endif /* WOLFSSL_CRL_INDEX */
+
+
+/* First CRL of issuer, in crlList order; call with crlLock held */
+static CRL_Entry* FindCRL_Entry(WOLFSSL_CRL* crl, const byte* issuerHash)
+{
+    CRL_Entry* crle;
+
+#ifdef WOLFSSL_CRL_INDEX
+    crle = crl->crlTable[HashCRL_Issuer(issuerHash)];
+    while (crle != NULL &&
+           XMEMCMP(crle->issuerHash, issuerHash, CRL_DIGEST_SIZE) != 0) {
+        crle = crle->tableNext;
+    }
+#else
+    crle = crl->crlList;
+    while (crle != NULL &&
+           XMEMCMP(crle->issuerHash, issuerHash, CRL_DIGEST_SIZE) != 0) {
+        crle = crle->next;
+    }
+#endif
+
+    return crle;
+}
+
+
+/* 1 if serial is on the CRL's revoked list */
+static int FindRevokedCert(const CRL_Entry* crle, const byte* serial,
+                           int serialSz)
+{
+    RevokedCert* rc;
+
+#ifdef WOLFSSL_CRL_INDEX
+    if (crle->certsIndex != NULL) {
+        int lo = 0;
+        int hi = crle->indexSz - 1;
+
+        while (lo <= hi) {
+            int mid = lo + (hi - lo) / 2;
+            int cmp = CompareCRL_Serial(serial, serialSz,
+                                        crle->certsIndex[mid]);
+            if (cmp == 0)
+                return 1;
+            if (cmp < 0)
+                hi = mid - 1;
+            else
+                lo = mid + 1;
+        }
+        return 0;
+    }
+#endif
+
+    for (rc = crle->certs; rc != NULL; rc = rc->next) {
+        if (rc->serialSz == serialSz &&
+                   XMEMCMP(rc->serialNumber, serial, rc->serialSz) == 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
 /* Initialize CRL Entry */
 static int InitCRL_Entry(CRL_Entry* crle, DecodedCRL* dcrl, const byte* buff,
                          int verified, void* heap)
@@ -95,6 +264,12 @@ static int InitCRL_Entry(CRL_Entry* crle, DecodedCRL* dcrl, const byte* buff,
     dcrl->certs = NULL;
     crle->totalCerts = dcrl->totalCerts;
     crle->verified = verified;
+#ifdef WOLFSSL_CRL_INDEX
+    crle->certsIndex = NULL;
+    crle->indexSz = 0;
+    if (verified)
+        BuildCRL_Index(crle, heap);
+#endif
     if (!verified) {
         crle->tbsSz = dcrl->sigIndex - dcrl->certBegin;
         crle->signatureSz = dcrl->sigLength;
@@ -142,6 +317,10 @@ static void FreeCRL_Entry(CRL_Entry* crle, void* heap)
         XFREE(tmp, heap, DYNAMIC_TYPE_REVOKED);
         tmp = next;
     }
+#ifdef WOLFSSL_CRL_INDEX
+    if (crle->certsIndex != NULL)
+        XFREE(crle->certsIndex, heap, DYNAMIC_TYPE_REVOKED);
+#endif
     if (crle->signature != NULL)
         XFREE(crle->signature, heap, DYNAMIC_TYPE_REVOKED);
     if (crle->toBeSigned != NULL)
@@ -199,7 +378,7 @@ static int CheckCertCRLList(WOLFSSL_CRL* crl, DecodedCert* cert, int *pFoundEntr
         return BAD_MUTEX_E;
     }
 
-    crle = crl->crlList;
+    crle = FindCRL_Entry(crl, cert->issuerHash);
 
     while (crle) {
         if (XMEMCMP(crle->issuerHash, cert->issuerHash, CRL_DIGEST_SIZE) == 0) {
@@ -266,25 +445,23 @@ static int CheckCertCRLList(WOLFSSL_CRL* crl, DecodedCert* cert, int *pFoundEntr
                     return BAD_MUTEX_E;
                 }
 
-                crle = crl->crlList;
-                while (crle) {
-                    if (XMEMCMP(crle->issuerHash, cert->issuerHash,
-                        CRL_DIGEST_SIZE) == 0) {
-
-                        if (ret == 0)
-                            crle->verified = 1;
-                        else
-                            crle->verified = ret;
-
-                        XFREE(crle->toBeSigned, crl->heap,
-                                                        DYNAMIC_TYPE_CRL_ENTRY);
-                        crle->toBeSigned = NULL;
-                        XFREE(crle->signature, crl->heap,
-                                                        DYNAMIC_TYPE_CRL_ENTRY);
-                        crle->signature = NULL;
-                        break;
-                    }
-                    crle = crle->next;
+                crle = FindCRL_Entry(crl, cert->issuerHash);
+                if (crle != NULL) {
+                    if (ret == 0)
+                        crle->verified = 1;
+                    else
+                        crle->verified = ret;
+
+                    XFREE(crle->toBeSigned, crl->heap,
+                                                    DYNAMIC_TYPE_CRL_ENTRY);
+                    crle->toBeSigned = NULL;
+                    XFREE(crle->signature, crl->heap,
+                                                    DYNAMIC_TYPE_CRL_ENTRY);
+                    crle->signature = NULL;
+                #ifdef WOLFSSL_CRL_INDEX
+                    if (ret == 0)
+                        BuildCRL_Index(crle, crl->heap);
+                #endif
                 }
                 if (crle == NULL || crle->verified < 0)
                     break;
@@ -317,16 +494,9 @@ static int CheckCertCRLList(WOLFSSL_CRL* crl, DecodedCert* cert, int *pFoundEntr
     }
 
     if (foundEntry) {
-        RevokedCert* rc = crle->certs;
-
-        while (rc) {
-            if (rc->serialSz == cert->serialSz &&
-                   XMEMCMP(rc->serialNumber, cert->serial, rc->serialSz) == 0) {
-                WOLFSSL_MSG("Cert revoked");
-                ret = CRL_CERT_REVOKED;
-                break;
-            }
-            rc = rc->next;
+        if (FindRevokedCert(crle, cert->serial, cert->serialSz)) {
+            WOLFSSL_MSG("Cert revoked");
+            ret = CRL_CERT_REVOKED;
         }
     }
 
@@ -419,6 +589,14 @@ static int AddCRL(WOLFSSL_CRL* crl, DecodedCRL* dcrl, const byte* buff,
     }
     crle->next = crl->crlList;
     crl->crlList = crle;
+#ifdef WOLFSSL_CRL_INDEX
+    {
+        word32 row = HashCRL_Issuer(crle->issuerHash);
+
+        crle->tableNext = crl->crlTable[row];
+        crl->crlTable[row] = crle;
+    }
+#endif
     wc_UnLockMutex(&crl->crlLock);
 
     return 0;
@@ -602,6 +780,10 @@ static CRL_Entry* DupCRL_Entry(const CRL_Entry* ent, void* heap)
         dupl->tbsSz = 0;
         dupl->signature = NULL;
         dupl->signatureSz = 0;
+    #ifdef WOLFSSL_CRL_INDEX
+        if (dupl->verified > 0)
+            BuildCRL_Index(dupl, heap);
+    #endif
     }
 
     return dupl;
@@ -681,6 +863,9 @@ static int DupX509_CRL(WOLFSSL_X509_CRL *dupl, const WOLFSSL_X509_CRL* crl)
     }
 
     dupl->crlList = DupCRL_list(crl->crlList, dupl->heap);
+#ifdef WOLFSSL_CRL_INDEX
+    BuildCRL_Table(dupl);
+#endif
 #ifdef HAVE_CRL_IO
     dupl->crlIOCb = crl->crlIOCb;
 #endif
@@ -734,6 +919,9 @@ int wolfSSL_X509_STORE_add_crl(WOLFSSL_X509_STORE *store, WOLFSSL_X509_CRL *newc
             while (tail->next != NULL) tail = tail->next;
             tail->next = toAdd;
         }
+    #ifdef WOLFSSL_CRL_INDEX
+        BuildCRL_Table(crl);
+    #endif
         wc_UnLockMutex(&crl->crlLock);
     }
 
@@ -838,6 +1026,9 @@ static int SwapLists(WOLFSSL_CRL* crl)
     /* swap lists */
     tmp->crlList  = crl->crlList;
     crl->crlList = newList;
+#ifdef WOLFSSL_CRL_INDEX
+    BuildCRL_Table(crl);
+#endif
 
     wc_UnLockMutex(&crl->crlLock);
 
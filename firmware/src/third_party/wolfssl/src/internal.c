@@ -5538,7 +5538,7 @@ int SetSSL_CTX(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
 
     ssl->CBIORecv = ctx->CBIORecv;
     ssl->CBIOSend = ctx->CBIOSend;
-#ifdef OPENSSL_EXTRA
+#if defined(OPENSSL_EXTRA) || defined(WOLFSSL_READ_AHEAD)
     ssl->readAhead = ctx->readAhead;
 #endif
     ssl->verifyDepth = ctx->verifyDepth;
@@ -8212,6 +8212,12 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
                      ssl->buffers.inputBuffer.idx;
     if (!forcedFree && usedLength > STATIC_BUFFER_LEN)
         return;
+#ifdef WOLFSSL_READ_AHEAD
+    /* keep the buffer while it holds the following records */
+    if (!forcedFree && ssl->buffers.inputAhead > 0)
+        return;
+    ssl->buffers.inputAhead = 0;
+#endif
 
     WOLFSSL_MSG("Shrinking input buffer\n");
 
@@ -10016,6 +10022,8 @@ static int ProcessCSR(WOLFSSL* ssl, byte* input, word32* inOutIdx,
 {
     int ret = 0;
     OcspRequest* request;
+    byte stapleHash[WC_SHA256_DIGEST_SIZE];
+    byte* pStapleHash = NULL;
     WOLFSSL_ENTER("ProcessCSR");
 
     #ifdef WOLFSSL_SMALL_STACK
@@ -10052,6 +10060,26 @@ static int ProcessCSR(WOLFSSL* ssl, byte* input, word32* inOutIdx,
     if (request == NULL)
         return BAD_CERTIFICATE_STATUS_ERROR; /* not expected */
 
+    /* A cached revoked status stands until its nextUpdate. A cached good
+     * status is used only when the server sent the very same staple it was
+     * verified from; any other staple is decoded, verified and replaces it. */
+    if (ssl->ctx->cm->ocsp_stapling != NULL) {
+        if (wc_Sha256Hash(input + *inOutIdx, status_length, stapleHash) == 0)
+            pStapleHash = stapleHash;
+        ret = CheckOcspCache(ssl->ctx->cm->ocsp_stapling, request,
+                                                                 pStapleHash);
+        if (ret == 0 || ret == OCSP_CERT_REVOKED) {
+            WOLFSSL_MSG("Cached OCSP status");
+            /* the staple is not decoded: no produced date */
+            XMEMSET(ssl->ocspProducedDate, 0, sizeof ssl->ocspProducedDate);
+            ssl->ocspProducedDateFormat = 0;
+            *inOutIdx += status_length;
+            WOLFSSL_LEAVE("ProcessCSR", ret);
+            return ret;
+        }
+        ret = 0;
+    }
+
     #ifdef WOLFSSL_SMALL_STACK
         status = (CertStatus*)XMALLOC(sizeof(CertStatus), ssl->heap,
                                                     DYNAMIC_TYPE_OCSP_STATUS);
@@ -10090,6 +10118,12 @@ static int ProcessCSR(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         ssl->ocspProducedDateFormat = response->producedDateFormat;
     }
 
+    if ((ret == 0 || ret == OCSP_CERT_REVOKED) &&
+                                       ssl->ctx->cm->ocsp_stapling != NULL) {
+        CacheOcspStatus(ssl->ctx->cm->ocsp_stapling, request,
+                                        response->single->status, pStapleHash);
+    }
+
     *inOutIdx += status_length;
 
     #ifdef WOLFSSL_SMALL_STACK
@@ -10736,6 +10770,60 @@ static int ProcessPeerCertCheckKey(WOLFSSL* ssl, ProcPeerCertArgs* args)
     return ret;
 }
 
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+/* Hash the peer's DER chain and ask the verified chain callback if it was
+ * verified before. A known chain is still parsed and its signers, dates,
+ * name constraints and revocation are checked, only the signatures are not. */
+static int ProcessPeerCertChainLookup(WOLFSSL* ssl, ProcPeerCertArgs* args)
+{
+    WOLFSSL_CERT_MANAGER* cm = ssl->ctx->cm;
+    wc_Sha256 sha;
+    byte      len[OPAQUE24_LEN];
+    int       ret;
+    int       i;
+
+    if (cm->cbVerifiedChain == NULL || ssl->options.verifyNone ||
+                                                        args->totalCerts == 0) {
+        return 0;
+    }
+
+    ret = wc_InitSha256_ex(&sha, ssl->heap, ssl->devId);
+    for (i = 0; ret == 0 && i < args->totalCerts; i++) {
+        c32to24(args->certs[i].length, len);
+        ret = wc_Sha256Update(&sha, len, OPAQUE24_LEN);
+        if (ret == 0) {
+            ret = wc_Sha256Update(&sha, args->certs[i].buffer,
+                                                    args->certs[i].length);
+        }
+    }
+    if (ret == 0)
+        ret = wc_Sha256Final(&sha, args->chainHash);
+    wc_Sha256Free(&sha);
+
+    if (ret == 0) {
+        args->chainHashSet = 1;
+        if (cm->cbVerifiedChain(args->chainHash, WOLFSSL_CHAIN_LOOKUP,
+                                                cm->cbVerifiedChainCtx) == 1) {
+            WOLFSSL_MSG("Peer chain verified before, skipping signatures");
+            args->chainCached = 1;
+        }
+    }
+
+    return ret;
+}
+
+    #define PEER_CERT_VERIFY(ssl, args) ((ssl)->options.verifyNone ? \
+                NO_VERIFY : ((args)->chainCached ? VERIFY_NAME : VERIFY))
+    /* the signatures are confirmed before a date error is returned and the
+     * dates are checked again on every use, so only other errors keep the
+     * chain out of the cache */
+    #define PEER_CHAIN_FAILED(ret) ((ret) != 0 && \
+                (ret) != ASN_BEFORE_DATE_E && (ret) != ASN_AFTER_DATE_E)
+#else
+    #define PEER_CERT_VERIFY(ssl, args) \
+                (!(ssl)->options.verifyNone ? VERIFY : NO_VERIFY)
+#endif /* WOLFSSL_VERIFIED_CHAIN_CB */
+
 int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                      word32 totalSz)
 {
@@ -11005,6 +11093,12 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
             XMEMSET(args->dCert, 0, sizeof(DecodedCert));
         #endif
 
+        #ifdef WOLFSSL_VERIFIED_CHAIN_CB
+            ret = ProcessPeerCertChainLookup(ssl, args);
+            if (ret != 0)
+                goto exit_ppc;
+        #endif
+
             /* Advance state and proceed */
             ssl->options.asyncState = TLS_ASYNC_BUILD;
         } /* case TLS_ASYNC_BEGIN */
@@ -11077,7 +11171,7 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                     args->certIdx = args->count - 1;
 
                     ret = ProcessPeerCertParse(ssl, args, CERT_TYPE,
-                        !ssl->options.verifyNone ? VERIFY : NO_VERIFY,
+                        PEER_CERT_VERIFY(ssl, args),
                         &subjectHash, &alreadySigner);
                 #ifdef WOLFSSL_ASYNC_CRYPT
                     if (ret == WC_PENDING_E)
@@ -11171,6 +11265,10 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                         ret = MAX_CHAIN_ERROR;
                     }
             #endif
+                #ifdef WOLFSSL_VERIFIED_CHAIN_CB
+                    if (PEER_CHAIN_FAILED(ret))
+                        args->chainFailed = 1;
+                #endif
                     /* Do verify callback */
                     ret = DoVerifyCallback(ssl->ctx->cm, ssl, ret, args);
                     if (ssl->options.verifyNone &&
@@ -11270,11 +11368,15 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                 args->certIdx = 0;
 
                 ret = ProcessPeerCertParse(ssl, args, CERT_TYPE,
-                        !ssl->options.verifyNone ? VERIFY : NO_VERIFY,
+                        PEER_CERT_VERIFY(ssl, args),
                         &subjectHash, &alreadySigner);
             #ifdef WOLFSSL_ASYNC_CRYPT
                 if (ret == WC_PENDING_E)
                     goto exit_ppc;
+            #endif
+            #ifdef WOLFSSL_VERIFIED_CHAIN_CB
+                if (PEER_CHAIN_FAILED(ret))
+                    args->chainFailed = 1;
             #endif
                 if (ret == 0) {
                     WOLFSSL_MSG("Verified Peer's cert");
@@ -11910,6 +12012,11 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
             }
         #endif
 
+        #ifdef WOLFSSL_VERIFIED_CHAIN_CB
+            if (PEER_CHAIN_FAILED(ret) || args->fatal)
+                args->chainFailed = 1;
+        #endif
+
             /* Do verify callback */
             ret = DoVerifyCallback(ssl->ctx->cm, ssl, ret, args);
 
@@ -11919,6 +12026,16 @@ int ProcessPeerCerts(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                 ret = ssl->error = 0;
             }
 
+        #ifdef WOLFSSL_VERIFIED_CHAIN_CB
+            /* only a chain that passed every check on its own is cached */
+            if (ret == 0 && args->chainHashSet && !args->chainCached &&
+                                                        !args->chainFailed) {
+                WOLFSSL_CERT_MANAGER* cm = ssl->ctx->cm;
+                cm->cbVerifiedChain(args->chainHash, WOLFSSL_CHAIN_VERIFIED,
+                                                        cm->cbVerifiedChainCtx);
+            }
+        #endif
+
             if (ret != 0) {
                 if (!ssl->options.verifyNone) {
                     DoCertFatalAlert(ssl, ret);
@@ -12069,6 +12186,8 @@ static int DoCertificateStatus(WOLFSSL* ssl, byte* input, word32* inOutIdx,
             OcspRequest* request;
             word32 list_length = status_length;
             byte   idx = 0;
+            byte   stapleHash[WC_SHA256_DIGEST_SIZE];
+            byte*  pStapleHash;
 
             #ifdef WOLFSSL_SMALL_STACK
                 CertStatus*   status;
@@ -12125,13 +12244,38 @@ static int DoCertificateStatus(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                 }
 
                 if (status_length) {
+                    /* The responses follow the chain order. The cached
+                     * status of the certificate at this position is used
+                     * as in ProcessCSR: a revoked one always, a good one
+                     * only for the same staple. */
+                    pStapleHash = NULL;
+                    if (wc_Sha256Hash(input + *inOutIdx, status_length,
+                                                           stapleHash) == 0)
+                        pStapleHash = stapleHash;
+                    request = (OcspRequest*)TLSX_CSR2_GetRequest(
+                                            ssl->extensions, status_type, idx);
+                    if (request != NULL &&
+                                       ssl->ctx->cm->ocsp_stapling != NULL) {
+                        ret = CheckOcspCache(ssl->ctx->cm->ocsp_stapling,
+                                                         request, pStapleHash);
+                        if (ret == 0 || ret == OCSP_CERT_REVOKED) {
+                            WOLFSSL_MSG("Cached OCSP status");
+                            idx++;
+                            *inOutIdx   += status_length;
+                            list_length -= status_length;
+                            continue;
+                        }
+                        ret = 0;
+                    }
+
                     InitOcspResponse(response, single, status, input +*inOutIdx,
                                      status_length, ssl->heap);
 
                     if ((OcspResponseDecode(response, ssl->ctx->cm, ssl->heap,
                                                                         0) != 0)
                     ||  (response->responseStatus != OCSP_SUCCESSFUL)
-                    ||  (response->single->status->status != CERT_GOOD))
+                    ||  (response->single->status->status != CERT_GOOD &&
+                         response->single->status->status != CERT_REVOKED))
                         ret = BAD_CERTIFICATE_STATUS_ERROR;
 
                     while (ret == 0) {
@@ -12145,6 +12289,15 @@ static int DoCertificateStatus(WOLFSSL* ssl, byte* input, word32* inOutIdx,
                         else if (idx == 1) /* server cert must be OK */
                             ret = BAD_CERTIFICATE_STATUS_ERROR;
                     }
+                    if (ret == 0) {
+                        /* revoked statuses are cached too, as in ProcessCSR */
+                        if (ssl->ctx->cm->ocsp_stapling != NULL)
+                            CacheOcspStatus(ssl->ctx->cm->ocsp_stapling,
+                                            request, response->single->status,
+                                            pStapleHash);
+                        if (response->single->status->status == CERT_REVOKED)
+                            ret = OCSP_CERT_REVOKED;
+                    }
                     FreeOcspResponse(response);
 
                     *inOutIdx   += status_length;
@@ -14893,19 +15046,23 @@ int DoApplicationData(WOLFSSL* ssl, byte* input, word32* inOutIdx)
         int process = 0;
 
         if (ssl->options.side == WOLFSSL_SERVER_END) {
-            ssl->earlyDataSz += ssl->curSize;
             if ((ssl->earlyData != no_early_data) &&
                           (ssl->options.clientState == CLIENT_HELLO_COMPLETE)) {
+                /* Accepted early data is limited by its plaintext size
+                 * below. */
                 process = 1;
             }
-            if (!process && (ssl->earlyDataSz <= ssl->options.maxEarlyDataSz)) {
-                WOLFSSL_MSG("Ignoring EarlyData!");
-                *inOutIdx = ssl->buffers.inputBuffer.length;
-                return 0;
-            }
-            if (ssl->earlyDataSz > ssl->options.maxEarlyDataSz) {
+            else {
+                /* Skipped records are counted with their protection
+                 * overhead. */
+                ssl->earlyDataSz += ssl->curSize;
+                if (ssl->earlyDataSz <=
+                                ssl->options.maxEarlyDataSz + MAX_MSG_EXTRA) {
+                    WOLFSSL_MSG("Ignoring EarlyData!");
+                    *inOutIdx = ssl->buffers.inputBuffer.length;
+                    return 0;
+                }
                 WOLFSSL_MSG("Too much EarlyData!");
-                process = 0;
             }
         }
         if (!process) {
@@ -14945,7 +15102,8 @@ int DoApplicationData(WOLFSSL* ssl, byte* input, word32* inOutIdx)
         return BUFFER_ERROR;
     }
 #ifdef WOLFSSL_EARLY_DATA
-    if (ssl->earlyData > early_data_ext) {
+    if (ssl->options.side == WOLFSSL_SERVER_END &&
+                                          ssl->earlyData > early_data_ext) {
         if (ssl->earlyDataSz + dataSz > ssl->options.maxEarlyDataSz) {
             SendAlert(ssl, alert_fatal, unexpected_message);
             return WOLFSSL_FATAL_ERROR;
@@ -15081,6 +15239,9 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
     int maxLength;
     int usedLength;
     int dtlsExtra = 0;
+#ifdef WOLFSSL_READ_AHEAD
+    int readAhead = ssl->readAhead && !ssl->options.dtls;
+#endif
 
 
     /* check max input length */
@@ -15096,25 +15257,73 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
     }
 #endif
 
+#ifdef WOLFSSL_READ_AHEAD
+    /* read ahead may already have it */
+    if (readAhead && usedLength + (int)ssl->buffers.inputAhead >= (int)size) {
+        ssl->buffers.inputAhead -= size - usedLength;
+        ssl->buffers.inputBuffer.length = ssl->buffers.inputBuffer.idx + size;
+        return 0;
+    }
+#endif
+
     /* check that no lengths or size values are negative */
     if (usedLength < 0 || maxLength < 0 || inSz <= 0) {
         return BUFFER_ERROR;
     }
 
-    if (inSz > maxLength) {
-        if (GrowInputBuffer(ssl, size + dtlsExtra, usedLength) < 0)
-            return MEMORY_E;
+#ifdef WOLFSSL_READ_AHEAD
+    if (readAhead) {
+        /* Read everything the transport has, up to the buffer size, so the
+         * following records are usually already here. The record layer
+         * expects the current record to end at inputBuffer.length; the bytes
+         * read past it are kept after it and counted in inputAhead.
+         * This is not a ring: the unread data is moved back to the start
+         * only when the record being read would run past the buffer end. */
+        usedLength += ssl->buffers.inputAhead;
+        ssl->buffers.inputAhead = 0;
+        if (ssl->buffers.inputBuffer.bufferSize <
+                                     (word32)max(size, WOLFSSL_READ_AHEAD_SZ)) {
+            if (GrowInputBuffer(ssl, max(size, WOLFSSL_READ_AHEAD_SZ),
+                                usedLength) < 0)
+                return MEMORY_E;
+        }
+        else if (usedLength == 0) {
+            ssl->buffers.inputBuffer.idx    = 0;
+            ssl->buffers.inputBuffer.length = 0;
+        }
+        else if (ssl->buffers.inputBuffer.idx + size >
+                                        ssl->buffers.inputBuffer.bufferSize) {
+            XMEMMOVE(ssl->buffers.inputBuffer.buffer,
+                ssl->buffers.inputBuffer.buffer + ssl->buffers.inputBuffer.idx,
+                usedLength);
+            ssl->buffers.inputBuffer.idx    = 0;
+            ssl->buffers.inputBuffer.length = usedLength;
+        }
+        else {
+            ssl->buffers.inputBuffer.length = ssl->buffers.inputBuffer.idx +
+                                              usedLength;
+        }
+        inSz = (int)(ssl->buffers.inputBuffer.bufferSize -
+                     ssl->buffers.inputBuffer.length);
     }
+    else
+#endif /* WOLFSSL_READ_AHEAD */
+    {
+        if (inSz > maxLength) {
+            if (GrowInputBuffer(ssl, size + dtlsExtra, usedLength) < 0)
+                return MEMORY_E;
+        }
 
-    /* Put buffer data at start if not there */
-    if (usedLength > 0 && ssl->buffers.inputBuffer.idx != 0)
-        XMEMMOVE(ssl->buffers.inputBuffer.buffer,
+        /* Put buffer data at start if not there */
+        if (usedLength > 0 && ssl->buffers.inputBuffer.idx != 0)
+            XMEMMOVE(ssl->buffers.inputBuffer.buffer,
                 ssl->buffers.inputBuffer.buffer + ssl->buffers.inputBuffer.idx,
                 usedLength);
 
-    /* remove processed data */
-    ssl->buffers.inputBuffer.idx    = 0;
-    ssl->buffers.inputBuffer.length = usedLength;
+        /* remove processed data */
+        ssl->buffers.inputBuffer.idx    = 0;
+        ssl->buffers.inputBuffer.length = usedLength;
+    }
 
     /* read data from network */
     do {
@@ -15134,7 +15343,16 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
         ssl->buffers.inputBuffer.length += in;
         inSz -= in;
 
-    } while (ssl->buffers.inputBuffer.length < size);
+    } while (ssl->buffers.inputBuffer.length - ssl->buffers.inputBuffer.idx <
+                                                                         size);
+
+#ifdef WOLFSSL_READ_AHEAD
+    if (readAhead) {
+        ssl->buffers.inputAhead = ssl->buffers.inputBuffer.length -
+                                  ssl->buffers.inputBuffer.idx - size;
+        ssl->buffers.inputBuffer.length = ssl->buffers.inputBuffer.idx + size;
+    }
+#endif
 
 #ifdef WOLFSSL_DEBUG_TLS
     if (ssl->buffers.inputBuffer.idx == 0) {
@@ -15639,7 +15857,7 @@ int ProcessReply(WOLFSSL* ssl)
                                                      CLIENT_FINISHED_COMPLETE) {
                             ssl->earlyDataSz += ssl->curSize;
                             if (ssl->earlyDataSz <=
-                                                  ssl->options.maxEarlyDataSz) {
+                                ssl->options.maxEarlyDataSz + MAX_MSG_EXTRA) {
                                 WOLFSSL_MSG("Ignoring EarlyData!");
                                 if (ssl->keys.peer_sequence_number_lo-- == 0)
                                     ssl->keys.peer_sequence_number_hi--;
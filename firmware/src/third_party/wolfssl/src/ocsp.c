@@ -71,6 +71,27 @@ static int InitOcspEntry(OcspEntry* entry, OcspRequest* request)
 }
 
 
+static void FreeOcspStatus(CertStatus* status, void* heap)
+{
+    if (status->rawOcspResponse)
+        XFREE(status->rawOcspResponse, heap, DYNAMIC_TYPE_OCSP_STATUS);
+
+#ifdef OPENSSL_EXTRA
+    if (status->serialInt) {
+        if (status->serialInt->isDynamic) {
+            XFREE(status->serialInt->data, NULL, DYNAMIC_TYPE_OPENSSL);
+        }
+        XFREE(status->serialInt, NULL, DYNAMIC_TYPE_OPENSSL);
+    }
+    status->serialInt = NULL;
+#endif
+
+    XFREE(status, heap, DYNAMIC_TYPE_OCSP_STATUS);
+
+    (void)heap;
+}
+
+
 static void FreeOcspEntry(OcspEntry* entry, void* heap)
 {
     CertStatus *status, *next;
@@ -82,21 +103,7 @@ static void FreeOcspEntry(OcspEntry* entry, void* heap)
 
     for (status = entry->status; status; status = next) {
         next = status->next;
-
-        if (status->rawOcspResponse)
-            XFREE(status->rawOcspResponse, heap, DYNAMIC_TYPE_OCSP_STATUS);
-
-#ifdef OPENSSL_EXTRA
-        if (status->serialInt) {
-            if (status->serialInt->isDynamic) {
-                XFREE(status->serialInt->data, NULL, DYNAMIC_TYPE_OPENSSL);
-            }
-            XFREE(status->serialInt, NULL, DYNAMIC_TYPE_OPENSSL);
-        }
-        status->serialInt = NULL;
-#endif
-
-        XFREE(status, heap, DYNAMIC_TYPE_OCSP_STATUS);
+        FreeOcspStatus(status, heap);
     }
 
     (void)heap;
@@ -135,6 +142,118 @@ static int xstat2err(int st)
     }
 }
 
+
+/* 1 if the status is within its thisUpdate - nextUpdate window */
+static int IsOcspStatusCurrent(const CertStatus* status)
+{
+#ifndef NO_ASN_TIME
+    return XVALIDATE_DATE(status->thisDate, status->thisDateFormat, BEFORE)
+        && status->nextDate[0] != 0
+        && XVALIDATE_DATE(status->nextDate, status->nextDateFormat, AFTER);
+#else
+    (void)status;
+    return 1;
+#endif
+}
+
+
+static CertStatus* FindOcspStatus(OcspEntry* entry, const byte* serial,
+                                  int serialSz)
+{
+    CertStatus* status;
+
+    for (status = entry->status; status; status = status->next)
+        if (status->serialSz == serialSz
+        &&  !XMEMCMP(status->serial, serial, serialSz))
+            break;
+
+    return status;
+}
+
+
+/* Makes room for one more status on entry: drops the statuses past their
+ * nextUpdate and, over OCSP_CACHE_MAX_STATUS, the oldest ones; the entry's
+ * own first. Call with ocspLock held. */
+static void PruneOcspCache(WOLFSSL_OCSP* ocsp, OcspEntry* entry)
+{
+    OcspEntry*   e;
+    CertStatus** prev;
+    CertStatus*  status;
+    int          total = 0;
+
+    for (e = ocsp->ocspList; e; e = e->next) {
+        for (prev = &e->status; (status = *prev) != NULL; ) {
+            if (!IsOcspStatusCurrent(status)) {
+                *prev = status->next;
+                FreeOcspStatus(status, ocsp->cm->heap);
+                e->totalStatus--;
+            }
+            else
+                prev = &status->next;
+        }
+        total += e->totalStatus;
+    }
+
+#if OCSP_CACHE_MAX_STATUS > 0
+    while (total >= OCSP_CACHE_MAX_STATUS) {
+        OcspEntry* victim = entry;
+
+        for (e = ocsp->ocspList; victim->status == NULL && e; e = e->next)
+            victim = e;
+        if (victim->status == NULL)
+            break;
+
+        /* newest statuses are first */
+        for (prev = &victim->status; (*prev)->next; prev = &(*prev)->next)
+            ;
+        FreeOcspStatus(*prev, ocsp->cm->heap);
+        *prev = NULL;
+        victim->totalStatus--;
+        total--;
+    }
+#endif
+
+    (void)entry;
+    (void)total;
+}
+
+
+/* Keeps a copy of newStatus on entry, replacing the one of the same serial.
+ * The copy has no raw response. Call with ocspLock held.
+ * Returns the cached status, NULL if out of memory. */
+static CertStatus* SaveOcspStatus(WOLFSSL_OCSP* ocsp, OcspEntry* entry,
+                                  const CertStatus* newStatus)
+{
+    CertStatus* status;
+    CertStatus* next;
+
+    status = FindOcspStatus(entry, newStatus->serial, newStatus->serialSz);
+    if (status != NULL) {
+        if (status->rawOcspResponse) {
+            XFREE(status->rawOcspResponse, ocsp->cm->heap,
+                  DYNAMIC_TYPE_OCSP_STATUS);
+        }
+        next = status->next;
+    }
+    else {
+        PruneOcspCache(ocsp, entry);
+        status = (CertStatus*)XMALLOC(sizeof(CertStatus),
+                                      ocsp->cm->heap, DYNAMIC_TYPE_OCSP_STATUS);
+        if (status == NULL)
+            return NULL;
+        next = entry->status;
+        entry->status = status;
+        entry->totalStatus++;
+    }
+
+    XMEMCPY(status, newStatus, sizeof(CertStatus));
+    status->next = next;
+    status->rawOcspResponse = NULL;
+    status->rawOcspResponseSz = 0;
+
+    return status;
+}
+
 int CheckCertOCSP_ex(WOLFSSL_OCSP* ocsp, DecodedCert* cert, buffer* responseBuffer, WOLFSSL* ssl)
 {
     int ret = OCSP_LOOKUP_FAIL;
@@ -230,24 +349,14 @@ static int GetOcspStatus(WOLFSSL_OCSP* ocsp, OcspRequest* request,
         return BAD_MUTEX_E;
     }
 
-    for (*status = entry->status; *status; *status = (*status)->next)
-        if ((*status)->serialSz == request->serialSz
-        &&  !XMEMCMP((*status)->serial, request->serial, (*status)->serialSz))
-            break;
+    *status = FindOcspStatus(entry, request->serial, request->serialSz);
 
     if (responseBuffer && *status && !(*status)->rawOcspResponse) {
         /* force fetching again */
         ret = OCSP_INVALID_STATUS;
     }
     else if (*status) {
-#ifndef NO_ASN_TIME
-        if (XVALIDATE_DATE((*status)->thisDate,
-                                             (*status)->thisDateFormat, BEFORE)
-        &&  ((*status)->nextDate[0] != 0)
-        &&  XVALIDATE_DATE((*status)->nextDate,
-                                             (*status)->nextDateFormat, AFTER))
-#endif
-        {
+        if (IsOcspStatusCurrent(*status)) {
             ret = xstat2err((*status)->status);
 
             if (responseBuffer) {
@@ -353,27 +462,9 @@ WOLFSSL_LOCAL int CheckOcspResponse(WOLFSSL_OCSP *ocsp, byte *response, int resp
         goto end;
     }
 
-    if (status != NULL) {
-        if (status->rawOcspResponse) {
-            XFREE(status->rawOcspResponse, ocsp->cm->heap,
-                  DYNAMIC_TYPE_OCSP_STATUS);
-        }
-
-        /* Replace existing certificate entry with updated */
-        newSingle->status->next = status->next;
-        XMEMCPY(status, newSingle->status, sizeof(CertStatus));
-    }
-    else {
-        /* Save new certificate entry */
-        status = (CertStatus*)XMALLOC(sizeof(CertStatus),
-                                      ocsp->cm->heap, DYNAMIC_TYPE_OCSP_STATUS);
-        if (status != NULL) {
-            XMEMCPY(status, newSingle->status, sizeof(CertStatus));
-            status->next  = entry->status;
-            entry->status = status;
-            entry->totalStatus++;
-        }
-    }
+    /* Replace the existing certificate entry or save a new one; looked up
+     * again as the list may have changed since the status was found */
+    status = SaveOcspStatus(ocsp, entry, newSingle->status);
 
     if (status && responseBuffer && responseBuffer->buffer) {
         status->rawOcspResponse = (byte*)XMALLOC(responseBuffer->length,
@@ -511,6 +602,94 @@ int CheckOcspRequest(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest,
     return ret;
 }
 
+
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
+ || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+/* Cached status of the certificate in ocspRequest, without a look up.
+ *
+ * A revoked status always stands. Any other status stands only for the
+ * staple it was verified from: stapleHash, the SHA-256 of the new staple,
+ * has to match it. A NULL stapleHash matches nothing.
+ *
+ * Returns 0 or OCSP_CERT_REVOKED/OCSP_CERT_UNKNOWN, and OCSP_INVALID_STATUS
+ * when there is no current status that can be used.
+ */
+int CheckOcspCache(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest,
+                                                        const byte* stapleHash)
+{
+    OcspEntry*  entry;
+    CertStatus* status;
+    int         ret = OCSP_INVALID_STATUS;
+
+    WOLFSSL_ENTER("CheckOcspCache");
+
+    if (ocsp == NULL || ocspRequest == NULL)
+        return BAD_FUNC_ARG;
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0)
+        return BAD_MUTEX_E;
+
+    for (entry = ocsp->ocspList; entry; entry = entry->next)
+        if (XMEMCMP(entry->issuerHash,    ocspRequest->issuerHash,
+                                                         OCSP_DIGEST_SIZE) == 0
+        &&  XMEMCMP(entry->issuerKeyHash, ocspRequest->issuerKeyHash,
+                                                         OCSP_DIGEST_SIZE) == 0)
+            break;
+
+    if (entry) {
+        status = FindOcspStatus(entry, ocspRequest->serial,
+                                                        ocspRequest->serialSz);
+        if (status && IsOcspStatusCurrent(status) &&
+            (status->status == CERT_REVOKED || (stapleHash != NULL &&
+             XMEMCMP(status->stapleHash, stapleHash,
+                                             WC_SHA256_DIGEST_SIZE) == 0)))
+            ret = xstat2err(status->status);
+    }
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    WOLFSSL_LEAVE("CheckOcspCache", ret);
+    return ret;
+}
+
+
+/* Caches the status, from a verified response, of the certificate in
+ * ocspRequest; it replaces the cached one and is used until its nextUpdate.
+ * stapleHash is the SHA-256 of the stapled response, NULL if not known.
+ * 0 on success */
+int CacheOcspStatus(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest,
+                                    CertStatus* status, const byte* stapleHash)
+{
+    OcspEntry*  entry = NULL;
+    CertStatus* saved;
+    int         ret;
+
+    WOLFSSL_ENTER("CacheOcspStatus");
+
+    if (ocsp == NULL || ocspRequest == NULL || status == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = GetOcspEntry(ocsp, ocspRequest, &entry);
+    if (ret != 0)
+        return ret;
+
+    if (wc_LockMutex(&ocsp->ocspLock) != 0)
+        return BAD_MUTEX_E;
+
+    saved = SaveOcspStatus(ocsp, entry, status);
+    if (saved == NULL)
+        ret = MEMORY_E;
+    else if (stapleHash != NULL)
+        XMEMCPY(saved->stapleHash, stapleHash, WC_SHA256_DIGEST_SIZE);
+    else
+        XMEMSET(saved->stapleHash, 0, WC_SHA256_DIGEST_SIZE);
+
+    wc_UnLockMutex(&ocsp->ocspLock);
+
+    return ret;
+}
+#endif /* HAVE_CERTIFICATE_STATUS_REQUEST || HAVE_CERTIFICATE_STATUS_REQUEST_V2 */
+
 #if defined(OPENSSL_ALL) || defined(WOLFSSL_NGINX) || defined(WOLFSSL_HAPROXY) || \
     defined(WOLFSSL_APACHE_HTTPD) || defined(HAVE_LIGHTY)
 
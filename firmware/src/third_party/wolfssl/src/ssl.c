@@ -3733,9 +3733,8 @@ void wolfSSL_CertManagerFree(WOLFSSL_CERT_MANAGER* cm)
                 if (cm->ocsp)
                     FreeOCSP(cm->ocsp, 1);
                 XFREE(cm->ocspOverrideURL, cm->heap, DYNAMIC_TYPE_URL);
-            #if !defined(NO_WOLFSSL_SERVER) && \
-                (defined(HAVE_CERTIFICATE_STATUS_REQUEST) || \
-                 defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2))
+            #if defined(HAVE_CERTIFICATE_STATUS_REQUEST) || \
+                defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
                 if (cm->ocsp_stapling)
                     FreeOCSP(cm->ocsp_stapling, 1);
             #endif
@@ -4425,6 +4424,30 @@ int MatchTrustedPeer(TrustedPeerCert* tp, DecodedCert* cert)
 
 
 /* return CA if found, otherwise NULL */
+#ifdef WOLFSSL_MISSING_CA_CB
+/* Ask the missing CA callback to add the CA and look it up again.
+ * The callback is cleared while it runs so loading the CA does not recurse. */
+static Signer* GetMissingCA(WOLFSSL_CERT_MANAGER* cm, byte* hash, int hashType)
+{
+    Signer*     ret = NULL;
+    CbMissingCA cb = cm->cbMissingCA;
+
+    cm->cbMissingCA = NULL;
+    if (cb(hash, hashType, cm->cbMissingCACtx) == 1) {
+        WOLFSSL_MSG("Missing CA added by callback");
+    #ifndef NO_SKID
+        if (hashType == WOLFSSL_CA_HASH_NAME)
+            ret = GetCAByName(cm, hash);
+        else
+    #endif
+            ret = GetCA(cm, hash);
+    }
+    cm->cbMissingCA = cb;
+
+    return ret;
+}
+#endif /* WOLFSSL_MISSING_CA_CB */
+
 Signer* GetCA(void* vp, byte* hash)
 {
     WOLFSSL_CERT_MANAGER* cm = (WOLFSSL_CERT_MANAGER*)vp;
@@ -4456,6 +4479,16 @@ Signer* GetCA(void* vp, byte* hash)
     }
     wc_UnLockMutex(&cm->caLock);
 
+#ifdef WOLFSSL_MISSING_CA_CB
+    if (ret == NULL && cm->cbMissingCA != NULL) {
+    #ifndef NO_SKID
+        ret = GetMissingCA(cm, hash, WOLFSSL_CA_HASH_KEYID);
+    #else
+        ret = GetMissingCA(cm, hash, WOLFSSL_CA_HASH_NAME);
+    #endif
+    }
+#endif
+
     return ret;
 }
 
@@ -4487,6 +4520,11 @@ Signer* GetCAByName(void* vp, byte* hash)
     }
     wc_UnLockMutex(&cm->caLock);
 
+#ifdef WOLFSSL_MISSING_CA_CB
+    if (ret == NULL && cm->cbMissingCA != NULL)
+        ret = GetMissingCA(cm, hash, WOLFSSL_CA_HASH_NAME);
+#endif
+
     return ret;
 }
 #endif
@@ -6364,7 +6402,7 @@ int wolfSSL_CertManagerEnableOCSPStapling(WOLFSSL_CERT_MANAGER* cm)
 
 #if defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
  || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
-    #ifndef NO_WOLFSSL_SERVER
+    /* server: responses to staple; client: received staples */
     if (cm->ocsp_stapling == NULL) {
         cm->ocsp_stapling = (WOLFSSL_OCSP*)XMALLOC(sizeof(WOLFSSL_OCSP),
                                                cm->heap, DYNAMIC_TYPE_OCSP);
@@ -6379,6 +6417,7 @@ int wolfSSL_CertManagerEnableOCSPStapling(WOLFSSL_CERT_MANAGER* cm)
         }
     }
 
+    #ifndef NO_WOLFSSL_SERVER
     #ifndef WOLFSSL_USER_IO
         cm->ocspIOCb = EmbedOcspLookup;
         cm->ocspRespFreeCb = EmbedOcspRespFree;
@@ -10841,6 +10880,54 @@ void wolfSSL_CTX_SetCACb(WOLFSSL_CTX* ctx, CallbackCACache cb)
         ctx->cm->caCacheCallback = cb;
 }
 
+#ifdef WOLFSSL_MISSING_CA_CB
+int wolfSSL_CertManagerSetMissingCA_Cb(WOLFSSL_CERT_MANAGER* cm, CbMissingCA cb,
+                                       void* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetMissingCA_Cb");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    cm->cbMissingCA = cb;
+    cm->cbMissingCACtx = ctx;
+
+    return WOLFSSL_SUCCESS;
+}
+
+int wolfSSL_CTX_SetMissingCA_Cb(WOLFSSL_CTX* ctx, CbMissingCA cb)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetMissingCA_Cb");
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    return wolfSSL_CertManagerSetMissingCA_Cb(ctx->cm, cb, ctx);
+}
+#endif
+
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+int wolfSSL_CertManagerSetVerifiedChain_Cb(WOLFSSL_CERT_MANAGER* cm,
+                                           CbVerifiedChain cb, void* ctx)
+{
+    WOLFSSL_ENTER("wolfSSL_CertManagerSetVerifiedChain_Cb");
+    if (cm == NULL)
+        return BAD_FUNC_ARG;
+
+    cm->cbVerifiedChain = cb;
+    cm->cbVerifiedChainCtx = ctx;
+
+    return WOLFSSL_SUCCESS;
+}
+
+int wolfSSL_CTX_SetVerifiedChain_Cb(WOLFSSL_CTX* ctx, CbVerifiedChain cb)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetVerifiedChain_Cb");
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    return wolfSSL_CertManagerSetVerifiedChain_Cb(ctx->cm, cb, ctx);
+}
+#endif
+
 
 #if defined(PERSIST_CERT_CACHE)
 
@@ -28818,7 +28905,9 @@ WOLFSSL_API long wolfSSL_CTX_get_session_cache_mode(WOLFSSL_CTX* ctx)
     return m;
 }
 
+#endif /* OPENSSL_EXTRA */
 
+#if defined(OPENSSL_EXTRA) || defined(WOLFSSL_READ_AHEAD)
 int wolfSSL_CTX_get_read_ahead(WOLFSSL_CTX* ctx)
 {
     if (ctx == NULL) {
@@ -28841,6 +28930,36 @@ int wolfSSL_CTX_set_read_ahead(WOLFSSL_CTX* ctx, int v)
 }
 
 
+int wolfSSL_get_read_ahead(const WOLFSSL* ssl)
+{
+    if (ssl == NULL) {
+        return WOLFSSL_FAILURE;
+    }
+
+    return ssl->readAhead;
+}
+
+
+/* Read-ahead can be turned off only when no data was read past the current
+ * record, the bytes kept in inputAhead would be lost otherwise. */
+int wolfSSL_set_read_ahead(WOLFSSL* ssl, int v)
+{
+    if (ssl == NULL) {
+        return WOLFSSL_FAILURE;
+    }
+    if (!v && ssl->buffers.inputAhead != 0) {
+        return WOLFSSL_FAILURE;
+    }
+
+    ssl->readAhead = (byte)v;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* OPENSSL_EXTRA || WOLFSSL_READ_AHEAD */
+
+#ifdef OPENSSL_EXTRA
+
+
 long wolfSSL_CTX_set_tlsext_opaque_prf_input_callback_arg(WOLFSSL_CTX* ctx,
         void* arg)
 {
@@ -1361,7 +1361,22 @@ end:
         return (word32) (TickGet() / (TICKS_PER_SECOND / 1000));
     }
 #elif defined(MICROCHIP_TCPIP)
-    #if defined(MICROCHIP_MPLAB_HARMONY)
+    #if defined(MICROCHIP_MPLAB_HARMONY_3)
+        #include "system/time/sys_time.h"
+
+    /* The time in milliseconds.
+     * Used for tickets to represent difference between when first seen and when
+     * sending.
+     *
+     * returns the time in milliseconds as a 32-bit value.
+     */
+    word32 TimeNowInMilliseconds(void)
+    {
+        /* 64-bit count: the 32-bit one wraps within a minute */
+        return (word32)((SYS_TIME_Counter64Get() * 1000) /
+                        (uint64_t)SYS_TIME_FrequencyGet());
+    }
+    #elif defined(MICROCHIP_MPLAB_HARMONY)
         #include <system/tmr/sys_tmr.h>
 
     /* The time in milliseconds.
@@ -3257,8 +3272,12 @@ static int DoTls13EncryptedExtensions(WOLFSSL* ssl, const byte* input,
 #ifdef WOLFSSL_EARLY_DATA
     if (ssl->earlyData != no_early_data) {
         TLSX* ext = TLSX_Find(ssl->extensions, TLSX_EARLY_DATA);
-        if (ext == NULL || !ext->val)
+        if (ext == NULL || !ext->val) {
             ssl->earlyData = no_early_data;
+            ssl->earlyDataStatus = WOLFSSL_EARLY_DATA_REJECTED;
+        }
+        else
+            ssl->earlyDataStatus = WOLFSSL_EARLY_DATA_ACCEPTED;
     }
 #endif
 
@@ -8610,6 +8629,8 @@ int wolfSSL_set_max_early_data(WOLFSSL* ssl, unsigned int sz)
  * data   Early data to write
  * sz     The size of the eary data in bytes.
  * outSz  The number of early data bytes written.
+ * No more than the maximum early data size of the session's ticket is sent;
+ * the rest is left for the caller to write once the handshake is done.
  * returns BAD_FUNC_ARG when: ssl, data or outSz is NULL; sz is negative;
  * or not using TLS v1.3. SIDE ERROR when not a server. Otherwise the number of
  * early data bytes written.
@@ -8624,6 +8645,7 @@ int wolfSSL_write_early_data(WOLFSSL* ssl, const void* data, int sz, int* outSz)
         return BAD_FUNC_ARG;
     if (!IsAtLeastTLSv1_3(ssl->version))
         return BAD_FUNC_ARG;
+    *outSz = 0;
 
 #ifndef NO_WOLFSSL_CLIENT
     if (ssl->options.side == WOLFSSL_SERVER_END)
@@ -8636,9 +8658,15 @@ int wolfSSL_write_early_data(WOLFSSL* ssl, const void* data, int sz, int* outSz)
             return WOLFSSL_FATAL_ERROR;
     }
     if (ssl->options.handShakeState == CLIENT_HELLO_COMPLETE) {
-        ret = SendData(ssl, data, sz);
-        if (ret > 0)
+        if ((word32)sz > ssl->session.maxEarlyDataSz - ssl->earlyDataSz)
+            sz = (int)(ssl->session.maxEarlyDataSz - ssl->earlyDataSz);
+        ret = 0;
+        if (sz > 0)
+            ret = SendData(ssl, data, sz);
+        if (ret > 0) {
+            ssl->earlyDataSz += ret;
             *outSz = ret;
+        }
     }
 #else
     return SIDE_ERROR;
@@ -8651,6 +8679,25 @@ int wolfSSL_write_early_data(WOLFSSL* ssl, const void* data, int sz, int* outSz)
     return ret;
 }
 
+/* Get whether the server accepted the early data of the client.
+ * Only known once the server's EncryptedExtensions have been processed.
+ *
+ * ssl  The SSL/TLS object.
+ * returns BAD_FUNC_ARG when ssl is NULL or not using TLS v1.3, SIDE_ERROR when
+ * not a client. Otherwise WOLFSSL_EARLY_DATA_ACCEPTED or
+ * WOLFSSL_EARLY_DATA_REJECTED when early data was offered and
+ * WOLFSSL_EARLY_DATA_NOT_SENT when it was not.
+ */
+int wolfSSL_get_early_data_status(const WOLFSSL* ssl)
+{
+    if (ssl == NULL || !IsAtLeastTLSv1_3(ssl->version))
+        return BAD_FUNC_ARG;
+    if (ssl->options.side == WOLFSSL_SERVER_END)
+        return SIDE_ERROR;
+
+    return ssl->earlyDataStatus;
+}
+
 /* Read the any early data from the client.
  *
  * ssl    The SSL/TLS object.
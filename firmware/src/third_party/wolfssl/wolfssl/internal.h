@@ -1841,6 +1841,13 @@ enum {
     #define STATIC_BUFFER_LEN RECORD_HEADER_SZ
 #endif
 
+#ifdef WOLFSSL_READ_AHEAD
+    /* smallest input buffer used when reading ahead */
+    #ifndef WOLFSSL_READ_AHEAD_SZ
+        #define WOLFSSL_READ_AHEAD_SZ 2048
+    #endif
+#endif
+
 typedef struct {
     ALIGN16 byte staticBuffer[STATIC_BUFFER_LEN];
     byte*  buffer;       /* place holder for static or dynamic buffer */
@@ -1922,6 +1929,11 @@ struct WOLFSSL_CIPHER {
 
 /* wolfSSL OCSP controller */
 #ifdef HAVE_OCSP
+#ifndef OCSP_CACHE_MAX_STATUS
+    /* most certificate statuses an OCSP controller keeps, 0 for no limit */
+    #define OCSP_CACHE_MAX_STATUS 0
+#endif
+
 struct WOLFSSL_OCSP {
     WOLFSSL_CERT_MANAGER* cm;            /* pointer back to cert manager */
     OcspEntry*            ocspList;      /* OCSP response list */
@@ -1950,9 +1962,16 @@ typedef struct CRL_Entry CRL_Entry;
     typedef struct RevokedCert RevokedCert;
 #endif
 
+#if defined(WOLFSSL_CRL_INDEX) && !defined(CRL_TABLE_SIZE)
+    #define CRL_TABLE_SIZE 11
+#endif
+
 /* Complete CRL */
 struct CRL_Entry {
     CRL_Entry* next;                      /* next entry */
+#ifdef WOLFSSL_CRL_INDEX
+    CRL_Entry* tableNext;                 /* next entry in issuer bucket */
+#endif
     byte    issuerHash[CRL_DIGEST_SIZE];  /* issuer hash                 */
     /* byte    crlHash[CRL_DIGEST_SIZE];      raw crl data hash           */
     /* restore the hash here if needed for optimized comparisons */
@@ -1962,6 +1981,11 @@ struct CRL_Entry {
     byte    nextDateFormat;          /* next date format */
     RevokedCert* certs;              /* revoked cert list  */
     int          totalCerts;         /* number on list     */
+#ifdef WOLFSSL_CRL_INDEX
+    RevokedCert** certsIndex;        /* revoked certs by serial, NULL if
+                                        not built                        */
+    int          indexSz;            /* number in the index */
+#endif
     int     verified;
     byte*   toBeSigned;
     word32  tbsSz;
@@ -1992,6 +2016,9 @@ struct CRL_Monitor {
 struct WOLFSSL_CRL {
     WOLFSSL_CERT_MANAGER* cm;            /* pointer back to cert manager */
     CRL_Entry*            crlList;       /* our CRL list */
+#ifdef WOLFSSL_CRL_INDEX
+    CRL_Entry*            crlTable[CRL_TABLE_SIZE]; /* crlList by issuer */
+#endif
 #ifdef HAVE_CRL_IO
     CbCrlIO               crlIOCb;
 #endif
@@ -2032,9 +2059,11 @@ struct WOLFSSL_CERT_MANAGER {
 #endif
     WOLFSSL_CRL*    crl;                 /* CRL checker */
     WOLFSSL_OCSP*   ocsp;                /* OCSP checker */
-#if !defined(NO_WOLFSSL_SERVER) && (defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
-                               ||  defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2))
-    WOLFSSL_OCSP*   ocsp_stapling;       /* OCSP checker for OCSP stapling */
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
+ || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+    WOLFSSL_OCSP*   ocsp_stapling;       /* OCSP stapling responses, sent by
+                                          * the server or received by the
+                                          * client */
 #endif
     char*           ocspOverrideURL;     /* use this responder */
     void*           ocspIOCtx;           /* I/O callback CTX */
@@ -2043,6 +2072,14 @@ struct WOLFSSL_CERT_MANAGER {
 #endif
     CallbackCACache caCacheCallback;       /* CA cache addition callback */
     CbMissingCRL    cbMissingCRL;          /* notify thru cb of missing crl */
+#ifdef WOLFSSL_MISSING_CA_CB
+    CbMissingCA     cbMissingCA;           /* load a CA on lookup miss */
+    void*           cbMissingCACtx;        /* missing CA callback context */
+#endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+    CbVerifiedChain cbVerifiedChain;       /* verified peer chain cache */
+    void*           cbVerifiedChainCtx;    /* verified chain callback context */
+#endif
     CbOCSPIO        ocspIOCb;              /* I/O callback for OCSP lookup */
     CbOCSPRespFree  ocspRespFreeCb;        /* Frees OCSP Response from IO Cb */
     wolfSSL_Mutex   caLock;                /* CA list lock */
@@ -2079,6 +2116,9 @@ WOLFSSL_LOCAL int CM_VerifyBuffer_ex(WOLFSSL_CERT_MANAGER* cm, const byte* buff,
 
 #ifndef NO_CERTS
 #if !defined(NO_WOLFSSL_CLIENT) || !defined(WOLFSSL_NO_CLIENT_AUTH)
+#if defined(WOLFSSL_VERIFIED_CHAIN_CB) && defined(NO_SHA256)
+    #error WOLFSSL_VERIFIED_CHAIN_CB requires SHA-256
+#endif
 typedef struct ProcPeerCertArgs {
     buffer*      certs;
 #ifdef WOLFSSL_TLS13
@@ -2096,6 +2136,9 @@ typedef struct ProcPeerCertArgs {
 #endif
 #if defined(OPENSSL_EXTRA) || defined(OPENSSL_EXTRA_X509_SMALL)
     char   untrustedDepth;
+#endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+    byte   chainHash[WC_SHA256_DIGEST_SIZE]; /* hash of the peer's DER chain */
 #endif
     word16 fatal:1;
     word16 verifyErr:1;
@@ -2103,6 +2146,11 @@ typedef struct ProcPeerCertArgs {
 #ifdef WOLFSSL_TRUST_PEER_CERT
     word16 haveTrustPeer:1; /* was cert verified by loaded trusted peer cert */
 #endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+    word16 chainHashSet:1;  /* chainHash is set, chain cache callback in use */
+    word16 chainCached:1;   /* chain verified before, skip signature checks */
+    word16 chainFailed:1;   /* a check failed, even if overridden by callback */
+#endif
 } ProcPeerCertArgs;
 WOLFSSL_LOCAL int DoVerifyCallback(WOLFSSL_CERT_MANAGER* cm, WOLFSSL* ssl,
         int ret, ProcPeerCertArgs* args);
@@ -2888,9 +2936,12 @@ struct WOLFSSL_CTX {
 #if defined(OPENSSL_EXTRA) || defined(HAVE_WEBSERVER) || defined(WOLFSSL_WPAS_SMALL)
     WOLFSSL_X509_STORE x509_store; /* points to ctx->cm */
     WOLFSSL_X509_STORE* x509_store_pt; /* take ownership of external store */
-    byte            readAhead;
     void*           userPRFArg; /* passed to prf callback */
 #endif
+#if defined(OPENSSL_EXTRA) || defined(HAVE_WEBSERVER) || \
+    defined(WOLFSSL_WPAS_SMALL) || defined(WOLFSSL_READ_AHEAD)
+    byte            readAhead;
+#endif
 #ifdef HAVE_EX_DATA
     WOLFSSL_CRYPTO_EX_DATA ex_data;
 #endif
@@ -3382,6 +3433,9 @@ enum AcceptStateTls13 {
 /* buffers for struct WOLFSSL */
 typedef struct Buffers {
     bufferStatic    inputBuffer;
+#ifdef WOLFSSL_READ_AHEAD
+    word32          inputAhead;            /* read past inputBuffer.length */
+#endif
     bufferStatic    outputBuffer;
     buffer          domainName;            /* for client check */
     buffer          clearOutputBuffer;
@@ -4104,8 +4158,10 @@ struct WOLFSSL {
 #if defined(OPENSSL_EXTRA) || defined(OPENSSL_EXTRA_X509_SMALL)
     unsigned long    peerVerifyRet;
 #endif
+#if defined(OPENSSL_EXTRA) || defined(WOLFSSL_READ_AHEAD)
+    byte             readAhead;          /* fill the input buffer on reads */
+#endif
 #ifdef OPENSSL_EXTRA
-    byte             readAhead;
     byte             sessionCtxSz;       /* size of sessionCtx stored */
 #ifdef HAVE_PK_CALLBACKS
     void*            loggingCtx;         /* logging callback argument */
@@ -4365,6 +4421,7 @@ struct WOLFSSL {
 #ifdef WOLFSSL_EARLY_DATA
     EarlyDataState earlyData;
     word32 earlyDataSz;
+    byte   earlyDataStatus;     /* WOLFSSL_EARLY_DATA_* seen by the client */
 #endif
 #ifdef OPENSSL_ALL
     long verifyCallbackResult;
@@ -62,6 +62,13 @@ WOLFSSL_LOCAL int  CheckOcspRequest(WOLFSSL_OCSP* ocsp,
 WOLFSSL_LOCAL int CheckOcspResponse(WOLFSSL_OCSP *ocsp, byte *response, int responseSz,
                                     WOLFSSL_BUFFER_INFO *responseBuffer, CertStatus *status,
                                     OcspEntry *entry, OcspRequest *ocspRequest);
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
+ || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+WOLFSSL_LOCAL int  CheckOcspCache(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest,
+                                  const byte* stapleHash);
+WOLFSSL_LOCAL int  CacheOcspStatus(WOLFSSL_OCSP* ocsp, OcspRequest* ocspRequest,
+                                   CertStatus* status, const byte* stapleHash);
+#endif
 
 #if defined(OPENSSL_ALL) || defined(WOLFSSL_NGINX) || defined(WOLFSSL_HAPROXY) || \
     defined(WOLFSSL_APACHE_HTTPD) || defined(HAVE_LIGHTY)
@@ -943,6 +943,13 @@ WOLFSSL_API int  wolfSSL_write_early_data(WOLFSSL* ssl, const void* data,
                                           int sz, int* outSz);
 WOLFSSL_API int  wolfSSL_read_early_data(WOLFSSL* ssl, void* data, int sz,
                                          int* outSz);
+
+enum {
+    WOLFSSL_EARLY_DATA_NOT_SENT = 0,
+    WOLFSSL_EARLY_DATA_REJECTED = 1,
+    WOLFSSL_EARLY_DATA_ACCEPTED = 2
+};
+WOLFSSL_API int  wolfSSL_get_early_data_status(const WOLFSSL* ssl);
 #endif /* WOLFSSL_EARLY_DATA */
 #endif /* WOLFSSL_TLS13 */
 WOLFSSL_ABI WOLFSSL_API void wolfSSL_CTX_free(WOLFSSL_CTX*);
@@ -1655,6 +1662,8 @@ WOLFSSL_API long wolfSSL_CTX_sess_get_cache_size(WOLFSSL_CTX*);
 WOLFSSL_API long wolfSSL_CTX_get_session_cache_mode(WOLFSSL_CTX*);
 WOLFSSL_API int  wolfSSL_CTX_get_read_ahead(WOLFSSL_CTX*);
 WOLFSSL_API int  wolfSSL_CTX_set_read_ahead(WOLFSSL_CTX*, int v);
+WOLFSSL_API int  wolfSSL_get_read_ahead(const WOLFSSL*);
+WOLFSSL_API int  wolfSSL_set_read_ahead(WOLFSSL*, int v);
 WOLFSSL_API long wolfSSL_CTX_set_tlsext_status_arg(WOLFSSL_CTX*, void* arg);
 WOLFSSL_API long wolfSSL_CTX_set_tlsext_opaque_prf_input_callback_arg(
         WOLFSSL_CTX*, void* arg);
@@ -2507,6 +2516,28 @@ WOLFSSL_API int wolfSSL_SetVersion(WOLFSSL* ssl, int version);
 
 typedef void (*CallbackCACache)(unsigned char* der, int sz, int type);
 typedef void (*CbMissingCRL)(const char* url);
+#ifdef WOLFSSL_MISSING_CA_CB
+/* CA lookup miss: hash is the subject key id hash or the subject name hash
+ * (hashType), ctx is the one registered with the callback.
+ * Return 1 if the CA was added to the certificate manager. */
+enum {
+    WOLFSSL_CA_HASH_KEYID = 0,
+    WOLFSSL_CA_HASH_NAME  = 1
+};
+typedef int  (*CbMissingCA)(const unsigned char* hash, int hashType,
+                                                                void* ctx);
+#endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+/* Verified peer chain cache: hash is the SHA-256 of the peer's DER chain.
+ * WOLFSSL_CHAIN_LOOKUP: return 1 if the chain was verified before, its
+ *     signatures are then not checked again.
+ * WOLFSSL_CHAIN_VERIFIED: the chain passed all the checks, remember it. */
+enum {
+    WOLFSSL_CHAIN_LOOKUP   = 0,
+    WOLFSSL_CHAIN_VERIFIED = 1
+};
+typedef int  (*CbVerifiedChain)(const unsigned char* hash, int op, void* ctx);
+#endif
 typedef int  (*CbOCSPIO)(void*, const char*, int,
                                          unsigned char*, int, unsigned char**);
 typedef void (*CbOCSPRespFree)(void*,unsigned char*);
@@ -2818,6 +2849,15 @@ WOLFSSL_API void* wolfSSL_GetRsaDecCtx(WOLFSSL* ssl);
 
 #ifndef NO_CERTS
     WOLFSSL_API void wolfSSL_CTX_SetCACb(WOLFSSL_CTX*, CallbackCACache);
+#ifdef WOLFSSL_MISSING_CA_CB
+    /* callback ctx is the WOLFSSL_CTX */
+    WOLFSSL_API int wolfSSL_CTX_SetMissingCA_Cb(WOLFSSL_CTX*, CbMissingCA);
+#endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+    /* callback ctx is the WOLFSSL_CTX */
+    WOLFSSL_API int wolfSSL_CTX_SetVerifiedChain_Cb(WOLFSSL_CTX*,
+                                                              CbVerifiedChain);
+#endif
 
     WOLFSSL_API WOLFSSL_CERT_MANAGER* wolfSSL_CTX_GetCertManager(WOLFSSL_CTX*);
 
@@ -2851,6 +2891,14 @@ WOLFSSL_API void* wolfSSL_GetRsaDecCtx(WOLFSSL* ssl);
                                             const unsigned char*, long sz, int);
     WOLFSSL_API int wolfSSL_CertManagerSetCRL_Cb(WOLFSSL_CERT_MANAGER*,
                                                                   CbMissingCRL);
+#ifdef WOLFSSL_MISSING_CA_CB
+    WOLFSSL_API int wolfSSL_CertManagerSetMissingCA_Cb(WOLFSSL_CERT_MANAGER*,
+                                                        CbMissingCA, void* ctx);
+#endif
+#ifdef WOLFSSL_VERIFIED_CHAIN_CB
+    WOLFSSL_API int wolfSSL_CertManagerSetVerifiedChain_Cb(
+                            WOLFSSL_CERT_MANAGER*, CbVerifiedChain, void* ctx);
+#endif
     WOLFSSL_API int wolfSSL_CertManagerFreeCRL(WOLFSSL_CERT_MANAGER *);
 #ifdef HAVE_CRL_IO
     WOLFSSL_API int wolfSSL_CertManagerSetCRL_IOCb(WOLFSSL_CERT_MANAGER*,
@@ -3923,6 +3971,7 @@ WOLFSSL_API void wolfSSL_ERR_load_BIO_strings(void);
 #endif
 
 #if defined(HAVE_OCSP) && !defined(NO_ASN_TIME)
+    /* empty when the stapled status was taken from the OCSP status cache */
     WOLFSSL_API int wolfSSL_get_ocsp_producedDate(
         WOLFSSL *ssl,
         byte *producedDate,
@@ -1369,6 +1369,11 @@ struct CertStatus {
 
     byte*  rawOcspResponse;
     word32 rawOcspResponseSz;
+#if defined(HAVE_CERTIFICATE_STATUS_REQUEST) \
+ || defined(HAVE_CERTIFICATE_STATUS_REQUEST_V2)
+    byte   stapleHash[WC_SHA256_DIGEST_SIZE]; /* SHA-256 of the stapled
+                                               * response, 0 if none */
+#endif
 };
 
 typedef struct OcspEntry OcspEntry;
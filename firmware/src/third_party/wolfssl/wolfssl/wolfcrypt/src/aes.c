@@ -1701,14 +1701,18 @@ static WC_INLINE word32 PreFetchSBox(void)
 #endif
 #endif
 
-/* Software AES - ECB Encrypt */
-static void wc_AesEncrypt(Aes* aes, const byte* inBlock, byte* outBlock)
+/* Software AES - ECB Encrypt
+ * preFetch: load the tables into the cache first */
+static void AesEncrypt_C(Aes* aes, const byte* inBlock, byte* outBlock,
+                         int preFetch)
 {
     word32 s0, s1, s2, s3;
     word32 t0, t1, t2, t3;
     word32 r = aes->rounds >> 1;
     const word32* rk = aes->key;
 
+    (void)preFetch;
+
 #ifdef DEBUG_WOLFSSL
     if (r > 7 || r == 0) {
         WOLFSSL_MSG("AesEncrypt encountered improper key, set it up");
@@ -1800,7 +1804,8 @@ static void wc_AesEncrypt(Aes* aes, const byte* inBlock, byte* outBlock)
 
 #ifndef WOLFSSL_AES_SMALL_TABLES
 #ifndef WC_NO_CACHE_RESISTANT
-    s0 |= PreFetchTe();
+    if (preFetch)
+        s0 |= PreFetchTe();
 #endif
 
 #ifndef WOLFSSL_AES_NO_UNROLL
@@ -1930,7 +1935,8 @@ static void wc_AesEncrypt(Aes* aes, const byte* inBlock, byte* outBlock)
         rk[3];
 #else
 #ifndef WC_NO_CACHE_RESISTANT
-    s0 |= PreFetchSBox();
+    if (preFetch)
+        s0 |= PreFetchSBox();
 #endif
 
     r *= 2;
@@ -2023,6 +2029,28 @@ static void wc_AesEncrypt(Aes* aes, const byte* inBlock, byte* outBlock)
     XMEMCPY(outBlock + 3 * sizeof(s0), &s3, sizeof(s3));
 
 }
+
+static void wc_AesEncrypt(Aes* aes, const byte* inBlock, byte* outBlock)
+{
+    AesEncrypt_C(aes, inBlock, outBlock, 1);
+}
+
+#if defined(HAVE_AESGCM) && defined(GCM_TABLE_4BIT)
+#define HAVE_AES_ENCRYPT_BLOCKS
+/* Software AES - encrypt consecutive blocks
+ * The tables are loaded into the cache once for all the blocks. */
+static void AesEncryptBlocks_C(Aes* aes, const byte* in, byte* out,
+                               word32 blocks)
+{
+    word32 i;
+
+    for (i = 0; i < blocks; i++) {
+        AesEncrypt_C(aes, in, out, i == 0);
+        in += AES_BLOCK_SIZE;
+        out += AES_BLOCK_SIZE;
+    }
+}
+#endif /* HAVE_AESGCM && GCM_TABLE_4BIT */
 #endif /* HAVE_AES_CBC || WOLFSSL_AES_DIRECT || HAVE_AESGCM */
 
 #if defined(HAVE_AES_DECRYPT)
@@ -6116,59 +6144,136 @@ static WC_INLINE void GMULT(byte *x, byte m[32][AES_BLOCK_SIZE])
 }
 #endif
 
-void GHASH(Aes* aes, const byte* a, word32 aSz, const byte* c,
-    word32 cSz, byte* s, word32 sSz)
+#if !defined(WC_NO_CACHE_RESISTANT) && defined(WC_CACHE_LINE_SZ)
+/* Load the key table and the remainder table into the cache by cache line
+ * stride, so the nibble indexed lookups of GMULT do not depend on what was
+ * cached before. */
+static WC_INLINE void PreFetchGcmM0(Aes* aes)
+{
+    const volatile byte* m = (const volatile byte*)aes->M0;
+    const volatile byte* r = (const volatile byte*)R;
+    word32 i;
+    byte x = 0;
+
+    for (i = 0; i < sizeof(aes->M0); i += WC_CACHE_LINE_SZ) {
+        x |= m[i];
+    }
+    for (i = 0; i < sizeof(R); i += WC_CACHE_LINE_SZ) {
+        x |= r[i];
+    }
+    (void)x;
+}
+#else
+    #define PreFetchGcmM0(aes)
+#endif
+
+/* Hash in data: x = (x ^ block) * H for each block.
+ * A partial last block is padded with zeros. */
+static void GHASH_Update(Aes* aes, byte* x, const byte* data, word32 sz)
 {
-    byte x[AES_BLOCK_SIZE];
     byte scratch[AES_BLOCK_SIZE];
-    word32 blocks, partial;
 
-    XMEMSET(x, 0, AES_BLOCK_SIZE);
+    if (sz == 0 || data == NULL)
+        return;
 
-    /* Hash in A, the Additional Authentication Data */
-    if (aSz != 0 && a != NULL) {
-        blocks = aSz / AES_BLOCK_SIZE;
-        partial = aSz % AES_BLOCK_SIZE;
-        while (blocks--) {
-            xorbuf(x, a, AES_BLOCK_SIZE);
-            GMULT(x, aes->M0);
-            a += AES_BLOCK_SIZE;
-        }
-        if (partial != 0) {
-            XMEMSET(scratch, 0, AES_BLOCK_SIZE);
-            XMEMCPY(scratch, a, partial);
-            xorbuf(x, scratch, AES_BLOCK_SIZE);
-            GMULT(x, aes->M0);
-        }
+    PreFetchGcmM0(aes);
+    while (sz >= AES_BLOCK_SIZE) {
+        xorbuf(x, data, AES_BLOCK_SIZE);
+        GMULT(x, aes->M0);
+        data += AES_BLOCK_SIZE;
+        sz -= AES_BLOCK_SIZE;
     }
-
-    /* Hash in C, the Ciphertext */
-    if (cSz != 0 && c != NULL) {
-        blocks = cSz / AES_BLOCK_SIZE;
-        partial = cSz % AES_BLOCK_SIZE;
-        while (blocks--) {
-            xorbuf(x, c, AES_BLOCK_SIZE);
-            GMULT(x, aes->M0);
-            c += AES_BLOCK_SIZE;
-        }
-        if (partial != 0) {
-            XMEMSET(scratch, 0, AES_BLOCK_SIZE);
-            XMEMCPY(scratch, c, partial);
-            xorbuf(x, scratch, AES_BLOCK_SIZE);
-            GMULT(x, aes->M0);
-        }
+    if (sz != 0) {
+        XMEMSET(scratch, 0, AES_BLOCK_SIZE);
+        XMEMCPY(scratch, data, sz);
+        xorbuf(x, scratch, AES_BLOCK_SIZE);
+        GMULT(x, aes->M0);
     }
+}
+
+/* Hash in the lengths of A and C in bits */
+static void GHASH_Final(Aes* aes, byte* x, word32 aSz, word32 cSz)
+{
+    byte scratch[AES_BLOCK_SIZE];
 
-    /* Hash in the lengths of A and C in bits */
     FlattenSzInBits(&scratch[0], aSz);
     FlattenSzInBits(&scratch[8], cSz);
     xorbuf(x, scratch, AES_BLOCK_SIZE);
+    PreFetchGcmM0(aes);
     GMULT(x, aes->M0);
+}
+
+void GHASH(Aes* aes, const byte* a, word32 aSz, const byte* c,
+    word32 cSz, byte* s, word32 sSz)
+{
+    ALIGN16 byte x[AES_BLOCK_SIZE];
+
+    XMEMSET(x, 0, AES_BLOCK_SIZE);
+
+    /* Hash in A, the Additional Authentication Data */
+    GHASH_Update(aes, x, a, aSz);
+    /* Hash in C, the Ciphertext */
+    GHASH_Update(aes, x, c, cSz);
+    GHASH_Final(aes, x, aSz, cSz);
 
     /* Copy the result into s. */
     XMEMCPY(s, x, sSz);
 }
 
+#if defined(HAVE_AES_ENCRYPT_BLOCKS) && !defined(WOLFSSL_PIC32MZ_CRYPT)
+#define HAVE_AES_GCM_CTR_GHASH
+
+#ifndef GCM_CTR_BLOCKS
+    #define GCM_CTR_BLOCKS  4
+#endif
+
+/* CTR encrypt or decrypt and GHASH the ciphertext in one pass.
+ * GCM_CTR_BLOCKS counter blocks are encrypted at a time and the ciphertext
+ * is hashed while it is still in the cache.
+ *
+ * counter  Initial counter block, J0.
+ * x        GHASH of the AAD and ciphertext; the tag before E(K, J0).
+ * enc      1 to encrypt in, 0 to decrypt it.
+ */
+static void AesGcmCtrGhash_C(Aes* aes, byte* out, const byte* in, word32 sz,
+                             const byte* counter, const byte* authIn,
+                             word32 authInSz, byte* x, int enc)
+{
+    ALIGN32 byte ctr[AES_BLOCK_SIZE];
+    ALIGN32 byte keyStream[GCM_CTR_BLOCKS * AES_BLOCK_SIZE];
+    word32 i, n, chunk;
+    word32 left = sz;
+
+    XMEMCPY(ctr, counter, AES_BLOCK_SIZE);
+    XMEMSET(x, 0, AES_BLOCK_SIZE);
+    GHASH_Update(aes, x, authIn, authInSz);
+
+    while (left > 0) {
+        chunk = (left < sizeof(keyStream)) ? left : sizeof(keyStream);
+        n = (chunk + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+        for (i = 0; i < n; i++) {
+            IncrementGcmCounter(ctr);
+            XMEMCPY(keyStream + i * AES_BLOCK_SIZE, ctr, AES_BLOCK_SIZE);
+        }
+        AesEncryptBlocks_C(aes, keyStream, keyStream, n);
+
+        /* hash the ciphertext before an in place decrypt overwrites it */
+        if (!enc)
+            GHASH_Update(aes, x, in, chunk);
+        xorbufout(out, keyStream, in, chunk);
+        if (enc)
+            GHASH_Update(aes, x, out, chunk);
+
+        in += chunk;
+        out += chunk;
+        left -= chunk;
+    }
+    GHASH_Final(aes, x, authInSz, sz);
+
+    ForceZero(keyStream, sizeof(keyStream));
+}
+#endif /* HAVE_AES_ENCRYPT_BLOCKS && !WOLFSSL_PIC32MZ_CRYPT */
+
 #elif defined(WORD64_AVAILABLE) && !defined(GCM_WORD32)
 
 #if !defined(FREESCALE_LTC_AES_GCM)
@@ -6783,6 +6888,16 @@ int AES_GCM_encrypt_C(Aes* aes, byte* out, const byte* in, word32 sz,
     }
     XMEMCPY(initialCounter, counter, AES_BLOCK_SIZE);
 
+#ifdef HAVE_AES_GCM_CTR_GHASH
+    if (authTag != NULL && sz > 0) {
+        AesGcmCtrGhash_C(aes, out, in, sz, initialCounter, authIn, authInSz,
+                         scratch, 1);
+        wc_AesEncrypt(aes, initialCounter, counter);
+        xorbufout(authTag, scratch, counter, authTagSz);
+        return ret;
+    }
+#endif
+
 #ifdef WOLFSSL_PIC32MZ_CRYPT
     if (blocks) {
         /* use initial IV for HW, but don't use it below */
@@ -7271,6 +7386,21 @@ int AES_GCM_decrypt_C(Aes* aes, byte* out, const byte* in, word32 sz,
 #endif
     }
 
+#ifdef HAVE_AES_GCM_CTR_GHASH
+    if (out != NULL && sz > 0) {
+        AesGcmCtrGhash_C(aes, out, in, sz, counter, authIn, authInSz, Tprime,
+                         0);
+        wc_AesEncrypt(aes, counter, EKY0);
+        xorbuf(Tprime, EKY0, sizeof(Tprime));
+        if (ConstantCompare(authTag, Tprime, authTagSz) != 0) {
+            /* do not hand out unauthenticated plaintext */
+            ForceZero(out, sz);
+            return AES_GCM_AUTH_E;
+        }
+        return ret;
+    }
+#endif
+
     /* Calc the authTag again using received auth data and the cipher text */
     GHASH(aes, authIn, authInSz, in, sz, Tprime, sizeof(Tprime));
     wc_AesEncrypt(aes, counter, EKY0);
@@ -104,6 +104,19 @@ Public domain.
   x[a] = PLUS(x[a],x[b]); x[d] = ROTATE(XOR(x[d],x[a]), 8); \
   x[c] = PLUS(x[c],x[d]); x[b] = ROTATE(XOR(x[b],x[c]), 7);
 
+/* Quarter round on local words so the state can stay in registers. */
+#define QUARTERROUND_L(a,b,c,d) \
+  a = PLUS(a,b); d = ROTATE(XOR(d,a),16); \
+  c = PLUS(c,d); b = ROTATE(XOR(b,c),12); \
+  a = PLUS(a,b); d = ROTATE(XOR(d,a), 8); \
+  c = PLUS(c,d); b = ROTATE(XOR(b,c), 7);
+
+/* Number of key stream blocks generated before XORing with the message.
+ * Blocks are XORed a word at a time when the buffers are aligned. */
+#ifndef CHACHA_MULTI_BLOCKS
+    #define CHACHA_MULTI_BLOCKS 4
+#endif
+
 
 /**
   * Set up iv(nonce). Earlier versions used 64 bits instead of 96, this version
@@ -202,33 +215,58 @@ int wc_Chacha_SetKey(ChaCha* ctx, const byte* key, word32 keySz)
 /**
   * Converts word into bytes with rotations having been done.
   */
-static WC_INLINE void wc_Chacha_wordtobyte(word32 output[CHACHA_CHUNK_WORDS],
+static void wc_Chacha_wordtobyte(word32 output[CHACHA_CHUNK_WORDS],
     const word32 input[CHACHA_CHUNK_WORDS])
 {
-    word32 x[CHACHA_CHUNK_WORDS];
+    word32 x0,  x1,  x2,  x3,  x4,  x5,  x6,  x7;
+    word32 x8,  x9,  x10, x11, x12, x13, x14, x15;
     word32 i;
 
-    for (i = 0; i < CHACHA_CHUNK_WORDS; i++) {
-        x[i] = input[i];
-    }
+    x0  = input[0];  x1  = input[1];  x2  = input[2];  x3  = input[3];
+    x4  = input[4];  x5  = input[5];  x6  = input[6];  x7  = input[7];
+    x8  = input[8];  x9  = input[9];  x10 = input[10]; x11 = input[11];
+    x12 = input[12]; x13 = input[13]; x14 = input[14]; x15 = input[15];
 
     for (i = (ROUNDS); i > 0; i -= 2) {
-        QUARTERROUND(0, 4,  8, 12)
-        QUARTERROUND(1, 5,  9, 13)
-        QUARTERROUND(2, 6, 10, 14)
-        QUARTERROUND(3, 7, 11, 15)
-        QUARTERROUND(0, 5, 10, 15)
-        QUARTERROUND(1, 6, 11, 12)
-        QUARTERROUND(2, 7,  8, 13)
-        QUARTERROUND(3, 4,  9, 14)
+        QUARTERROUND_L(x0, x4,  x8, x12)
+        QUARTERROUND_L(x1, x5,  x9, x13)
+        QUARTERROUND_L(x2, x6, x10, x14)
+        QUARTERROUND_L(x3, x7, x11, x15)
+        QUARTERROUND_L(x0, x5, x10, x15)
+        QUARTERROUND_L(x1, x6, x11, x12)
+        QUARTERROUND_L(x2, x7,  x8, x13)
+        QUARTERROUND_L(x3, x4,  x9, x14)
     }
 
-    for (i = 0; i < CHACHA_CHUNK_WORDS; i++) {
-        x[i] = PLUS(x[i], input[i]);
-    }
+    output[0]  = LITTLE32(PLUS(x0,  input[0]));
+    output[1]  = LITTLE32(PLUS(x1,  input[1]));
+    output[2]  = LITTLE32(PLUS(x2,  input[2]));
+    output[3]  = LITTLE32(PLUS(x3,  input[3]));
+    output[4]  = LITTLE32(PLUS(x4,  input[4]));
+    output[5]  = LITTLE32(PLUS(x5,  input[5]));
+    output[6]  = LITTLE32(PLUS(x6,  input[6]));
+    output[7]  = LITTLE32(PLUS(x7,  input[7]));
+    output[8]  = LITTLE32(PLUS(x8,  input[8]));
+    output[9]  = LITTLE32(PLUS(x9,  input[9]));
+    output[10] = LITTLE32(PLUS(x10, input[10]));
+    output[11] = LITTLE32(PLUS(x11, input[11]));
+    output[12] = LITTLE32(PLUS(x12, input[12]));
+    output[13] = LITTLE32(PLUS(x13, input[13]));
+    output[14] = LITTLE32(PLUS(x14, input[14]));
+    output[15] = LITTLE32(PLUS(x15, input[15]));
+}
 
-    for (i = 0; i < CHACHA_CHUNK_WORDS; i++) {
-        output[i] = LITTLE32(x[i]);
+/**
+  * Generates blocks of key stream, advancing the block counter for each.
+  */
+static WC_INLINE void wc_Chacha_wordtobyte_blocks(word32* output,
+    word32 input[CHACHA_CHUNK_WORDS], word32 blocks)
+{
+    word32 i;
+
+    for (i = 0; i < blocks; i++) {
+        wc_Chacha_wordtobyte(output + i * CHACHA_CHUNK_WORDS, input);
+        input[CHACHA_MATRIX_CNT_IV] = PLUSONE(input[CHACHA_MATRIX_CNT_IV]);
     }
 }
 
@@ -335,8 +373,10 @@ static void wc_Chacha_encrypt_bytes(ChaCha* ctx, const byte* m, byte* c,
                                     word32 bytes)
 {
     byte*  output;
-    word32 temp[CHACHA_CHUNK_WORDS]; /* used to make sure aligned */
+    /* used to make sure aligned */
+    word32 temp[CHACHA_MULTI_BLOCKS * CHACHA_CHUNK_WORDS];
     word32 i;
+    word32 blocks;
 
     /* handle left overs */
     if (bytes > 0 && ctx->left > 0) {
@@ -359,14 +399,15 @@ static void wc_Chacha_encrypt_bytes(ChaCha* ctx, const byte* m, byte* c,
 
     output = (byte*)temp;
     while (bytes >= CHACHA_CHUNK_BYTES) {
-        wc_Chacha_wordtobyte(temp, ctx->X);
-        ctx->X[CHACHA_MATRIX_CNT_IV] = PLUSONE(ctx->X[CHACHA_MATRIX_CNT_IV]);
-        for (i = 0; i < CHACHA_CHUNK_BYTES; ++i) {
-            c[i] = (byte)(m[i] ^ output[i]);
+        blocks = bytes / CHACHA_CHUNK_BYTES;
+        if (blocks > CHACHA_MULTI_BLOCKS) {
+            blocks = CHACHA_MULTI_BLOCKS;
         }
-        bytes -= CHACHA_CHUNK_BYTES;
-        c += CHACHA_CHUNK_BYTES;
-        m += CHACHA_CHUNK_BYTES;
+        wc_Chacha_wordtobyte_blocks(temp, ctx->X, blocks);
+        xorbufout(c, m, output, blocks * CHACHA_CHUNK_BYTES);
+        bytes -= blocks * CHACHA_CHUNK_BYTES;
+        c += blocks * CHACHA_CHUNK_BYTES;
+        m += blocks * CHACHA_CHUNK_BYTES;
     }
 
     if (bytes) {
@@ -379,6 +420,8 @@ static void wc_Chacha_encrypt_bytes(ChaCha* ctx, const byte* m, byte* c,
         }
         ctx->left = CHACHA_CHUNK_BYTES - i;
     }
+
+    ForceZero(temp, sizeof(temp));
 }
 
 /**
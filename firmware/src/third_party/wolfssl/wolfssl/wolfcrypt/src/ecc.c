@@ -51,6 +51,8 @@ Possible ECC enable options:
  * ECC_CACHE_CURVE:     Enables cache of curve info to improve performance
                                                                 default: off
  * FP_ECC:              ECC Fixed Point Cache                   default: off
+ * WOLFSSL_ECC_P256_COMB: Constant comb table for P-256 key gen  default: off
+                        Not used with ECC_TIMING_RESISTANT or SP P-256
  * USE_ECC_B_PARAM:     Enable ECC curve B param                default: off
                          (on for HAVE_COMP_KEY)
  * WOLFSSL_ECC_CURVE_STATIC:                                    default off (on for windows)
@@ -4245,6 +4247,517 @@ int wc_ecc_gen_k(WC_RNG* rng, int size, mp_int* k, mp_int* order)
 #endif /* !WC_NO_RNG */
 }
 
+#if defined(WOLFSSL_ECC_P256_COMB) && !defined(WOLFSSL_SP_MATH) && \
+    (!defined(WOLFSSL_HAVE_SP_ECC) || defined(WOLFSSL_SP_NO_256)) && \
+    !defined(ECC_TIMING_RESISTANT) && !defined(WOLFSSL_ATECC508A) && \
+    !defined(WOLFSSL_ATECC608A) && !defined(WOLFSSL_SILABS_SE_ACCEL)
+#define HAVE_ECC_P256_COMB
+
+/* Fixed base comb for the P-256 generator G.
+ * The scalar bits c, c + SPACING, ..., c + (TEETH - 1) * SPACING select
+ *   T[j] = sum(j_i * 2^(SPACING * i) * G), i = 0..TEETH-1
+ * so k * G takes SPACING doublings and at most SPACING additions of an
+ * affine point, instead of treating G as an arbitrary point.
+ * Entry j - 1 holds T[j] as affine x, y in Montgomery form
+ * (x * 2^256 mod p), big endian.
+ * The table index depends on the scalar: this is not timing resistant.
+ */
+#define ECC_P256_COMB_TEETH     6
+#define ECC_P256_COMB_SPACING   43  /* ceil(256 / ECC_P256_COMB_TEETH) */
+
+static const byte ecc_p256_comb[(1 << ECC_P256_COMB_TEETH) - 1][2][32] = {
+    { /* 1 */
+      {
+        0x18, 0x90, 0x5f, 0x76, 0xa5, 0x37, 0x55, 0xc6, 0x79, 0xfb, 0x73, 0x2b, 0x77, 0x62, 0x25, 0x10,
+        0x75, 0xba, 0x95, 0xfc, 0x5f, 0xed, 0xb6, 0x01, 0x79, 0xe7, 0x30, 0xd4, 0x18, 0xa9, 0x14, 0x3c },
+      {
+        0x85, 0x71, 0xff, 0x18, 0x25, 0x88, 0x5d, 0x85, 0xd2, 0xe8, 0x86, 0x88, 0xdd, 0x21, 0xf3, 0x25,
+        0x8b, 0x4a, 0xb8, 0xe4, 0xba, 0x19, 0xe4, 0x5c, 0xdd, 0xf2, 0x53, 0x57, 0xce, 0x95, 0x56, 0x0a } },
+    { /* 2 */
+      {
+        0x73, 0x2c, 0xaa, 0x2f, 0xfa, 0x0a, 0x28, 0x93, 0xf3, 0x74, 0x49, 0x34, 0x16, 0x92, 0x36, 0x84,
+        0xf0, 0x84, 0x3d, 0x9e, 0xa1, 0x42, 0xc9, 0x6c, 0x89, 0x10, 0x50, 0x79, 0x03, 0x60, 0x5c, 0x39 },
+      {
+        0xe2, 0xe9, 0x42, 0x39, 0x9e, 0x2b, 0x2e, 0x07, 0x39, 0xcd, 0x81, 0x8e, 0xa6, 0xed, 0xa3, 0xac,
+        0xc3, 0x27, 0x88, 0xcc, 0x43, 0x7f, 0xba, 0xa3, 0xb2, 0xe8, 0xc2, 0x70, 0x61, 0x16, 0x01, 0x70 } },
+    { /* 3 */
+      {
+        0xd0, 0xed, 0x73, 0xdc, 0xa6, 0x07, 0xde, 0x84, 0xd1, 0x6d, 0xbd, 0x02, 0x57, 0x20, 0xf5, 0x0a,
+        0x61, 0x0e, 0x3d, 0x4d, 0xcb, 0x55, 0xb9, 0xca, 0xb9, 0xc0, 0xd2, 0x76, 0xab, 0xc3, 0xe1, 0x90 },
+      {
+        0x61, 0xc7, 0x19, 0x75, 0x85, 0x36, 0x35, 0xd5, 0xdb, 0x60, 0x6a, 0x97, 0x63, 0x47, 0x0a, 0x5e,
+        0x69, 0x8e, 0x12, 0xc0, 0x57, 0x77, 0x18, 0x43, 0x3b, 0xbd, 0xe5, 0xbf, 0x49, 0x21, 0x9f, 0xb5 } },
+    { /* 4 */
+      {
+        0x1b, 0x6c, 0x2d, 0x46, 0x09, 0xe2, 0x76, 0x20, 0xde, 0xe9, 0x5d, 0x8e, 0x69, 0x44, 0x5d, 0x52,
+        0x99, 0x5f, 0x27, 0x14, 0xef, 0xb6, 0x6e, 0x5a, 0xeb, 0x5d, 0xdc, 0xb6, 0xec, 0x7f, 0xae, 0x9f },
+      {
+        0x16, 0x2c, 0x42, 0x9f, 0xfb, 0xa5, 0xcd, 0xf6, 0x8c, 0x46, 0x8e, 0xf9, 0x1a, 0xf4, 0xaf, 0x63,
+        0xb0, 0x39, 0x09, 0xf1, 0x09, 0x58, 0xc1, 0xaa, 0x32, 0x62, 0x1c, 0x31, 0x81, 0x29, 0xd7, 0x16 } },
+    { /* 5 */
+      {
+        0xda, 0x59, 0xad, 0x0d, 0xc7, 0x0d, 0xed, 0xbc, 0x33, 0x6b, 0xcc, 0x89, 0x6f, 0x1f, 0xca, 0x13,
+        0x1f, 0x08, 0x80, 0xb0, 0xe1, 0xf4, 0xe3, 0x02, 0x46, 0x15, 0xd9, 0x12, 0xc1, 0xd8, 0x5f, 0x12 },
+      {
+        0x2a, 0xef, 0xd9, 0x5a, 0xdd, 0xc8, 0x4f, 0x79, 0xa3, 0xb1, 0xc2, 0xf2, 0x60, 0x32, 0x1b, 0xbb,
+        0xba, 0xed, 0x81, 0xcd, 0xf4, 0x99, 0x0c, 0xfd, 0x38, 0x97, 0xef, 0xae, 0xb0, 0xf6, 0x2e, 0xce } },
+    { /* 6 */
+      {
+        0x21, 0xcc, 0xfb, 0xb4, 0x6f, 0x5c, 0x8e, 0x02, 0x00, 0x06, 0xe4, 0xe0, 0x6a, 0xb7, 0x2b, 0x31,
+        0x43, 0xd4, 0x0d, 0xa0, 0x43, 0x7f, 0xe6, 0x29, 0x2d, 0x42, 0x7e, 0x3c, 0xee, 0x9e, 0x92, 0xe6 },
+      {
+        0x86, 0xee, 0x0e, 0x68, 0x40, 0x59, 0xcc, 0x6e, 0xfd, 0x84, 0xa2, 0x64, 0x45, 0xe8, 0xad, 0x41,
+        0x5d, 0x72, 0xd2, 0x01, 0xe2, 0x09, 0xd5, 0x91, 0x53, 0xa2, 0xf1, 0xa7, 0x53, 0xe8, 0x21, 0xec } },
+    { /* 7 */
+      {
+        0xfc, 0xe4, 0x8b, 0x99, 0xf8, 0xf5, 0x62, 0xcb, 0x78, 0x80, 0x7b, 0xeb, 0x29, 0xd4, 0x1f, 0xd1,
+        0x32, 0xd4, 0xbf, 0x82, 0x7f, 0x49, 0xf3, 0x3d, 0x3d, 0x82, 0x42, 0xd0, 0x92, 0x48, 0xfc, 0xe2 },
+      {
+        0xc5, 0xd6, 0xf3, 0xbb, 0xef, 0x23, 0xe9, 0xc9, 0xc1, 0xaa, 0x82, 0x84, 0x47, 0x2e, 0x5e, 0xd3,
+        0x1b, 0x48, 0x2c, 0x10, 0xa3, 0x70, 0x59, 0xad, 0x72, 0xa7, 0xd4, 0x84, 0x9f, 0x38, 0xf0, 0x97 } },
+    { /* 8 */
+      {
+        0x56, 0x17, 0xff, 0x6b, 0x62, 0x78, 0xa0, 0x5d, 0x9b, 0x69, 0x1b, 0xbe, 0xbc, 0xfb, 0x48, 0x53,
+        0x17, 0xeb, 0xfe, 0xd1, 0xf5, 0x2c, 0xa5, 0x3f, 0x23, 0xf9, 0x49, 0xfe, 0xb8, 0xa2, 0x4a, 0x20 },
+      {
+        0xb9, 0x67, 0xce, 0x0e, 0xee, 0x27, 0xc0, 0x11, 0x42, 0x06, 0x48, 0x2f, 0x69, 0x5d, 0x67, 0xdf,
+        0xfc, 0x64, 0x24, 0x2e, 0x17, 0x84, 0x15, 0x6a, 0x24, 0x1b, 0x34, 0xc5, 0xe3, 0xc9, 0x9e, 0xbd } },
+    { /* 9 */
+      {
+        0x55, 0x78, 0x43, 0x3b, 0x9f, 0xe9, 0xe4, 0x75, 0xbb, 0x5f, 0x98, 0xb2, 0xc4, 0xec, 0x87, 0x3d,
+        0x0c, 0x67, 0x82, 0xc7, 0xc3, 0x4c, 0x6f, 0xb2, 0x56, 0x9a, 0xac, 0xdf, 0x9f, 0xc3, 0xdf, 0x19 },
+      {
+        0xcb, 0xc4, 0xdf, 0xe3, 0x54, 0x02, 0xea, 0x12, 0x40, 0x22, 0xc4, 0x8e, 0x07, 0x12, 0x7b, 0x8e,
+        0xb8, 0xef, 0x65, 0x8d, 0x39, 0x58, 0x95, 0x01, 0xfa, 0x14, 0xf3, 0x86, 0x9c, 0xa8, 0x48, 0x21 } },
+    { /* 10 */
+      {
+        0xa0, 0xe2, 0xc6, 0x71, 0x3a, 0x62, 0x16, 0xc5, 0x96, 0x6b, 0x26, 0x76, 0xef, 0xee, 0xcd, 0xee,
+        0xf1, 0xe1, 0xa4, 0xc4, 0xcf, 0xbc, 0x45, 0xa3, 0x09, 0x2e, 0xf9, 0x6a, 0x2a, 0xd4, 0x08, 0xa3 },
+      {
+        0x3d, 0x8e, 0x9a, 0x72, 0xe9, 0x1f, 0x8f, 0xf7, 0xb8, 0xc6, 0x12, 0xbd, 0x25, 0x9d, 0xe5, 0x47,
+        0x56, 0xd9, 0x9a, 0x11, 0xd8, 0x30, 0xdf, 0xc7, 0xcd, 0x6e, 0x22, 0xa2, 0x92, 0xc4, 0xbf, 0x61 } },
+    { /* 11 */
+      {
+        0x2f, 0x2d, 0x32, 0xd6, 0xcc, 0xc5, 0x5d, 0x7d, 0xbd, 0x22, 0xa4, 0x44, 0xb9, 0xa5, 0x9e, 0x72,
+        0x6b, 0xe3, 0x20, 0xd2, 0xa6, 0x54, 0x57, 0x66, 0x0b, 0x88, 0x5e, 0x96, 0x23, 0x52, 0xb4, 0xff },
+      {
+        0x58, 0xc5, 0x92, 0x7c, 0x74, 0x65, 0x17, 0xf7, 0x54, 0x2a, 0xde, 0x06, 0x9c, 0xa9, 0x7e, 0x28,
+        0x19, 0xcd, 0xb0, 0xe9, 0x7a, 0x25, 0xc9, 0x34, 0xd8, 0x6e, 0x4c, 0x4c, 0xdd, 0xce, 0xc7, 0x0b } },
+    { /* 12 */
+      {
+        0x35, 0x63, 0x11, 0x28, 0x95, 0x58, 0x92, 0x12, 0xc3, 0xe1, 0xcb, 0x4c, 0xcc, 0x2a, 0x21, 0x34,
+        0x6a, 0xa2, 0xc2, 0xef, 0x51, 0xad, 0xd8, 0xde, 0x24, 0xab, 0xb0, 0xf0, 0x8d, 0x08, 0x70, 0x91 },
+      {
+        0x75, 0xc1, 0x50, 0xd2, 0x28, 0x52, 0x40, 0x5a, 0xd6, 0x05, 0x7d, 0x8a, 0x08, 0xec, 0x92, 0x66,
+        0xbc, 0xb6, 0xf7, 0xb2, 0xf8, 0xa1, 0x42, 0xcc, 0x3b, 0xf1, 0x7d, 0x2a, 0x79, 0x84, 0x34, 0x4b } },
+    { /* 13 */
+      {
+        0x25, 0x56, 0x28, 0x85, 0x96, 0x76, 0x9f, 0x9e, 0x67, 0x1f, 0xa0, 0xad, 0xe2, 0x69, 0x2e, 0x7d,
+        0x72, 0xa8, 0x41, 0x74, 0x57, 0x6e, 0xa3, 0x9b, 0xa8, 0xf8, 0x8e, 0xb5, 0xa9, 0xfe, 0xe7, 0x3e },
+      {
+        0x2c, 0xf4, 0x54, 0xb7, 0x16, 0x4a, 0xfb, 0x0f, 0x2e, 0x7c, 0x56, 0x3f, 0xcf, 0xae, 0x26, 0x90,
+        0x74, 0xb6, 0x1c, 0x18, 0xff, 0xf6, 0xc8, 0x9a, 0x25, 0x43, 0x23, 0xbc, 0xe8, 0x50, 0xa6, 0xb0 } },
+    { /* 14 */
+      {
+        0x74, 0x95, 0x3c, 0x1e, 0xae, 0x3d, 0x17, 0x5f, 0x56, 0xc5, 0x99, 0x19, 0x41, 0xc4, 0x81, 0x22,
+        0x59, 0xa1, 0xf1, 0xff, 0xf2, 0xb8, 0x5d, 0xf4, 0xe3, 0x12, 0xa5, 0x61, 0x8f, 0x10, 0xf4, 0x23 },
+      {
+        0x11, 0x43, 0x30, 0x1a, 0xae, 0x93, 0xc7, 0x19, 0xdd, 0x28, 0x29, 0x85, 0xdf, 0x1c, 0x17, 0x87,
+        0xc4, 0x86, 0xbc, 0x00, 0x71, 0x9a, 0x4c, 0xc1, 0x4d, 0x76, 0x7f, 0xc7, 0x88, 0x59, 0x24, 0x4c } },
+    { /* 15 */
+      {
+        0xa5, 0x04, 0x5b, 0xa5, 0xc4, 0x67, 0x84, 0x32, 0x20, 0x29, 0x55, 0xd3, 0xdc, 0xb3, 0x87, 0xee,
+        0x65, 0x93, 0x1f, 0x54, 0x32, 0xcb, 0xbe, 0xe8, 0x72, 0x01, 0xa1, 0xd6, 0x1f, 0xab, 0x7d, 0x71 },
+      {
+        0x20, 0xa8, 0xf1, 0x59, 0xc3, 0xd7, 0xec, 0xe9, 0xfe, 0xe4, 0x71, 0x69, 0x35, 0x6a, 0x87, 0xc6,
+        0xdd, 0x25, 0xa7, 0xc6, 0xdf, 0xec, 0x0f, 0x67, 0xcf, 0xb5, 0xee, 0x87, 0xdc, 0xa8, 0x5f, 0xf6 } },
+    { /* 16 */
+      {
+        0x66, 0x5c, 0xa4, 0x9b, 0x90, 0xa7, 0xc1, 0x3f, 0x52, 0xef, 0xf7, 0x9b, 0x1c, 0xfc, 0x91, 0x73,
+        0x26, 0x43, 0x67, 0x2b, 0x9a, 0x2c, 0xd5, 0xe5, 0xe4, 0xac, 0x8b, 0x33, 0x07, 0x0d, 0x3a, 0xab },
+      {
+        0x35, 0x98, 0x6e, 0x7b, 0xf5, 0x6d, 0xa4, 0xd7, 0xae, 0x9e, 0xbb, 0xab, 0x3c, 0xf9, 0xa5, 0x30,
+        0x8a, 0x5b, 0x92, 0x2d, 0x05, 0x2f, 0x13, 0x41, 0x5a, 0x8d, 0xda, 0x59, 0xb3, 0xef, 0xb9, 0x98 } },
+    { /* 17 */
+      {
+        0x73, 0xa6, 0x37, 0x95, 0x2f, 0x83, 0x7f, 0x32, 0x36, 0x06, 0x82, 0xc0, 0xe4, 0x0e, 0x81, 0x25,
+        0xec, 0xfd, 0xb3, 0xa2, 0x98, 0x9a, 0x01, 0x82, 0x21, 0xe0, 0x7f, 0x9a, 0xbc, 0x0a, 0x70, 0xc0 },
+      {
+        0xb7, 0x1e, 0xf4, 0xef, 0x34, 0xe2, 0x2a, 0xb1, 0xf9, 0x35, 0x21, 0x23, 0xaf, 0x3d, 0x5d, 0x7e,
+        0xef, 0xb9, 0x7f, 0xec, 0xeb, 0xf4, 0xc7, 0xa5, 0xf4, 0xeb, 0x8c, 0xef, 0x9c, 0x0d, 0x32, 0x6b } },
+    { /* 18 */
+      {
+        0x82, 0x46, 0x1a, 0x26, 0xcd, 0x0f, 0xf9, 0x39, 0xa7, 0xac, 0xdc, 0xfc, 0xb6, 0xd2, 0x15, 0xac,
+        0x16, 0x76, 0xdf, 0x99, 0x71, 0xf0, 0xb9, 0x2e, 0xd6, 0xbd, 0x0d, 0x81, 0x0d, 0x48, 0x80, 0x32 },
+      {
+        0x12, 0xc2, 0xa1, 0x3f, 0x39, 0xbb, 0x0a, 0xa6, 0x10, 0xd7, 0x38, 0xaa, 0x05, 0xce, 0xf3, 0x25,
+        0x18, 0xf3, 0xb6, 0xdd, 0xa9, 0x2f, 0x16, 0x22, 0x82, 0x71, 0x89, 0xc0, 0xb6, 0x35, 0xd2, 0xe5 } },
+    { /* 19 */
+      {
+        0xed, 0xec, 0x94, 0x7e, 0x7e, 0x3d, 0xe8, 0xee, 0x61, 0xc3, 0x39, 0x21, 0x07, 0xc0, 0x86, 0x23,
+        0xbc, 0xd9, 0x14, 0x4e, 0x34, 0xbd, 0x93, 0xe9, 0x5f, 0x94, 0xd8, 0xde, 0xb5, 0x0b, 0x4e, 0x82 },
+      {
+        0x22, 0x77, 0x88, 0x55, 0x0f, 0x28, 0xde, 0xe6, 0x4a, 0x61, 0x34, 0x62, 0xa5, 0xe7, 0x30, 0x9c,
+        0xc0, 0xc8, 0x85, 0xcd, 0x96, 0x69, 0x2a, 0x89, 0x9d, 0x2d, 0xa5, 0x1d, 0x2f, 0x21, 0xb2, 0x02 } },
+    { /* 20 */
+      {
+        0xb5, 0x9e, 0xa5, 0x45, 0x41, 0x2d, 0x3e, 0x1a, 0xd9, 0x6a, 0xf0, 0xda, 0xd0, 0xcc, 0x09, 0xf2,
+        0x63, 0x53, 0x4a, 0x4a, 0x42, 0xae, 0x26, 0x27, 0x1f, 0xf0, 0xbd, 0x52, 0x76, 0x95, 0x44, 0x7a },
+      {
+        0xbf, 0x3d, 0xfc, 0x85, 0x21, 0xb6, 0xd4, 0xee, 0xac, 0xbc, 0x29, 0xcc, 0xb2, 0x50, 0x89, 0xc4,
+        0xff, 0xee, 0xc3, 0x7c, 0x10, 0x47, 0x5d, 0xfd, 0xd1, 0x05, 0x18, 0xcf, 0x6a, 0x75, 0x90, 0x72 } },
+    { /* 21 */
+      {
+        0x19, 0x29, 0xcf, 0x60, 0x6d, 0x8e, 0x17, 0x6f, 0x2e, 0xd8, 0x08, 0x5a, 0x69, 0x55, 0xc2, 0x90,
+        0x00, 0x0f, 0xc8, 0xd4, 0x84, 0x1b, 0xe9, 0xed, 0x8f, 0x2e, 0xac, 0xfe, 0x49, 0x38, 0x89, 0x95 },
+      {
+        0x68, 0xfe, 0x61, 0x07, 0x8f, 0x61, 0x83, 0x2b, 0x13, 0xa8, 0x1b, 0x95, 0xb2, 0x6c, 0x6e, 0x05,
+        0x58, 0xd7, 0x67, 0xad, 0x6c, 0xb6, 0x26, 0xcd, 0x2e, 0xfd, 0x26, 0xa5, 0xfd, 0x1a, 0x09, 0xdb } },
+    { /* 22 */
+      {
+        0x11, 0x72, 0x21, 0xe8, 0x50, 0xbf, 0xd9, 0x21, 0x63, 0x8d, 0x12, 0x2b, 0x02, 0xac, 0xda, 0xbf,
+        0xcd, 0x55, 0x2f, 0xcb, 0x51, 0x01, 0x01, 0xa1, 0x4a, 0xd7, 0xde, 0x2e, 0x2d, 0x85, 0xc2, 0xf6 },
+      {
+        0x8a, 0xab, 0xf9, 0x8d, 0x31, 0x87, 0xc6, 0xf3, 0x03, 0x5e, 0xd7, 0xba, 0xa6, 0xf8, 0xa1, 0x81,
+        0xeb, 0xd0, 0x46, 0xd1, 0xba, 0x2f, 0x03, 0xa9, 0x08, 0x57, 0x1e, 0xe1, 0x99, 0xa9, 0x91, 0x29 } },
+    { /* 23 */
+      {
+        0xe8, 0x94, 0xd8, 0x4c, 0xf8, 0xd8, 0x0e, 0xdc, 0x37, 0xe8, 0x3a, 0xa0, 0xb1, 0x7c, 0x1e, 0x66,
+        0x8b, 0x0b, 0x8b, 0x89, 0x75, 0x61, 0xa6, 0x9c, 0xaf, 0x8e, 0x65, 0xca, 0xe3, 0xab, 0x5f, 0x4e },
+      {
+        0x4f, 0x79, 0x96, 0x82, 0xb1, 0x19, 0xae, 0x5e, 0x08, 0x29, 0x7f, 0xca, 0xe7, 0x37, 0x06, 0x73,
+        0xc7, 0xfa, 0x32, 0x4c, 0xa7, 0x23, 0x40, 0xef, 0xf1, 0xe4, 0x65, 0xe7, 0xce, 0x51, 0x4e, 0x22 } },
+    { /* 24 */
+      {
+        0xca, 0xc0, 0x69, 0xe9, 0x95, 0x9b, 0x68, 0xf1, 0x9a, 0x39, 0x66, 0x0d, 0x93, 0xf9, 0xa5, 0xb8,
+        0x56, 0x64, 0x0c, 0x8b, 0x7a, 0xb4, 0x4f, 0x55, 0x01, 0x4d, 0x6b, 0xd8, 0xf1, 0x80, 0xf2, 0x06 },
+      {
+        0xfe, 0xc6, 0x35, 0xe1, 0x76, 0x54, 0xd8, 0x05, 0xad, 0x57, 0x70, 0xf0, 0xd4, 0x39, 0xc7, 0x12,
+        0xb7, 0xe4, 0x5d, 0xfb, 0x3f, 0x94, 0x32, 0x91, 0x2b, 0xf6, 0xb6, 0x5e, 0x20, 0x8d, 0x99, 0x18 } },
+    { /* 25 */
+      {
+        0xb5, 0x87, 0x28, 0x4c, 0xa8, 0xa8, 0x83, 0xea, 0x2e, 0xde, 0x8e, 0x8f, 0xda, 0xfc, 0x51, 0xcd,
+        0xe4, 0xd5, 0x3d, 0x2f, 0x0b, 0x55, 0x58, 0xd4, 0x37, 0x22, 0x1c, 0xd1, 0x3f, 0x03, 0x1a, 0x88 },
+      {
+        0x09, 0xbe, 0x79, 0x03, 0x2c, 0x42, 0x9b, 0x30, 0x8a, 0xf5, 0x1f, 0xac, 0x6e, 0x10, 0xb9, 0x58,
+        0x5e, 0x5e, 0x18, 0xf9, 0x5c, 0x5e, 0x35, 0x28, 0xfa, 0x37, 0x67, 0x40, 0x44, 0xfa, 0x52, 0x51 } },
+    { /* 26 */
+      {
+        0xcb, 0x2f, 0x29, 0xd7, 0xa1, 0xaa, 0xde, 0x8b, 0xe8, 0x92, 0xc1, 0x0a, 0x4d, 0xb9, 0xcd, 0x5d,
+        0xac, 0xbb, 0xe3, 0x65, 0x7c, 0xfb, 0x81, 0x76, 0x7a, 0x46, 0x8b, 0xa4, 0x7f, 0x29, 0x93, 0x6d },
+      {
+        0x31, 0x31, 0x60, 0x4e, 0xb4, 0x83, 0x66, 0x23, 0x19, 0x9d, 0x89, 0xb8, 0x13, 0x6f, 0x29, 0xd2,
+        0x92, 0xa7, 0xf3, 0xec, 0x2a, 0xfe, 0x8f, 0x2e, 0x30, 0x87, 0xee, 0xf4, 0xef, 0xff, 0xcb, 0x14 } },
+    { /* 27 */
+      {
+        0x3c, 0xe3, 0xf5, 0xf9, 0x60, 0x31, 0xac, 0x99, 0x5d, 0xb8, 0xe6, 0xf7, 0x18, 0x77, 0xc7, 0xc7,
+        0x94, 0x31, 0x31, 0x86, 0x76, 0xa4, 0xab, 0xc0, 0xf5, 0xcc, 0xa5, 0xda, 0x31, 0xb5, 0xdf, 0x76 },
+      {
+        0x80, 0x08, 0xd0, 0x3b, 0x2e, 0x57, 0x70, 0xfa, 0x18, 0x28, 0x9c, 0xd0, 0x56, 0xb1, 0x6a, 0x49,
+        0x5e, 0xd6, 0xe8, 0x41, 0xd4, 0x24, 0xf1, 0x6a, 0x58, 0x59, 0x61, 0xd0, 0x7e, 0x7c, 0xef, 0x80 } },
+    { /* 28 */
+      {
+        0x7e, 0x00, 0xcc, 0x92, 0xc8, 0x6b, 0xf3, 0x0a, 0x2f, 0x2f, 0x55, 0xf1, 0xa6, 0xed, 0xd9, 0x71,
+        0x78, 0x3c, 0xea, 0x73, 0x85, 0x82, 0x57, 0x1c, 0xc8, 0xc2, 0xaf, 0x64, 0x25, 0x4e, 0x39, 0xde },
+      {
+        0xd1, 0x33, 0x0c, 0x20, 0xb8, 0xb4, 0xbf, 0xe4, 0x3b, 0xc3, 0x9a, 0x23, 0x29, 0x7f, 0xb2, 0x34,
+        0xb3, 0xeb, 0x75, 0x1c, 0xa5, 0xb1, 0x22, 0x60, 0xa0, 0xdb, 0x73, 0x54, 0x47, 0xd7, 0x49, 0x1f } },
+    { /* 29 */
+      {
+        0xdb, 0x2b, 0x1b, 0x62, 0xe2, 0x7e, 0xdd, 0xa4, 0x6f, 0x48, 0x0b, 0x6b, 0x5f, 0xec, 0x3a, 0xc7,
+        0x04, 0x70, 0x90, 0x96, 0x42, 0x2d, 0xea, 0x35, 0xfb, 0x77, 0x6a, 0xf0, 0x78, 0x24, 0xd5, 0x3a },
+      {
+        0xec, 0xc9, 0xd7, 0x9a, 0xa8, 0xab, 0x36, 0x8e, 0xf8, 0x80, 0x51, 0x77, 0x26, 0xa4, 0x73, 0x0a,
+        0x37, 0xef, 0x59, 0xb6, 0x91, 0xa1, 0x47, 0xf7, 0x0b, 0xba, 0x90, 0x4c, 0xda, 0x78, 0xb4, 0x94 } },
+    { /* 30 */
+      {
+        0xc9, 0x2b, 0xf8, 0x30, 0x16, 0x41, 0xab, 0x35, 0xf6, 0x45, 0x94, 0x7b, 0x8b, 0x17, 0x6e, 0xeb,
+        0xeb, 0xf7, 0xb6, 0x78, 0x00, 0xe2, 0x44, 0xe8, 0x62, 0x8e, 0x05, 0xc1, 0x85, 0xa4, 0xbd, 0x0e },
+      {
+        0xdb, 0xf3, 0x19, 0x4c, 0xc4, 0x4c, 0xed, 0x37, 0x42, 0x55, 0x24, 0x22, 0x88, 0x6f, 0xd2, 0x24,
+        0x11, 0xe4, 0x35, 0x4d, 0x2f, 0xd4, 0xbd, 0x92, 0x7a, 0x03, 0x9c, 0x1a, 0x21, 0xbe, 0x7a, 0x6f } },
+    { /* 31 */
+      {
+        0xc2, 0x82, 0x4d, 0xdc, 0xb7, 0xb7, 0x17, 0xa3, 0x60, 0x2e, 0x3e, 0xef, 0xa6, 0xa6, 0x16, 0xa2,
+        0x7a, 0xaa, 0x84, 0xeb, 0x8e, 0xf0, 0x98, 0xae, 0x83, 0x2d, 0xa9, 0x83, 0xc5, 0x6f, 0x6b, 0x04 },
+      {
+        0xc1, 0x84, 0x4e, 0x79, 0x94, 0x59, 0x59, 0xa1, 0x37, 0xea, 0x8b, 0x12, 0xaa, 0x1a, 0xee, 0x0a,
+        0x04, 0x55, 0x3a, 0x28, 0x5b, 0xed, 0xfb, 0xbd, 0x19, 0xf5, 0x03, 0x24, 0xdd, 0xb0, 0xa2, 0xe9 } },
+    { /* 32 */
+      {
+        0xd6, 0x53, 0x9c, 0x7d, 0x0f, 0x87, 0xfe, 0xec, 0x94, 0xfe, 0x9d, 0xdd, 0x92, 0x16, 0xcd, 0x30,
+        0x30, 0x9d, 0x42, 0xac, 0x72, 0xe6, 0x51, 0x42, 0x50, 0x43, 0xde, 0xa7, 0xe0, 0xf2, 0x22, 0xc2 },
+      {
+        0x23, 0x31, 0xfb, 0x46, 0x7e, 0xc2, 0x83, 0xb1, 0xec, 0x28, 0xc8, 0x5f, 0x28, 0x06, 0x98, 0xde,
+        0x72, 0x69, 0x2c, 0xf0, 0x32, 0x7f, 0xda, 0x10, 0x03, 0xc5, 0xa5, 0x7c, 0x43, 0x2a, 0xc7, 0xd7 } },
+    { /* 33 */
+      {
+        0xe6, 0xb0, 0x42, 0xfe, 0x79, 0x91, 0xf9, 0x86, 0xa4, 0x8b, 0x8f, 0x33, 0x44, 0x3d, 0xac, 0x8b,
+        0x2c, 0x3d, 0x72, 0xce, 0xee, 0x56, 0x1d, 0xe8, 0x65, 0x1c, 0xfd, 0xeb, 0x43, 0x24, 0x8e, 0x67 },
+      {
+        0x0f, 0x8a, 0xc2, 0x45, 0x99, 0x85, 0xa6, 0x28, 0x2b, 0x60, 0x87, 0xcb, 0x28, 0x92, 0x69, 0x4d,
+        0xfc, 0x1e, 0x96, 0xae, 0xa9, 0x74, 0x16, 0xd7, 0xd0, 0x91, 0x63, 0x6d, 0xe8, 0x10, 0xbc, 0xd2 } },
+    { /* 34 */
+      {
+        0x9b, 0x0b, 0x12, 0x6a, 0xa8, 0x6e, 0x8b, 0x07, 0x4b, 0x2c, 0x74, 0x0c, 0xd3, 0xd2, 0xd9, 0x48,
+        0xce, 0x43, 0xdd, 0x44, 0xfa, 0x9e, 0x11, 0x31, 0x54, 0xe9, 0x08, 0x74, 0x7f, 0x23, 0x26, 0xa2 },
+      {
+        0xd1, 0x69, 0x03, 0x17, 0x29, 0xd9, 0x08, 0x6e, 0x1d, 0x72, 0x50, 0x9e, 0xd3, 0x4f, 0x1a, 0x3a,
+        0x14, 0xfc, 0x8a, 0x01, 0xca, 0x07, 0x66, 0x1c, 0x22, 0x8e, 0xf3, 0x20, 0xb7, 0x7f, 0x5a, 0xf2 } },
+    { /* 35 */
+      {
+        0xa1, 0xa3, 0x8e, 0x4a, 0xfa, 0x29, 0xa4, 0xe1, 0x0c, 0xba, 0x50, 0x18, 0xcb, 0x44, 0x51, 0xb8,
+        0x13, 0xf4, 0x37, 0x4e, 0x01, 0x05, 0xbb, 0xc6, 0x13, 0xe4, 0x4a, 0xcc, 0x03, 0xc5, 0xfe, 0x33 },
+      {
+        0xc0, 0x29, 0xc8, 0x11, 0x7e, 0x43, 0x26, 0x09, 0xec, 0x25, 0x23, 0x63, 0xf9, 0x3a, 0x1f, 0x87,
+        0x7a, 0xfe, 0x10, 0x8f, 0x99, 0x6e, 0xa7, 0xf2, 0x06, 0x3f, 0xb9, 0xa8, 0xf4, 0x40, 0x39, 0x17 } },
+    { /* 36 */
+      {
+        0xc8, 0x7f, 0x3f, 0x53, 0x3e, 0xfc, 0x8f, 0xac, 0x46, 0x89, 0x15, 0x11, 0xd6, 0x1d, 0x1a, 0x3a,
+        0xda, 0xa4, 0x11, 0x32, 0x78, 0x68, 0xab, 0x32, 0x25, 0x08, 0x0c, 0x29, 0x48, 0x6e, 0x54, 0x8e },
+      {
+        0xce, 0x64, 0x7f, 0x03, 0xdd, 0x51, 0xc3, 0x1d, 0xe4, 0x99, 0x0f, 0x2b, 0xde, 0xfa, 0xa4, 0x40,
+        0x10, 0xbb, 0x15, 0xf6, 0x76, 0x48, 0xf5, 0xd2, 0x98, 0x4f, 0x61, 0x3f, 0xf3, 0xe3, 0x13, 0x93 } },
+    { /* 37 */
+      {
+        0x4a, 0xef, 0x9a, 0x62, 0xc5, 0xd2, 0x98, 0x8f, 0x92, 0x33, 0xe3, 0x1d, 0x94, 0xdd, 0x9c, 0x97,
+        0x48, 0xb7, 0xee, 0x7b, 0xf4, 0x97, 0xcf, 0x35, 0x31, 0x61, 0xeb, 0xdd, 0x9c, 0x2c, 0x0a, 0xbf },
+      {
+        0x79, 0x28, 0xca, 0xfd, 0x02, 0x22, 0xb4, 0x9c, 0x87, 0x84, 0xcd, 0xbf, 0xc1, 0x85, 0x77, 0x82,
+        0x9d, 0x25, 0xe0, 0x03, 0xc1, 0xf0, 0x2b, 0x47, 0x89, 0xa5, 0x41, 0x61, 0xa0, 0x3e, 0x64, 0x56 } },
+    { /* 38 */
+      {
+        0xa2, 0x81, 0x63, 0xd3, 0x6f, 0x22, 0x53, 0x6a, 0xf5, 0x69, 0x67, 0x9f, 0x29, 0xff, 0x34, 0x8b,
+        0xb2, 0x72, 0x5e, 0x8a, 0x80, 0xbd, 0x9b, 0x8a, 0x5a, 0x59, 0x1a, 0xbd, 0xec, 0xf4, 0xea, 0x23 },
+      {
+        0x64, 0x6f, 0xed, 0xa7, 0xef, 0x74, 0xa9, 0x5a, 0x41, 0x04, 0x6c, 0x8f, 0x59, 0x28, 0xb0, 0x3d,
+        0x60, 0xcb, 0xe4, 0xa1, 0xc4, 0xa0, 0x95, 0x67, 0x89, 0xe7, 0xa8, 0xf6, 0x21, 0xc4, 0x39, 0x71 } },
+    { /* 39 */
+      {
+        0x22, 0x1a, 0x38, 0x85, 0xea, 0xf0, 0x7f, 0x07, 0x9d, 0xcf, 0x3d, 0x50, 0x84, 0x19, 0xb8, 0xa0,
+        0xf3, 0xe7, 0xf0, 0x3c, 0x82, 0x47, 0x6e, 0x5c, 0x3a, 0xef, 0x6b, 0xc0, 0x5d, 0x75, 0xd3, 0x10 },
+      {
+        0x75, 0x44, 0x39, 0x6f, 0xc1, 0xc6, 0x17, 0x09, 0xf6, 0xf4, 0x54, 0x09, 0x36, 0xc2, 0x60, 0x0c,
+        0xd7, 0x78, 0x06, 0x6b, 0xbb, 0x49, 0x55, 0x0d, 0x16, 0xd5, 0x33, 0xf3, 0x37, 0xbd, 0xcb, 0x7d } },
+    { /* 40 */
+      {
+        0x8f, 0x7a, 0xe1, 0xf2, 0x60, 0x2d, 0x20, 0x43, 0x84, 0x1d, 0x9d, 0xf6, 0xd4, 0xd8, 0x1f, 0xef,
+        0x7d, 0x0a, 0xba, 0x1e, 0xe1, 0x3c, 0xad, 0xc8, 0xf7, 0x9f, 0x55, 0x6f, 0xde, 0x08, 0xcd, 0x42 },
+      {
+        0x27, 0x6b, 0xcc, 0xb3, 0xbf, 0x0f, 0xa4, 0x97, 0xdb, 0x60, 0xb5, 0x6a, 0x1e, 0xfd, 0xd0, 0xa8,
+        0xfe, 0x51, 0xe0, 0x45, 0xc5, 0x5c, 0xf4, 0x90, 0x95, 0x0c, 0x4d, 0xe4, 0xb5, 0x7e, 0xe1, 0x81 } },
+    { /* 41 */
+      {
+        0x9e, 0xbf, 0xc5, 0x06, 0xf8, 0x26, 0x61, 0x9b, 0x93, 0x3e, 0xcb, 0x52, 0xe3, 0x3a, 0xbe, 0xcc,
+        0xf1, 0xb9, 0x8e, 0x93, 0xe1, 0xbf, 0x71, 0x2b, 0x79, 0x26, 0x62, 0x5b, 0x19, 0xe5, 0xa6, 0x03 },
+      {
+        0x7d, 0xd2, 0x28, 0x2d, 0xbc, 0x71, 0x5e, 0x13, 0xa8, 0xaf, 0x57, 0x03, 0x67, 0x39, 0xf0, 0x03,
+        0x8a, 0xc4, 0x01, 0x2d, 0xfc, 0x4f, 0x95, 0x64, 0xd2, 0x96, 0x5f, 0x67, 0xa1, 0x69, 0x2c, 0x52 } },
+    { /* 42 */
+      {
+        0xea, 0xb7, 0x10, 0xd6, 0x93, 0x0c, 0x28, 0xe4, 0xf2, 0xc6, 0x79, 0xe2, 0x67, 0x39, 0xe5, 0x06,
+        0x53, 0x46, 0x08, 0x2c, 0x3f, 0x1e, 0xa4, 0x28, 0x3e, 0xc0, 0x15, 0x87, 0xcf, 0x2b, 0xb4, 0x90 },
+      {
+        0xf1, 0xfe, 0xea, 0xec, 0x6b, 0x25, 0xbd, 0xce, 0x8c, 0xde, 0x42, 0x59, 0x18, 0x54, 0xea, 0xaf,
+        0x63, 0x64, 0x06, 0x78, 0xad, 0x54, 0xb0, 0xe6, 0xe9, 0x94, 0x7f, 0xf8, 0xe0, 0x43, 0x24, 0x9a } },
+    { /* 43 */
+      {
+        0x32, 0x4c, 0x9d, 0x41, 0x4c, 0xf8, 0x45, 0x78, 0x5a, 0xc0, 0x51, 0x01, 0x82, 0xcb, 0xfe, 0xa2,
+        0x88, 0xfd, 0x27, 0x35, 0x34, 0xe3, 0xca, 0xe9, 0x49, 0xf7, 0xe8, 0x99, 0x1b, 0xdd, 0x2a, 0xa2 },
+      {
+        0x2f, 0x74, 0xd9, 0x95, 0xb9, 0x16, 0xf7, 0xa6, 0x32, 0xec, 0xdb, 0x3c, 0xdd, 0xe2, 0xdf, 0xad,
+        0x69, 0xd6, 0x7c, 0xf1, 0x5f, 0x3b, 0x99, 0x32, 0xa2, 0x42, 0x31, 0x17, 0x19, 0xf1, 0x30, 0x61 } },
+    { /* 44 */
+      {
+        0x63, 0xb6, 0xf1, 0x3c, 0x1c, 0x9c, 0x14, 0x62, 0xd0, 0x41, 0x08, 0x33, 0x5e, 0x88, 0x01, 0xe7,
+        0x32, 0xf6, 0x3a, 0x04, 0x45, 0x57, 0x4f, 0x91, 0x35, 0xf7, 0xed, 0x42, 0x3d, 0x14, 0xbc, 0x68 },
+      {
+        0x90, 0x16, 0x39, 0x24, 0xa7, 0xab, 0x06, 0xb9, 0x25, 0x82, 0xb2, 0x77, 0x42, 0x36, 0xf5, 0xcc,
+        0xa0, 0x7b, 0x5b, 0x2c, 0x36, 0x03, 0x50, 0xdf, 0x18, 0x0d, 0xcb, 0xcd, 0x9d, 0xc7, 0x20, 0x1f } },
+    { /* 45 */
+      {
+        0x4e, 0xee, 0xb1, 0xde, 0x6c, 0x7b, 0x3c, 0xab, 0xcb, 0xad, 0x6b, 0x30, 0x64, 0x69, 0x14, 0xd7,
+        0x80, 0x83, 0x72, 0xe6, 0x9d, 0x8e, 0x28, 0x38, 0x35, 0xe7, 0x51, 0xb5, 0x07, 0x67, 0xcd, 0xf2 },
+      {
+        0x5f, 0xa4, 0x2f, 0x4f, 0xbe, 0x61, 0xdd, 0x14, 0x46, 0x26, 0xc3, 0x13, 0x18, 0x1f, 0x81, 0x1b,
+        0xd1, 0x62, 0x29, 0x0f, 0xd2, 0x81, 0x92, 0x0b, 0x3e, 0xf3, 0xaf, 0x96, 0x8c, 0x96, 0x50, 0x04 } },
+    { /* 46 */
+      {
+        0x2e, 0xa3, 0xf1, 0xc0, 0x01, 0x53, 0x3e, 0x9e, 0xb5, 0x66, 0xe4, 0xc0, 0xb6, 0x93, 0xa2, 0x26,
+        0x13, 0xc2, 0x82, 0x77, 0xea, 0x9e, 0x83, 0xc3, 0x1f, 0x5a, 0x9c, 0x53, 0xa1, 0x85, 0xe9, 0x8e },
+      {
+        0x4c, 0x1d, 0x71, 0x42, 0xee, 0xed, 0x29, 0x34, 0x67, 0x7d, 0xf9, 0x28, 0xb4, 0xdd, 0x95, 0xdd,
+        0x7d, 0xf6, 0x08, 0xc3, 0xcb, 0x4e, 0x98, 0xf0, 0xb4, 0xdb, 0xcc, 0x33, 0x62, 0x15, 0xa2, 0x1f } },
+    { /* 47 */
+      {
+        0xbe, 0x1b, 0x1b, 0xf9, 0xac, 0x4d, 0xd2, 0x02, 0x9e, 0xf4, 0x3b, 0x0f, 0x16, 0x01, 0xcc, 0xa9,
+        0x74, 0xd5, 0xa1, 0x27, 0x05, 0xec, 0xb4, 0xc0, 0x30, 0xbf, 0x23, 0x6c, 0x86, 0xa2, 0xee, 0x12 },
+      {
+        0x05, 0x15, 0xef, 0xac, 0xec, 0xe0, 0xb7, 0x2b, 0x5e, 0x0d, 0xb1, 0xa9, 0x7f, 0x31, 0x3d, 0xfa,
+        0x6f, 0x78, 0x97, 0x57, 0xcd, 0x52, 0x14, 0xb3, 0x84, 0x94, 0x3e, 0x47, 0x17, 0xb6, 0xf9, 0x3b } },
+    { /* 48 */
+      {
+        0x5a, 0x43, 0xca, 0xfd, 0x2b, 0x48, 0xa3, 0xf4, 0xb6, 0xbf, 0xbe, 0xa4, 0x44, 0xba, 0xea, 0xdf,
+        0x20, 0x4a, 0x9f, 0xea, 0xf3, 0x76, 0xa9, 0xc1, 0x43, 0x3a, 0x67, 0x7c, 0xa7, 0x8c, 0x3f, 0x8b },
+      {
+        0xec, 0xd4, 0xbc, 0x73, 0x89, 0x47, 0x72, 0xe1, 0x8c, 0x9c, 0xca, 0x3e, 0xd8, 0x7c, 0x2b, 0x88,
+        0xb2, 0x11, 0x58, 0x44, 0xf6, 0x83, 0x79, 0x85, 0xe2, 0x5a, 0x7d, 0x0b, 0x67, 0xd1, 0xd2, 0x26 } },
+    { /* 49 */
+      {
+        0x7a, 0xb8, 0x03, 0xd9, 0xb5, 0x55, 0xd1, 0x75, 0xf9, 0xb6, 0x43, 0xe5, 0xe8, 0xfb, 0x06, 0x79,
+        0xf2, 0x6d, 0xa8, 0xbd, 0xd9, 0x25, 0xc3, 0x59, 0x36, 0x8a, 0xbe, 0xc6, 0x78, 0x34, 0x90, 0xe7 },
+      {
+        0x79, 0x07, 0x0e, 0xa5, 0x56, 0x5c, 0x1f, 0xbb, 0x02, 0xd7, 0xcf, 0x1c, 0xc6, 0x17, 0x95, 0x7a,
+        0x07, 0xfb, 0xbf, 0x25, 0xba, 0x41, 0x7a, 0x49, 0x1b, 0x40, 0x59, 0x99, 0x4e, 0xba, 0xe5, 0x95 } },
+    { /* 50 */
+      {
+        0x7d, 0x1f, 0x22, 0x6d, 0x86, 0x51, 0x52, 0x4e, 0xbf, 0x4a, 0xdd, 0x81, 0x6a, 0xd2, 0x7b, 0x42,
+        0x9c, 0x49, 0x96, 0x9d, 0x9f, 0xf0, 0x67, 0x60, 0x70, 0x19, 0x46, 0x02, 0xd9, 0xb0, 0x28, 0xfa },
+      {
+        0xd6, 0xf5, 0xa3, 0x43, 0x33, 0x65, 0x13, 0x6b, 0xe3, 0xa6, 0x1f, 0xe5, 0xd0, 0x54, 0xb9, 0x03,
+        0xd3, 0x56, 0x07, 0x72, 0x65, 0x93, 0x87, 0x07, 0xb0, 0x77, 0x9b, 0x40, 0xee, 0xcd, 0x77, 0x24 } },
+    { /* 51 */
+      {
+        0x3d, 0x10, 0x90, 0x7c, 0xe8, 0xff, 0x9f, 0x28, 0x7d, 0xab, 0x07, 0x2f, 0x8d, 0xd8, 0xbf, 0x8c,
+        0x7c, 0x9f, 0x60, 0xa0, 0x4d, 0x55, 0x46, 0xa8, 0x25, 0xc8, 0x7c, 0x76, 0xd2, 0x97, 0x0f, 0xcf },
+      {
+        0x6e, 0x9e, 0xef, 0x0b, 0x42, 0xde, 0x6d, 0x8d, 0xe4, 0xa2, 0xd4, 0xb1, 0x47, 0x12, 0x3b, 0xa6,
+        0x5d, 0xfd, 0x49, 0x07, 0xc3, 0xfc, 0xfd, 0xaf, 0xb0, 0x8d, 0x6d, 0x0e, 0x34, 0xbb, 0x2a, 0x29 } },
+    { /* 52 */
+      {
+        0xe9, 0xb5, 0x5d, 0x57, 0xa1, 0x24, 0x6e, 0x42, 0xa7, 0xbf, 0xc9, 0x17, 0x3e, 0x5a, 0xe6, 0x63,
+        0x57, 0x9f, 0x27, 0x05, 0x53, 0x28, 0xd3, 0x9e, 0x81, 0x25, 0x5a, 0xf5, 0xcb, 0xb5, 0x5f, 0x9d },
+      {
+        0xaf, 0x9d, 0x8a, 0x86, 0x18, 0xc9, 0x67, 0xb9, 0x50, 0xe2, 0x15, 0xef, 0x37, 0x3c, 0x36, 0x1c,
+        0x87, 0x48, 0xd2, 0x97, 0x45, 0x7b, 0xd3, 0xc0, 0x24, 0x0e, 0xcd, 0x94, 0x75, 0x62, 0x91, 0x88 } },
+    { /* 53 */
+      {
+        0xa2, 0x6d, 0x67, 0xe8, 0xf5, 0xac, 0x67, 0x9a, 0xe8, 0xf2, 0xa3, 0xf2, 0x91, 0x10, 0x8c, 0xa6,
+        0x03, 0xf7, 0x41, 0x0f, 0xc7, 0x00, 0xc6, 0x16, 0x79, 0xa0, 0x41, 0x04, 0x0a, 0x04, 0x14, 0x3f },
+      {
+        0xf2, 0x53, 0xb0, 0x0c, 0x71, 0xd1, 0x2e, 0xe0, 0x63, 0x9a, 0x97, 0xdd, 0xce, 0x0e, 0xad, 0x44,
+        0xf1, 0xaa, 0xeb, 0xd2, 0x3a, 0x0b, 0x55, 0x87, 0xa1, 0x5d, 0xbf, 0xeb, 0xb8, 0x3f, 0xbd, 0x9a } },
+    { /* 54 */
+      {
+        0x19, 0xfa, 0x80, 0xb7, 0x2c, 0x6d, 0xe4, 0x4a, 0x60, 0x0b, 0x53, 0x8b, 0x8a, 0xf8, 0x29, 0xa2,
+        0x52, 0x2e, 0x26, 0xa1, 0x67, 0x86, 0xe3, 0xa5, 0x7b, 0xae, 0xcf, 0x4c, 0x9e, 0x35, 0xe5, 0x7c },
+      {
+        0x65, 0x17, 0x87, 0x66, 0xa2, 0x3c, 0xf3, 0xeb, 0x40, 0x13, 0x77, 0xa3, 0xc2, 0x45, 0x96, 0x7d,
+        0x2e, 0x4b, 0xc2, 0x1a, 0x67, 0x14, 0x58, 0x7f, 0xb5, 0x23, 0x64, 0xf0, 0xaa, 0xf0, 0xff, 0x52 } },
+    { /* 55 */
+      {
+        0x6f, 0x52, 0xa8, 0x64, 0xc6, 0x9f, 0x55, 0xfb, 0xcd, 0xe3, 0xbc, 0x9a, 0x47, 0x13, 0x2a, 0x20,
+        0x42, 0x02, 0x1f, 0x02, 0xc4, 0xab, 0xc0, 0xee, 0xc1, 0xc8, 0x18, 0x38, 0x92, 0x3a, 0xc0, 0x00 },
+      {
+        0xce, 0x61, 0xeb, 0xc3, 0xd3, 0x41, 0x3d, 0x4a, 0x64, 0x9e, 0x0b, 0x53, 0x26, 0x12, 0x99, 0x8b,
+        0x24, 0x4c, 0x94, 0x3b, 0xc8, 0x8b, 0xd7, 0x4e, 0x0b, 0xdf, 0xd3, 0xe4, 0xdf, 0x89, 0xff, 0x6a } },
+    { /* 56 */
+      {
+        0xa6, 0x87, 0xdc, 0x98, 0x48, 0xfe, 0x2e, 0xf3, 0x51, 0x83, 0x13, 0x90, 0xd8, 0x7e, 0x44, 0xdb,
+        0xa7, 0x27, 0x10, 0xae, 0xdb, 0x6c, 0x22, 0x4e, 0xe3, 0x16, 0x29, 0x04, 0x2c, 0xba, 0x5a, 0x90 },
+      {
+        0xe6, 0xfa, 0x0c, 0x69, 0xe8, 0x5f, 0x67, 0x04, 0x16, 0xd3, 0xbc, 0xd0, 0x12, 0xb0, 0x44, 0xa2,
+        0xe3, 0x42, 0x8d, 0x8e, 0xc9, 0xa7, 0xbc, 0x12, 0x85, 0x7e, 0x98, 0x55, 0x16, 0xa2, 0x1c, 0xa9 } },
+    { /* 57 */
+      {
+        0x06, 0x64, 0xc9, 0x33, 0xdc, 0xd2, 0x66, 0xf6, 0xbf, 0xe1, 0xf2, 0x63, 0xa6, 0xb1, 0x83, 0x92,
+        0xc8, 0x6d, 0x49, 0xa6, 0xe1, 0x5f, 0x3a, 0xcf, 0xe4, 0xcc, 0xa3, 0x4b, 0x8f, 0xd4, 0x26, 0x92 },
+      {
+        0x30, 0x6f, 0xc9, 0x57, 0x01, 0xac, 0xf1, 0x9e, 0x28, 0x17, 0x1f, 0x7b, 0xc7, 0x73, 0xb8, 0x84,
+        0x1c, 0xbc, 0xc8, 0xc3, 0x74, 0x9c, 0xe6, 0xbc, 0x86, 0x73, 0x8c, 0xf5, 0x19, 0x39, 0x9d, 0x88 } },
+    { /* 58 */
+      {
+        0x2a, 0x68, 0x57, 0x9b, 0x20, 0x8c, 0x06, 0x26, 0x0f, 0xc8, 0xf8, 0x76, 0x9c, 0x64, 0xe8, 0xe7,
+        0x63, 0x7f, 0xc2, 0x6a, 0x19, 0x5f, 0xbc, 0x40, 0x0d, 0xa7, 0xa7, 0x37, 0xaf, 0xb6, 0xa4, 0x19 },
+      {
+        0x17, 0x90, 0x9f, 0x6c, 0xe8, 0xa2, 0xdd, 0x0c, 0x66, 0xbf, 0x9a, 0xdb, 0xe5, 0x15, 0x5c, 0xf1,
+        0xe4, 0xe0, 0x93, 0x13, 0xab, 0x23, 0xae, 0x94, 0x82, 0xe8, 0x23, 0x10, 0x86, 0x28, 0xab, 0xc3 } },
+    { /* 59 */
+      {
+        0x85, 0xf4, 0x52, 0x19, 0x9e, 0xb8, 0x2d, 0xfb, 0x52, 0x61, 0xc3, 0x16, 0x02, 0x42, 0xbf, 0x5a,
+        0x7b, 0xa3, 0xa1, 0xaa, 0x49, 0xcc, 0xef, 0x62, 0x76, 0x7c, 0x35, 0x96, 0x43, 0xd7, 0xad, 0x31 },
+      {
+        0x2c, 0xab, 0x26, 0xfc, 0xbc, 0x61, 0x31, 0x6d, 0xde, 0x70, 0x61, 0x7a, 0x15, 0x39, 0x05, 0xa3,
+        0xc9, 0x77, 0x1e, 0xc1, 0x4c, 0xf6, 0x61, 0x33, 0x55, 0x4c, 0xb3, 0x82, 0x37, 0xb4, 0x2e, 0x47 } },
+    { /* 60 */
+      {
+        0x1a, 0x53, 0x0c, 0xe9, 0xcc, 0xbd, 0x50, 0xdc, 0x2b, 0x07, 0x6f, 0xe5, 0xe1, 0xb8, 0xf9, 0x12,
+        0x9a, 0x8f, 0xbe, 0x88, 0xa4, 0x8d, 0xf6, 0x4e, 0x7d, 0xab, 0xab, 0xbd, 0x75, 0xc1, 0x03, 0x15 },
+      {
+        0x73, 0x74, 0x7d, 0x4b, 0x38, 0x52, 0x3a, 0x19, 0xd5, 0x8f, 0xca, 0xaf, 0x59, 0x04, 0xa2, 0xfa,
+        0xf8, 0x4e, 0x73, 0xbe, 0x4d, 0x63, 0x6a, 0x15, 0x47, 0x36, 0x1a, 0xb7, 0x66, 0x47, 0xd2, 0x25 } },
+    { /* 61 */
+      {
+        0x81, 0x6b, 0x19, 0xde, 0x52, 0x1e, 0x4f, 0xf3, 0x5e, 0x66, 0x65, 0x38, 0x9a, 0x1c, 0xfc, 0x9c,
+        0x5d, 0x8a, 0x00, 0x27, 0xab, 0x3b, 0x62, 0x3c, 0x6e, 0x6b, 0x0f, 0xb8, 0xb6, 0x86, 0x4c, 0xc0 },
+      {
+        0x02, 0x80, 0x46, 0x92, 0xd9, 0xd3, 0xe6, 0x5f, 0x49, 0xce, 0xf8, 0x20, 0xa9, 0x49, 0x87, 0x3d,
+        0x1d, 0x46, 0xcb, 0x1c, 0x8f, 0x14, 0x64, 0xd7, 0x56, 0x70, 0x9a, 0xd0, 0x0b, 0xc4, 0x47, 0xf8 } },
+    { /* 62 */
+      {
+        0xa4, 0xf9, 0x24, 0xa2, 0x2a, 0xfa, 0x74, 0xd9, 0xe9, 0x43, 0x7e, 0xc9, 0x96, 0xcf, 0xed, 0xf8,
+        0x4e, 0x9a, 0xd4, 0x8e, 0x86, 0x94, 0x58, 0xfb, 0x1a, 0xe0, 0xea, 0x28, 0xad, 0x8b, 0x59, 0x76 },
+      {
+        0xad, 0x31, 0xed, 0xac, 0x8c, 0x17, 0x9f, 0xc7, 0xa1, 0x49, 0x6f, 0xe6, 0x91, 0xdc, 0x2e, 0x7c,
+        0xe5, 0xd6, 0xdd, 0x0e, 0xba, 0x6f, 0x55, 0x7f, 0xcb, 0x5b, 0x18, 0x45, 0xaa, 0xf7, 0x97, 0xc0 } },
+    { /* 63 */
+      {
+        0xf3, 0x02, 0x05, 0x99, 0x62, 0x96, 0xe8, 0xfc, 0xd0, 0x2e, 0xc4, 0x41, 0x83, 0x3a, 0xcc, 0xb5,
+        0x6c, 0xe7, 0xc4, 0xf7, 0x4a, 0x59, 0x71, 0x59, 0xf9, 0xc5, 0xe9, 0xde, 0x44, 0xb0, 0x6e, 0xd7 },
+      {
+        0x24, 0x03, 0xea, 0x21, 0x83, 0x0c, 0x38, 0x8b, 0x42, 0x17, 0x01, 0x66, 0xf5, 0xdd, 0x78, 0xd6,
+        0xff, 0x42, 0x9d, 0xda, 0x9c, 0x84, 0x9b, 0x09, 0x7d, 0xf6, 0xc5, 0xc6, 0xc2, 0xaf, 0xbe, 0x06 } }
+};
+
+/* R = k * G on P-256, left in projective Montgomery form */
+static int ecc_p256_mulmod_base_comb(mp_int* k, ecc_point* R, mp_int* a,
+                                     mp_int* modulus, mp_digit mp, void* heap)
+{
+    int err;
+    int c, i, bit, idx;
+    ecc_point* T;
+
+    T = wc_ecc_new_point_h(heap);
+    if (T == NULL) {
+        return MEMORY_E;
+    }
+
+    /* table points are affine: Z is 1 in Montgomery form */
+    err = mp_montgomery_calc_normalization(T->z, modulus);
+    /* start at infinity */
+    if (err == MP_OKAY)
+        err = mp_set(R->x, 0);
+    if (err == MP_OKAY)
+        err = mp_set(R->y, 0);
+    if (err == MP_OKAY)
+        err = mp_set(R->z, 1);
+
+    for (c = ECC_P256_COMB_SPACING - 1; err == MP_OKAY && c >= 0; c--) {
+        err = ecc_projective_dbl_point_safe(R, R, a, modulus, mp);
+
+        idx = 0;
+        for (i = 0; i < ECC_P256_COMB_TEETH; i++) {
+            bit = c + i * ECC_P256_COMB_SPACING;
+            idx |= (int)((get_digit(k, bit / DIGIT_BIT) >>
+                          (bit % DIGIT_BIT)) & 1) << i;
+        }
+        if (err == MP_OKAY && idx != 0) {
+            err = mp_read_unsigned_bin(T->x, ecc_p256_comb[idx - 1][0], 32);
+            if (err == MP_OKAY)
+                err = mp_read_unsigned_bin(T->y, ecc_p256_comb[idx - 1][1],
+                                           32);
+            if (err == MP_OKAY)
+                err = ecc_projective_add_point_safe(R, T, R, a, modulus, mp,
+                                                    NULL);
+        }
+    }
+
+    wc_ecc_del_point_h(T, heap);
+
+    return err;
+}
+#endif /* WOLFSSL_ECC_P256_COMB */
+
 static WC_INLINE void wc_ecc_reset(ecc_key* key)
 {
     /* make sure required key variables are reset */
@@ -4365,6 +4878,14 @@ static int ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
             err = mp_set(base->z, 1);
 
         /* make the public key */
+    #ifdef HAVE_ECC_P256_COMB
+        if (err == MP_OKAY && key->idx != ECC_CUSTOM_IDX &&
+                                   ecc_sets[key->idx].id == ECC_SECP256R1) {
+            err = ecc_p256_mulmod_base_comb(&key->k, pub, curve->Af,
+                                            curve->prime, mp, key->heap);
+        }
+        else
+    #endif
         if (err == MP_OKAY) {
             /* Map in a separate call as this should be constant time */
             err = wc_ecc_mulmod_ex2(&key->k, base, pub, curve->Af, curve->prime,